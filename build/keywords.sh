@@ -0,0 +1,159 @@
+#
+# Generate the perfect hash tables used by the lexer to recognize keywords.
+#
+# Usage: keywords.sh [LEXER]
+#
+# The keywords are read from kwd_lst in the lexer (../src/lexer.l by default)
+# and the kwd_seed and kwd_slot tables are written to stdout. Replace the old
+# tables in the lexer with the new ones whenever kwd_lst is changed.
+#
+# The keywords are divided into buckets by the (case folded) FNV-1a hash of the
+# keyword. The buckets are then processed, largest bucket first, and for each
+# bucket the smallest seed that gives all its keywords a free slot of their own
+# is picked. To find a keyword, hash it to get the seed, XOR the hash with the
+# seed, multiply by the golden ratio and use the top 8 bits as slot, see
+# keyword() in the lexer. The slot holds the index + 1 of the keyword in kwd_lst,
+# or 0 if the slot is unused. Not finding a seed for each bucket is an error,
+# add buckets if that happens.
+#
+lex=${1:-../src/lexer.l}
+bkt=32
+
+awk -v bkt=$bkt '
+# XOR of two bytes.
+function bxor(a, b,    r, i)
+{
+    r = 0
+    for(i = 1; i < 256; i *= 2)
+    {
+        if(int(a / i) % 2 != int(b / i) % 2)
+        {
+            r += i
+        }
+    }
+    return r
+}
+
+# FNV-1a with ASCII case folding.
+function hash(s,    h, i, c, l)
+{
+    h = 2166136261
+
+    for(i = 1; i <= length(s); i++)
+    {
+        c = ord[substr(s, i, 1)]
+        c = int(c / 32) % 2 ? c : c + 32
+        l = h % 256
+        h = h - l + bxor(l, c)
+
+        # h * 16777619 (2^24 + 403) modulo 2^32 without losing precision.
+        h = ((h % 256) * 16777216 + h * 403) % 4294967296
+    }
+    return h
+}
+
+# Top 8 bits of (h XOR seed) * 2654435761 (0x9E3779B1) modulo 2^32.
+function slot(h, seed,    l)
+{
+    l = h % 256
+    h = h - l + bxor(l, seed)
+    return int(((h * 40503 % 65536) * 65536 + h * 31153) % 4294967296 / 16777216)
+}
+
+# Print byte table, the same way as the other tables in the lexer.
+function table(name, n, v,    i, s)
+{
+    printf("static const uint8_t %s[%d] =\n{", name, n)
+    for(i = 0; i < n; i++)
+    {
+        s = i % 16 ? " " : "\n    "
+        printf("%s%3d%s", s, v[i], i < n - 1 ? "," : "")
+    }
+    printf("\n};\n")
+}
+
+BEGIN {
+    for(i = 1; i < 256; i++)
+    {
+        ord[sprintf("%c", i)] = i
+    }
+}
+
+/kwd_lst\[\] =/ { on = 1; next }
+on && /^};/     { on = 0 }
+on && /{ "/ {
+    s = $0
+    sub(/^[^"]*"/, "", s)
+    sub(/".*$/, "", s)
+    kwd[++num] = s
+}
+
+END {
+    if(!num)
+    {
+        print "no keywords found" > "/dev/stderr"
+        exit 1
+    }
+
+    # Divide keywords into buckets.
+    for(i = 1; i <= num; i++)
+    {
+        h[i] = hash(kwd[i])
+        b = h[i] % bkt
+        mem[b, ++cnt[b]] = i
+    }
+
+    # Largest bucket first.
+    for(n = num; n > 0; n--)
+    {
+        for(b = 0; b < bkt; b++)
+        {
+            if(cnt[b] != n)
+            {
+                continue
+            }
+
+            for(sd = 1; sd < 256; sd++)
+            {
+                ok = 1
+                delete tmp
+                for(j = 1; j <= n && ok; j++)
+                {
+                    s = slot(h[mem[b, j]], sd)
+                    ok = !((s in used) || (s in tmp))
+                    tmp[s] = mem[b, j]
+                }
+
+                if(ok)
+                {
+                    break
+                }
+            }
+
+            if(!ok)
+            {
+                print "no seed found, add buckets" > "/dev/stderr"
+                exit 1
+            }
+
+            seed[b] = sd
+            for(s in tmp)
+            {
+                used[s] = tmp[s]
+            }
+        }
+    }
+
+    for(b = 0; b < bkt; b++)
+    {
+        seeds[b] = seed[b] + 0
+    }
+
+    for(s = 0; s < 256; s++)
+    {
+        slots[s] = used[s] + 0
+    }
+
+    table("kwd_seed", bkt, seeds)
+    table("kwd_slot", 256, slots)
+}' "$lex"
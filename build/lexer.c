@@ -3,7 +3,7 @@
 
 #define  YY_INT_ALIGNED short int
 
-/* A lexical scanner generated by flex */
+/* A lexical scanner generated by flex 2.6.4, tables and actions regenerated from lexer.l without flex */
 
 #define FLEX_SCANNER
 #define YY_FLEX_MAJOR_VERSION 2
@@ -350,8 +350,8 @@ static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
 	yyg->yy_hold_char = *yy_cp; \
 	*yy_cp = '\0'; \
 	yyg->yy_c_buf_p = yy_cp;
-#define YY_NUM_RULES 155
-#define YY_END_OF_BUFFER 156
+#define YY_NUM_RULES 21
+#define YY_END_OF_BUFFER 22
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -359,87 +359,12 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[717] =
+static const flex_int16_t yy_accept[40] =
     {   0,
-        0,    0,    0,    0,  156,  145,  149,  147,  148,  155,
-      145,  145,  155,    4,    5,   14,   12,   13,   15,    1,
-      150,    7,    6,    9,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  154,  152,  153,  145,  149,
-      146,    0,  143,    0,    2,    3,    0,  144,    0,    1,
-      145,    1,    8,   11,   10,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,   29,   26,  145,
-      145,  145,  145,  145,  145,   17,  145,  145,  145,  145,
-
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  151,    0,  143,    0,    0,  144,    0,    1,
-      145,   98,   16,  145,  145,  145,  145,  145,   44,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,   19,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,   89,  145,  145,   27,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-
-      145,  145,  145,  145,  145,   18,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  101,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  108,  109,  145,  145,  145,  145,   80,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  116,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,   88,
-      131,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-
-       93,  145,   70,  145,  145,  145,  145,  145,  145,   73,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,   21,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,   77,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  110,  111,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  117,  145,  145,
-      145,  145,  145,  145,  145,  123,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  128,  129,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-
-      145,   32,  145,   31,  145,   30,  145,  145,  145,  145,
-       99,  145,  145,   36,  145,  145,  145,  145,  145,  145,
-       20,   23,   22,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,   78,  145,  145,   67,  145,   45,
-      145,  145,  145,  145,  145,  145,  145,   52,  145,  145,
-      145,   54,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
-      145,  127,  145,  145,   94,   87,  145,  145,   60,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,  136,  145,
-       34,   35,  145,  145,   63,  145,  145,  145,  145,  145,
-
-      145,  145,  145,  145,   42,  145,   43,   37,  145,  145,
-      145,  100,  102,  145,  145,  103,  145,  145,  105,  145,
-       75,  145,  106,  107,   47,   79,  145,  145,   81,  145,
-      145,  145,  145,  145,   53,  145,  145,  145,  145,  118,
-      145,   83,   84,  119,  120,  121,  145,   85,  145,  145,
-      145,  145,  145,  126,  145,   86,  145,  145,   33,  145,
-      145,  145,  145,  145,  145,  145,  145,  145,   90,  145,
-      145,  145,  145,  145,  145,   72,   71,  145,  145,  145,
-      141,  145,  145,  145,  145,  145,  145,  145,   65,  145,
-      145,   76,  145,   48,  145,  145,  145,  145,  145,  114,
-
-      145,  145,   56,  145,  145,  145,  124,  125,   58,   59,
-      145,  145,  130,  145,   68,  145,  133,  145,  145,  145,
-      145,  145,  145,  145,  145,   91,   92,  145,  145,  145,
-      145,  145,   40,   39,  145,   38,  145,  145,  145,   74,
-      145,   49,  145,   50,  145,  145,  145,  145,  145,  145,
-      145,   28,  145,  145,  145,  145,   24,  145,   69,  145,
-      145,   61,   62,  145,  145,  139,  138,  145,   41,   66,
-      145,  145,   46,  145,  145,  145,  145,   55,   82,  122,
-      145,  145,  145,  145,  145,   25,  145,  137,   64,  140,
-      142,  145,  104,  145,  145,  113,  115,  145,  145,  145,
-
-      135,  134,  145,  145,  145,   51,   95,   57,  145,   96,
-       97,  145,  145,  112,  132,    0
+        0,    0,    0,    0,   22,   11,   15,   13,   14,   21,
+       11,   11,   21,    4,    5,    7,    6,   11,    8,    1,
+       16,   20,   18,   19,   12,    0,    9,    0,    2,    3,
+        0,   10,    0,   11,   17,    9,   10,    1,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -449,35 +374,23 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    2,    1,    5,    1,    6,    7,    1,    8,    9,
        10,   11,   12,    1,   13,   14,   15,   16,   16,   17,
-       17,   17,   17,   17,   17,   17,   17,    1,   18,   19,
-       20,   21,    1,    1,   22,   23,   24,   25,   26,   27,
-       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
-       38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
-        1,   48,    1,    1,   49,    1,   50,   51,   52,   53,
-
-       54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   70,   71,   72,   73,
-       74,   75,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       17,   17,   17,   17,   17,   17,   17,    1,   18,    1,
+        1,    1,    1,    1,   19,   19,   19,   19,   19,   19,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,   20,    1,    1,    1,    1,   19,   19,   19,   19,
+
+       19,   19,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
 
-static const YY_CHAR yy_meta[76] =
-    {   0,
-        1,    2,    2,    2,    2,    1,    1,    2,    2,    2,
-        2,    2,    1,    1,    2,    1,    1,    2,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -486,520 +399,137 @@ static const YY_CHAR yy_meta[76] =
         1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[723] =
+static const YY_CHAR yy_meta[21] =
     {   0,
-        0,    0,   73,   75,  205,    0,  172, 1464,  154,   75,
-      108,  139,   73, 1464, 1464, 1464, 1464,   66, 1464,   70,
-     1464,   68,    0,  121,   75,   69,  115,   92,  125,   81,
-       59,   66,  129,  145,  142,  148,  127,   58,  147,  198,
-      164,  153,  196,   65,   67, 1464, 1464,  106,    0,  103,
-     1464,  197, 1464,  230,    0,   81,  199, 1464,  201,   79,
-       86,   90,    0,    0,    0,  118,  175,  185,  186,  197,
-      202,  189,  200,  207,  210,  229,  215,  250,  219,  222,
-      248,  256,  243,  246,  238,  247,  252,    0,  271,  264,
-      257,  255,  278,  274,  294,    0,  276,  271,  286,  303,
-
-      296,  329,  297,  310,  321,  308,  297,  329,  326,  331,
-      321,  332,  313,  335,  351,  334,  350,  345,  355,  348,
-      349,   45, 1464,  341,  386,  390,  392,  397,  404,  325,
-      355,    0,    0,  382,  430,  379,  379,  396,    0,  384,
-      379,  386,  394,  382,  408,  391,  413,  436,  402,  418,
-      431,  441,  444,  433,  453,  450,  436,  453,  486,  449,
-      452,  455,  453,  465,  457,  483,  484,  473,  484,    0,
-      474,  486,  492,  485,  501,  519,  489,  505,  505,  508,
-      523,  517,  523,  519,    0,  539,  540,  542,  541,  525,
-      535,  538,  545,  540,  547,  562,  554,  546,  556,  585,
-
-      561,  559,  575,  567,  569,    0,  599,  562,  581,  582,
-      594,  594,  600,  590,  596,  593,  608,    0,  603,  603,
-      601,  605,  618,  617,  623,  626,  617,  645,  631,  627,
-      614,  616,  637,    0,    0,  646,  653,  637,  639,    0,
-      646,  650,  648,  667,  651,  666,  659,  659,  669,  661,
-      672,    0,  671,  661,  672,  708,  691,  693,  699,  686,
-      692,  696,  696,  692,  701,  703,  708,  723,  720,  721,
-      711,  724,  705,  711,  727,  718,  721,  732,  737,    0,
-        0,  742,  741,  742,  733,  730,  741,  743,  754,  762,
-      748,  764,  750,  768,  757,  764,  774,  761,  777,  764,
-
-        0,  773,    0,  771,  782,  779,  770,  768,  776,    0,
-      790,  786,  787,  785,  794,  799,  799,  803,  809,  820,
-      805,    0,  808,  822,  815,  819,  830,  831,  819,  830,
-      832,  841,    0,  831,  839,  825,  841,  828,  830,  838,
-      854,  845,    0,    0,  857,  843,  862,  856,  855,  860,
-      854,  880,  869,  868,  871,  877,  888,    0,  874,  885,
-      888,  884,  878,  892,  891,    0,  886,  900,  890,  897,
-      899,  894,  897,  912,  898,  921,  927,    0,    0,  913,
-      930,  931,  934,  918,  933,  936,  926,  946,  933,  937,
-      945,  949,  948,  933,  942,  939,  943,  948,  948,  960,
-
-      945,    0,  968,    0,  959,    0,  960,  985,  979,  969,
-        0,  979,  983,    0,  982,  989,  993,  987,  992,  984,
-        0,    0,    0,  985, 1001, 1005, 1005,  990,  992,  999,
-     1001, 1012,  997,  998,    0, 1006, 1008,    0, 1022,    0,
-     1012, 1018, 1028, 1034, 1044, 1038, 1037,    0, 1040, 1045,
-     1048,    0, 1040, 1038, 1053, 1055, 1042, 1044, 1058, 1060,
-     1058, 1062, 1048, 1051, 1055, 1071, 1070, 1069, 1079, 1069,
-     1063,    0, 1066, 1083,    0,    0, 1085, 1096,    0, 1102,
-     1095, 1096, 1103, 1095, 1103, 1104, 1111, 1101,    0, 1101,
-        0,    0, 1106, 1100,    0, 1109, 1107, 1106, 1120, 1119,
-
-     1137, 1110, 1118, 1128,    0, 1135,    0,    0, 1134, 1125,
-     1134,    0,    0, 1153, 1144,    0, 1155, 1142,    0, 1157,
-        0, 1158,    0,    0,    0,    0, 1163, 1144,    0, 1164,
-     1151, 1170, 1155, 1155,    0, 1166, 1158, 1170, 1165,    0,
-     1172,    0,    0,    0,    0,    0, 1173,    0, 1182, 1174,
-     1188, 1169, 1187,    0, 1178,    0, 1179, 1184,    0, 1190,
-     1212, 1195, 1205, 1197, 1212, 1212, 1211, 1223,    0, 1212,
-     1223, 1228, 1225, 1226, 1224,    0,    0, 1212, 1234, 1235,
-        0, 1222, 1233, 1222, 1228, 1242, 1241, 1249,    0, 1243,
-     1235,    0, 1240,    0, 1253, 1257, 1266, 1256, 1264,    0,
-
-     1249, 1260,    0, 1269, 1266, 1273,    0,    0,    0,    0,
-     1279, 1269,    0, 1274,    0, 1278,    0, 1264, 1270, 1283,
-     1291, 1283, 1276, 1276, 1286,    0,    0, 1289, 1305, 1284,
-     1285, 1296,    0,    0, 1297,    0, 1322, 1315, 1312,    0,
-     1320,    0, 1309,    0, 1329, 1316, 1316, 1323, 1325, 1326,
-     1336,    0, 1330, 1323, 1330, 1330,    0, 1327,    0, 1343,
-     1330,    0,    0, 1330, 1340,    0,    0, 1335,    0,    0,
-     1356, 1348,    0, 1343, 1361, 1352, 1367,    0,    0,    0,
-     1376, 1380, 1363, 1370, 1380,    0, 1383,    0,    0,    0,
-        0, 1384,    0, 1373, 1388,    0,    0, 1375, 1371, 1382,
-
-        0,    0, 1378, 1379, 1386,    0,    0,    0, 1387,    0,
-        0, 1391, 1392,    0,    0, 1464, 1453,   89, 1455, 1457,
-     1459, 1461
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_def[723] =
+static const flex_int16_t yy_base[40] =
     {   0,
-      716,    1,  717,  717,  716,  718,  716,  716,  716,  719,
-      718,  718,  720,  716,  716,  716,  716,  718,  716,  718,
-      716,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  716,  716,  716,  718,  716,
-      716,  719,  716,  721,   11,  718,  720,  716,  722,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  716,  719,  719,  721,  720,  720,  722,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-
-      718,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,    0,  716,  716,  716,  716,
-      716,  716
+        0,   21,   42,   63,  441,  252,  254,  441,  257,   84,
+      273,  294,  105,  441,  441,  441,  441,  315,  441,  336,
+      441,  441,  441,  261,  441,  126,  441,  147,  357,  378,
+      168,  441,  189,  399,  441,  210,  231,  420,  441
     } ;
 
-static const flex_int16_t yy_nxt[1540] =
+static const flex_int16_t yy_def[40] =
     {   0,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,    0
+    } ;
+
+static const flex_int16_t yy_nxt[463] =
+    {   5,
         6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
-       16,   17,   18,    6,   19,   20,   20,   21,   22,   23,
-       24,   25,   26,   27,   28,   29,   30,   31,   32,   33,
-        6,    6,    6,   34,   35,   36,   37,   38,   39,   40,
-       41,   42,    6,   43,   44,    6,    6,    6,   45,   25,
-       26,   27,   28,   29,   30,   31,   32,   33,    6,    6,
-        6,   34,   35,   36,   37,   38,   39,   40,   41,   42,
-        6,   43,   44,    6,    6,   47,   48,   47,   48,   53,
-       58,   60,   60,   61,   85,   62,   62,   63,   64,   49,
-       71,   86,   61,  207,   62,   62,   56,   66,   72,  100,
-
-      121,  130,  130,   61,   50,   62,   62,   67,  123,   68,
-       83,   69,   85,   77,   70,  122,   84,   78,   71,   86,
-       59,   79,   54,   55,   55,   66,   72,  100,  121,   55,
-       55,   55,   55,   55,   55,   67,   73,   68,   83,   69,
-       65,   77,   70,   74,   84,   78,   80,   75,   98,   79,
-       76,   81,   87,  131,   56,   88,   51,   55,   55,   55,
-       55,   55,   55,   89,   73,   99,   90,   92,  101,   82,
-       91,   74,  102,   50,   80,   75,   98,   93,   76,   81,
-       87,  131,   94,   88,   95,  112,   96,  116,  103,  113,
-       97,   89,  117,   99,   90,   92,  101,   82,   91,  114,
-
-      102,   53,  115,   57,  716,   93,   58,  132,  128,  133,
-       94,  716,   95,  112,   96,  116,  103,  113,   97,  104,
-      117,  118,  134,  105,  119,  137,  106,  114,  135,  138,
-      115,  120,   52,  107,  125,  132,  136,  133,  108,  109,
-      139,  110,  140,  111,   54,  141,   59,  104,  129,  118,
-      134,  105,  119,  137,  106,  145,  135,  138,  150,  120,
-      151,  107,  142,  143,  136,  144,  108,  109,  139,  110,
-      140,  111,  146,  141,  152,  156,  147,  126,  159,  160,
-      157,  153,  148,  145,  158,  154,  150,  161,  151,  149,
-      142,  143,  155,  144,  162,  164,  165,  163,  166,  171,
-
-      146,  174,  152,  156,  147,  167,  159,  160,  157,  153,
-      148,  175,  158,  154,  168,  161,  169,  149,  170,  172,
-      155,  176,  162,  164,  165,  163,  166,  171,  177,  174,
-      179,  185,  178,  167,  173,  716,  186,  189,  191,  175,
-      130,  130,  168,  190,  169,   53,  170,  172,  194,  176,
-      192,  180,  195,  187,  196,  197,  177,  198,  179,  185,
-      178,  188,  173,  181,  186,  189,  191,  193,  182,  183,
-      199,  190,  200,  184,  201,  202,  194,  203,  192,  180,
-      195,  187,  196,  197,  204,  198,  205,  206,   54,  188,
-       53,  181,   52,  208,  125,  193,  182,  183,  199,   58,
-
-      200,  184,  201,  202,   58,  203,   57,  209,  217,  716,
-      218,  128,  204,  223,  205,  206,  716,  219,  224,  225,
-      227,  208,  226,  716,  716,  716,  716,  228,  716,  229,
-      220,  221,  230,   54,  231,  209,  217,  126,  218,   59,
-      222,  223,  234,  716,   59,  219,  224,  225,  227,  235,
-      226,  129,  210,  211,  212,  228,  213,  229,  220,  221,
-      230,  232,  231,  236,  214,  215,  237,  238,  222,  216,
-      234,  233,  239,  240,  241,  242,  243,  235,  244,  716,
-      210,  211,  212,  716,  213,  252,  253,  254,  255,  232,
-      256,  236,  214,  215,  237,  238,  257,  216,  716,  233,
-
-      239,  240,  241,  242,  243,  260,  244,  245,  261,  262,
-      246,  247,  263,  252,  253,  254,  255,  258,  256,  259,
-      264,  265,  248,  266,  257,  249,  250,  273,  251,  267,
-      274,  716,  275,  260,  268,  245,  261,  262,  246,  247,
-      263,  269,  270,  276,  277,  258,  278,  259,  264,  265,
-      248,  266,  271,  249,  250,  273,  251,  267,  274,  272,
-      275,  279,  268,  280,  281,  282,  283,  288,  289,  269,
-      270,  276,  277,  290,  278,  284,  291,  292,  285,  293,
-      271,  286,  287,  294,  295,  296,  297,  272,  298,  279,
-      302,  280,  281,  282,  283,  288,  289,  303,  304,  305,
-
-      306,  290,  310,  284,  291,  292,  285,  293,  299,  286,
-      287,  294,  295,  296,  297,  311,  298,  312,  302,  300,
-      307,  301,  313,  314,  308,  303,  304,  305,  306,  315,
-      310,  316,  317,  318,  309,  319,  299,  320,  321,  322,
-      323,  324,  325,  311,  326,  312,  329,  300,  307,  301,
-      313,  314,  308,  332,  333,  334,  335,  315,  327,  316,
-      317,  318,  309,  319,  328,  320,  321,  322,  323,  324,
-      325,  330,  326,  336,  329,  337,  338,  331,  339,  340,
-      341,  332,  333,  334,  335,  342,  327,  344,  345,  343,
-      346,  347,  328,  349,  350,  348,  354,  355,  351,  330,
-
-      356,  336,  357,  337,  338,  331,  339,  340,  341,  352,
-      353,  358,  361,  342,  362,  344,  345,  343,  346,  347,
-      363,  349,  350,  348,  354,  355,  351,  364,  356,  359,
-      357,  365,  360,  366,  367,  368,  369,  352,  353,  358,
-      361,  370,  362,  371,  372,  373,  374,  375,  363,  376,
-      377,  378,  379,  380,  381,  364,  382,  359,  383,  365,
-      360,  366,  367,  368,  369,  384,  385,  386,  387,  370,
-      388,  371,  372,  373,  374,  375,  389,  376,  377,  378,
-      379,  380,  381,  390,  382,  393,  383,  391,  394,  395,
-      396,  397,  398,  384,  385,  386,  387,  392,  388,  399,
-
-      400,  401,  402,  403,  389,  404,  405,  406,  407,  408,
-      409,  390,  410,  393,  411,  391,  394,  395,  396,  397,
-      398,  412,  413,  414,  415,  392,  416,  399,  400,  401,
-      402,  403,  417,  404,  405,  406,  407,  408,  409,  418,
-      410,  419,  411,  420,  421,  422,  423,  424,  425,  412,
-      413,  414,  415,  427,  416,  428,  429,  430,  426,  431,
-      417,  432,  433,  434,  435,  436,  437,  418,  438,  419,
-      439,  420,  421,  422,  423,  424,  425,  440,  441,  442,
-      443,  427,  444,  428,  429,  430,  426,  431,  445,  432,
-      433,  434,  435,  436,  437,  447,  438,  448,  439,  449,
-
-      450,  451,  452,  453,  446,  440,  441,  442,  443,  454,
-      444,  455,  456,  457,  458,  459,  445,  460,  461,  462,
-      463,  464,  465,  447,  466,  448,  467,  449,  450,  451,
-      452,  453,  446,  468,  469,  470,  471,  454,  472,  455,
-      456,  457,  458,  459,  473,  460,  461,  462,  463,  464,
-      465,  474,  466,  475,  467,  476,  477,  478,  479,  480,
-      481,  468,  469,  470,  471,  482,  472,  483,  484,  485,
-      487,  488,  473,  489,  490,  486,  491,  492,  493,  474,
-      494,  475,  495,  476,  477,  478,  479,  480,  481,  496,
-      497,  498,  499,  482,  500,  483,  484,  485,  487,  488,
-
-      503,  489,  490,  486,  491,  492,  493,  501,  494,  504,
-      495,  505,  506,  507,  508,  509,  510,  496,  497,  498,
-      499,  511,  500,  512,  513,  502,  514,  515,  503,  516,
-      517,  518,  519,  520,  521,  501,  522,  504,  523,  505,
-      506,  507,  508,  509,  510,  524,  525,  526,  527,  511,
-      528,  512,  513,  502,  514,  515,  529,  516,  517,  518,
-      519,  520,  521,  530,  522,  531,  523,  532,  533,  534,
-      535,  536,  537,  524,  525,  526,  527,  538,  528,  539,
-      540,  541,  542,  543,  529,  544,  545,  546,  547,  548,
-      549,  530,  550,  531,  551,  532,  533,  534,  535,  536,
-
-      537,  552,  553,  554,  555,  538,  556,  539,  540,  541,
-      542,  543,  557,  544,  545,  546,  547,  548,  549,  558,
-      550,  559,  551,  560,  561,  562,  563,  564,  565,  552,
-      553,  554,  555,  566,  556,  567,  568,  569,  570,  571,
-      557,  573,  572,  574,  575,  576,  577,  558,  580,  559,
-      581,  560,  561,  562,  563,  564,  565,  582,  583,  584,
-      585,  566,  578,  567,  568,  569,  570,  571,  586,  573,
-      572,  574,  575,  576,  577,  579,  580,  587,  581,  588,
-      589,  590,  591,  592,  593,  582,  583,  584,  585,  594,
-      578,  595,  596,  597,  598,  599,  586,  600,  601,  602,
-
-      603,  604,  605,  579,  606,  587,  607,  588,  589,  590,
-      591,  592,  593,  608,  609,  610,  611,  594,  612,  595,
-      596,  597,  598,  599,  613,  600,  601,  602,  603,  604,
-      605,  614,  606,  615,  607,  616,  617,  618,  619,  620,
-      621,  608,  609,  610,  611,  622,  612,  623,  624,  625,
-      626,  627,  613,  628,  629,  630,  631,  632,  633,  614,
-      634,  615,  635,  616,  617,  618,  619,  620,  621,  636,
-      637,  638,  639,  622,  640,  623,  624,  625,  626,  627,
-      641,  628,  629,  630,  631,  632,  633,  642,  634,  643,
-      635,  644,  645,  646,  647,  648,  649,  636,  637,  638,
-
-      639,  650,  640,  651,  652,  653,  654,  655,  641,  656,
-      657,  658,  659,  660,  661,  642,  662,  643,  663,  644,
-      645,  646,  647,  648,  649,  664,  665,  666,  667,  650,
-      668,  651,  652,  653,  654,  655,  669,  656,  657,  658,
-      659,  660,  661,  670,  662,  671,  663,  672,  673,  674,
-      675,  676,  677,  664,  665,  666,  667,  678,  668,  679,
-      680,  681,  682,  683,  669,  684,  685,  686,  687,  688,
-      689,  670,  690,  671,  691,  672,  673,  674,  675,  676,
-      677,  692,  693,  694,  695,  678,  696,  679,  680,  681,
-      682,  683,  697,  684,  685,  686,  687,  688,  689,  698,
-
-      690,  699,  691,  700,  701,  702,  703,  704,  705,  692,
-      693,  694,  695,  706,  696,  707,  708,  709,  710,  711,
-      697,  712,  713,  714,  715,  716,  716,  698,  716,  699,
-      716,  700,  701,  702,  703,  704,  705,  716,  716,  716,
-      716,  706,  716,  707,  708,  709,  710,  711,  716,  712,
-      713,  714,  715,   46,   46,   52,   52,   57,   57,  124,
-      124,  127,  127,    5,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716
+       16,   17,   18,    6,   19,   20,   20,   21,    6,    6,
+        5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+       15,   16,   17,   18,    6,   19,   20,   20,   21,    6,
+        6,    5,   22,   22,   23,   24,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,    5,   22,   22,   23,   24,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,    5,   26,   26,   26,   26,   27,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+
+       26,   26,   26,   28,    5,   31,   31,   31,   31,   31,
+       31,   31,   32,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   33,    5,   26,   26,   26,   26,
+       27,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   28,    5,   26,   26,   26,
+       26,   36,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   28,    5,   31,   31,
+       31,   31,   31,   31,   31,   32,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   33,    5,   31,
+       31,   31,   31,   31,   31,   31,   37,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   33,    5,
+       26,   26,   26,   26,   27,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   28,
+        5,   31,   31,   31,   31,   31,   31,   31,   32,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       33,    5,    6,    5,    0,    7,    5,    6,    6,   25,
+        5,    0,    0,   35,    6,    6,    0,    6,    6,    0,
+        6,    6,    5,    6,    0,    0,    0,    0,    6,    6,
+        0,    0,    0,    0,    0,    6,    6,    0,   29,   29,
+        0,   29,    6,    5,    6,    0,    0,    0,    0,    6,
+
+        6,    0,    0,    0,    0,    0,    6,    6,    0,   30,
+        6,    0,    6,    6,    5,    6,    0,    0,    0,    0,
+        6,    6,    0,    0,    0,    0,    0,    6,    6,    0,
+       20,   20,    0,    6,    6,    5,    6,    0,    0,    0,
+        0,    6,    6,    0,    0,    0,    0,    0,    6,   34,
+        0,   20,   20,    0,    6,    6,    5,    6,    0,    0,
+        0,    0,    6,    6,    0,    0,    0,    0,    0,    6,
+        6,    0,   29,   29,    0,   29,    6,    5,    6,    0,
+        0,    0,    0,    6,    6,    0,    0,    0,    0,    0,
+        6,    6,    0,   30,    6,    0,    6,    6,    5,    6,
+
+        0,    0,    0,    0,    6,    6,    0,    0,    0,    0,
+        0,    6,    6,    0,   38,   38,    0,    6,    6,    5,
+        6,    0,    0,    0,    0,    6,    6,    0,    0,    0,
+        0,    0,    6,    6,    0,   38,   38,    0,    6,    6,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,    0
     } ;
 
-static const flex_int16_t yy_chk[1540] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+static const flex_int16_t yy_chk[463] =
+    {   1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    3,    3,    4,    4,   10,
-       13,   18,   18,   20,   31,   20,   20,   22,   22,  718,
-       26,   32,   60,  122,   60,   60,   56,   25,   26,   38,
-
-       44,   61,   61,   62,   50,   62,   62,   25,   48,   25,
-       30,   25,   31,   28,   25,   45,   30,   28,   26,   32,
-       13,   28,   10,   11,   11,   25,   26,   38,   44,   11,
-       11,   11,   11,   11,   11,   25,   27,   25,   30,   25,
-       24,   28,   25,   27,   30,   28,   29,   27,   37,   28,
-       27,   29,   33,   66,   12,   33,    9,   11,   11,   11,
-       11,   11,   11,   33,   27,   37,   34,   35,   39,   29,
-       34,   27,   39,    7,   29,   27,   37,   35,   27,   29,
-       33,   66,   36,   33,   36,   41,   36,   42,   39,   41,
-       36,   33,   42,   37,   34,   35,   39,   29,   34,   41,
-
-       39,   52,   41,   59,    5,   35,   57,   67,   59,   68,
-       36,    0,   36,   41,   36,   42,   39,   41,   36,   40,
-       42,   43,   69,   40,   43,   71,   40,   41,   70,   72,
-       41,   43,   54,   40,   54,   67,   70,   68,   40,   40,
-       73,   40,   74,   40,   52,   75,   57,   40,   59,   43,
-       69,   40,   43,   71,   40,   77,   70,   72,   79,   43,
-       80,   40,   76,   76,   70,   76,   40,   40,   73,   40,
-       74,   40,   78,   75,   81,   83,   78,   54,   85,   86,
-       84,   82,   78,   77,   84,   82,   79,   87,   80,   78,
-       76,   76,   82,   76,   89,   90,   91,   89,   92,   94,
-
-       78,   97,   81,   83,   78,   93,   85,   86,   84,   82,
-       78,   98,   84,   82,   93,   87,   93,   78,   93,   95,
-       82,   99,   89,   90,   91,   89,   92,   94,  100,   97,
-      101,  103,  100,   93,   95,    0,  104,  106,  107,   98,
-      130,  130,   93,  106,   93,  124,   93,   95,  109,   99,
-      108,  102,  110,  105,  111,  112,  100,  113,  101,  103,
-      100,  105,   95,  102,  104,  106,  107,  108,  102,  102,
-      114,  106,  115,  102,  116,  117,  109,  118,  108,  102,
-      110,  105,  111,  112,  119,  113,  120,  121,  124,  105,
-      125,  102,  126,  131,  126,  108,  102,  102,  114,  127,
-
-      115,  102,  116,  117,  128,  118,  129,  134,  136,    0,
-      137,  129,  119,  140,  120,  121,    0,  138,  141,  142,
-      143,  131,  142,    0,    0,    0,    0,  144,    0,  145,
-      138,  138,  146,  125,  147,  134,  136,  126,  137,  127,
-      138,  140,  149,    0,  128,  138,  141,  142,  143,  150,
-      142,  129,  135,  135,  135,  144,  135,  145,  138,  138,
-      146,  148,  147,  151,  135,  135,  152,  153,  138,  135,
-      149,  148,  154,  154,  155,  156,  157,  150,  158,    0,
-      135,  135,  135,    0,  135,  160,  161,  162,  163,  148,
-      164,  151,  135,  135,  152,  153,  165,  135,    0,  148,
-
-      154,  154,  155,  156,  157,  167,  158,  159,  168,  169,
-      159,  159,  171,  160,  161,  162,  163,  166,  164,  166,
-      172,  173,  159,  174,  165,  159,  159,  177,  159,  175,
-      178,    0,  179,  167,  175,  159,  168,  169,  159,  159,
-      171,  175,  176,  180,  181,  166,  182,  166,  172,  173,
-      159,  174,  176,  159,  159,  177,  159,  175,  178,  176,
-      179,  183,  175,  184,  186,  187,  188,  189,  190,  175,
-      176,  180,  181,  191,  182,  188,  192,  193,  188,  194,
-      176,  188,  188,  195,  196,  197,  198,  176,  199,  183,
-      201,  184,  186,  187,  188,  189,  190,  202,  203,  204,
-
-      205,  191,  208,  188,  192,  193,  188,  194,  200,  188,
-      188,  195,  196,  197,  198,  209,  199,  210,  201,  200,
-      207,  200,  211,  212,  207,  202,  203,  204,  205,  213,
-      208,  214,  215,  216,  207,  217,  200,  219,  220,  221,
-      222,  223,  224,  209,  225,  210,  227,  200,  207,  200,
-      211,  212,  207,  229,  230,  231,  232,  213,  226,  214,
-      215,  216,  207,  217,  226,  219,  220,  221,  222,  223,
-      224,  228,  225,  233,  227,  236,  237,  228,  238,  239,
-      241,  229,  230,  231,  232,  242,  226,  243,  244,  242,
-      245,  246,  226,  247,  248,  246,  250,  251,  249,  228,
-
-      253,  233,  254,  236,  237,  228,  238,  239,  241,  249,
-      249,  255,  257,  242,  258,  243,  244,  242,  245,  246,
-      259,  247,  248,  246,  250,  251,  249,  260,  253,  256,
-      254,  261,  256,  262,  263,  264,  265,  249,  249,  255,
-      257,  266,  258,  267,  268,  269,  270,  271,  259,  272,
-      273,  274,  275,  276,  277,  260,  278,  256,  279,  261,
-      256,  262,  263,  264,  265,  282,  283,  284,  285,  266,
-      286,  267,  268,  269,  270,  271,  287,  272,  273,  274,
-      275,  276,  277,  288,  278,  290,  279,  289,  291,  292,
-      293,  294,  295,  282,  283,  284,  285,  289,  286,  296,
-
-      297,  298,  299,  300,  287,  302,  304,  305,  306,  307,
-      308,  288,  309,  290,  311,  289,  291,  292,  293,  294,
-      295,  312,  313,  314,  314,  289,  315,  296,  297,  298,
-      299,  300,  316,  302,  304,  305,  306,  307,  308,  317,
-      309,  318,  311,  319,  320,  321,  323,  324,  325,  312,
-      313,  314,  314,  326,  315,  327,  328,  329,  325,  330,
-      316,  331,  332,  334,  335,  336,  337,  317,  338,  318,
-      339,  319,  320,  321,  323,  324,  325,  340,  341,  342,
-      345,  326,  346,  327,  328,  329,  325,  330,  347,  331,
-      332,  334,  335,  336,  337,  348,  338,  349,  339,  350,
-
-      351,  352,  353,  354,  347,  340,  341,  342,  345,  355,
-      346,  356,  357,  359,  360,  361,  347,  362,  363,  364,
-      365,  367,  368,  348,  369,  349,  370,  350,  351,  352,
-      353,  354,  347,  371,  372,  373,  374,  355,  375,  356,
-      357,  359,  360,  361,  376,  362,  363,  364,  365,  367,
-      368,  377,  369,  380,  370,  381,  382,  383,  384,  385,
-      386,  371,  372,  373,  374,  387,  375,  388,  389,  390,
-      391,  392,  376,  393,  394,  390,  395,  396,  397,  377,
-      398,  380,  399,  381,  382,  383,  384,  385,  386,  400,
-      401,  403,  405,  387,  407,  388,  389,  390,  391,  392,
-
-      409,  393,  394,  390,  395,  396,  397,  408,  398,  410,
-      399,  412,  413,  415,  416,  417,  418,  400,  401,  403,
-      405,  419,  407,  420,  424,  408,  425,  426,  409,  427,
-      428,  429,  430,  431,  432,  408,  433,  410,  434,  412,
-      413,  415,  416,  417,  418,  436,  437,  439,  441,  419,
-      442,  420,  424,  408,  425,  426,  443,  427,  428,  429,
-      430,  431,  432,  444,  433,  445,  434,  446,  447,  449,
-      450,  451,  453,  436,  437,  439,  441,  454,  442,  455,
-      456,  457,  458,  459,  443,  460,  461,  462,  463,  464,
-      465,  444,  466,  445,  467,  446,  447,  449,  450,  451,
-
-      453,  468,  469,  470,  471,  454,  473,  455,  456,  457,
-      458,  459,  474,  460,  461,  462,  463,  464,  465,  477,
-      466,  478,  467,  480,  481,  482,  483,  484,  485,  468,
-      469,  470,  471,  486,  473,  487,  488,  490,  493,  494,
-      474,  496,  494,  497,  498,  499,  500,  477,  502,  478,
-      503,  480,  481,  482,  483,  484,  485,  504,  506,  509,
-      510,  486,  501,  487,  488,  490,  493,  494,  511,  496,
-      494,  497,  498,  499,  500,  501,  502,  514,  503,  515,
-      517,  518,  520,  522,  527,  504,  506,  509,  510,  528,
-      501,  530,  531,  532,  533,  534,  511,  536,  537,  538,
-
-      539,  541,  547,  501,  549,  514,  550,  515,  517,  518,
-      520,  522,  527,  551,  552,  553,  555,  528,  557,  530,
-      531,  532,  533,  534,  558,  536,  537,  538,  539,  541,
-      547,  560,  549,  561,  550,  562,  563,  564,  565,  566,
-      567,  551,  552,  553,  555,  568,  557,  570,  571,  572,
-      573,  574,  558,  575,  578,  579,  580,  582,  583,  560,
-      584,  561,  585,  562,  563,  564,  565,  566,  567,  586,
-      587,  588,  590,  568,  591,  570,  571,  572,  573,  574,
-      593,  575,  578,  579,  580,  582,  583,  595,  584,  596,
-      585,  597,  598,  599,  601,  602,  604,  586,  587,  588,
-
-      590,  605,  591,  606,  611,  612,  614,  616,  593,  618,
-      619,  620,  621,  622,  623,  595,  624,  596,  625,  597,
-      598,  599,  601,  602,  604,  628,  629,  630,  631,  605,
-      632,  606,  611,  612,  614,  616,  635,  618,  619,  620,
-      621,  622,  623,  637,  624,  638,  625,  639,  641,  643,
-      645,  646,  647,  628,  629,  630,  631,  648,  632,  649,
-      650,  651,  653,  654,  635,  655,  656,  658,  660,  661,
-      664,  637,  665,  638,  668,  639,  641,  643,  645,  646,
-      647,  671,  672,  674,  675,  648,  676,  649,  650,  651,
-      653,  654,  677,  655,  656,  658,  660,  661,  664,  681,
-
-      665,  682,  668,  683,  684,  685,  687,  692,  694,  671,
-      672,  674,  675,  695,  676,  698,  699,  700,  703,  704,
-      677,  705,  709,  712,  713,    0,    0,  681,    0,  682,
-        0,  683,  684,  685,  687,  692,  694,    0,    0,    0,
-        0,  695,    0,  698,  699,  700,  703,  704,    0,  705,
-      709,  712,  713,  717,  717,  719,  719,  720,  720,  721,
-      721,  722,  722,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  716,  716,  716
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+
+       10,   10,   10,   10,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   33,   33,
+       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+
+       33,   33,   33,   33,   33,   33,   33,   33,   33,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,    6,    6,    7,    0,    7,    9,    6,    6,    9,
+       24,    0,    0,   24,    6,    6,    0,    6,    6,    0,
+        6,    6,   11,   11,    0,    0,    0,    0,   11,   11,
+        0,    0,    0,    0,    0,   11,   11,    0,   11,   11,
+        0,   11,   11,   12,   12,    0,    0,    0,    0,   12,
+
+       12,    0,    0,    0,    0,    0,   12,   12,    0,   12,
+       12,    0,   12,   12,   18,   18,    0,    0,    0,    0,
+       18,   18,    0,    0,    0,    0,    0,   18,   18,    0,
+       18,   18,    0,   18,   18,   20,   20,    0,    0,    0,
+        0,   20,   20,    0,    0,    0,    0,    0,   20,   20,
+        0,   20,   20,    0,   20,   20,   29,   29,    0,    0,
+        0,    0,   29,   29,    0,    0,    0,    0,    0,   29,
+       29,    0,   29,   29,    0,   29,   29,   30,   30,    0,
+        0,    0,    0,   30,   30,    0,    0,    0,    0,    0,
+       30,   30,    0,   30,   30,    0,   30,   30,   34,   34,
+
+        0,    0,    0,    0,   34,   34,    0,    0,    0,    0,
+        0,   34,   34,    0,   34,   34,    0,   34,   34,   38,
+       38,    0,    0,    0,    0,   38,   38,    0,    0,    0,
+        0,    0,   38,   38,    0,   38,   38,    0,   38,   38,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,    0
     } ;
-
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
  */
@@ -1019,7 +549,11 @@ static const flex_int16_t yy_chk[1540] =
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
 #include "args.h"
+#include "check.h"
 #include "error.h"
+#include "eval.h"
+#include "image.h"
+#include "init.h"
 #include "parser.h"
 #include "types.h"
 #include "resource.h"
@@ -1028,18 +562,24 @@ static const flex_int16_t yy_chk[1540] =
 #include <stdlib.h>
 
 static FILE *script;
+static const char *source;
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* strduptr(const char *str) - Duplicate string and translate escape characters according to the Installer V42.6 guide                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 static char *strduptr(const char *str);
-#line 1036 "<stdout>"
-#line 28 "../src/lexer.l"
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+/* keyword(const char *str, size_t len) - Get the token of a built-in function or option, 0 if 'str' isn't a keyword                                                                    */
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+static int keyword(const char *str, size_t len);
+#line 576 "<stdout>"
+#line 38 "../src/lexer.l"
     /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
     /* We need the parser to be reentrant, not because we want to, but because it will will leak memory otherwise.                                                                      */
     /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-#line 1042 "<stdout>"
+#line 582 "<stdout>"
 
 #define INITIAL 0
 #define comment 1
@@ -1314,12 +854,12 @@ YY_DECL
 		}
 
 	{
-#line 34 "../src/lexer.l"
+#line 44 "../src/lexer.l"
 
     /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
     /* Decimal numbers                                                                                                                                                                  */
     /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-#line 1322 "<stdout>"
+#line 862 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1346,13 +886,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 717 )
+				if ( yy_current_state >= 40 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 1464 );
+		while ( yy_base[yy_current_state] != 441 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1378,824 +918,164 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 38 "../src/lexer.l"
+#line 48 "../src/lexer.l"
 {
     yylval->n = (int32_t) strtoul(yytext, NULL, 10);
     return INT;
 }
 	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Hexadecimal numbers                                                                                                                                                              */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 case 2:
 YY_RULE_SETUP
-#line 46 "../src/lexer.l"
+#line 56 "../src/lexer.l"
 {
     yylval->n = (int32_t) strtoul(yytext + 1, NULL, 16);
     return HEX;
 }
 	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Binary numbers                                                                                                                                                                   */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 case 3:
 YY_RULE_SETUP
-#line 54 "../src/lexer.l"
+#line 64 "../src/lexer.l"
 {
     yylval->n = (int32_t) strtoul(yytext + 1, NULL, 2);
     return BIN;
 }
 	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Syntactic markers                                                                                                                                                                */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 case 4:
 YY_RULE_SETUP
-#line 62 "../src/lexer.l"
+#line 72 "../src/lexer.l"
 { return '(';            }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 63 "../src/lexer.l"
+#line 73 "../src/lexer.l"
 { return ')';            }
 	YY_BREAK
-/*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-/* Built-in functions and options                                                                                                                                                   */
-/*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 case 6:
 YY_RULE_SETUP
-#line 68 "../src/lexer.l"
-{ return '=';            }
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 69 "../src/lexer.l"
-{ return '<';            }
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 70 "../src/lexer.l"
-{ return LTE;            }
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 71 "../src/lexer.l"
-{ return '>';            }
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 72 "../src/lexer.l"
-{ return GTE;            }
-	YY_BREAK
-case 11:
-YY_RULE_SETUP
-#line 73 "../src/lexer.l"
-{ return NEQ;            }
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
 #line 74 "../src/lexer.l"
 { return '+';            }
 	YY_BREAK
-case 13:
+case 7:
 YY_RULE_SETUP
 #line 75 "../src/lexer.l"
-{ return '-';            }
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 76 "../src/lexer.l"
 { return '*';            }
 	YY_BREAK
-case 15:
+case 8:
 YY_RULE_SETUP
-#line 77 "../src/lexer.l"
+#line 76 "../src/lexer.l"
 { return '/';            }
 	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 78 "../src/lexer.l"
-{ return AND;            }
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 79 "../src/lexer.l"
-{ return OR;             }
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 80 "../src/lexer.l"
-{ return XOR;            }
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 81 "../src/lexer.l"
-{ return NOT;            }
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 82 "../src/lexer.l"
-{ return BITAND;         }
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 83 "../src/lexer.l"
-{ return BITOR;          }
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 84 "../src/lexer.l"
-{ return BITXOR;         }
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 85 "../src/lexer.l"
-{ return BITNOT;         }
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 86 "../src/lexer.l"
-{ return SHIFTLEFT;      }
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 87 "../src/lexer.l"
-{ return SHIFTRIGHT;     }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 88 "../src/lexer.l"
-{ return IN;             }
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 89 "../src/lexer.l"
-{ return SET;            }
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 90 "../src/lexer.l"
-{ return DCL;            }
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 91 "../src/lexer.l"
-{ return IF;             }
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 92 "../src/lexer.l"
-{ return WHILE;          }
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 93 "../src/lexer.l"
-{ return UNTIL;          }
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 94 "../src/lexer.l"
-{ return TRACE;          }
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 95 "../src/lexer.l"
-{ return RETRACE;        }
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 96 "../src/lexer.l"
-{ return STRLEN;         }
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 97 "../src/lexer.l"
-{ return SUBSTR;         }
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 98 "../src/lexer.l"
-{ return ASKDIR;         }
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 99 "../src/lexer.l"
-{ return ASKFILE;        }
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 100 "../src/lexer.l"
-{ return ASKSTRING;      }
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 101 "../src/lexer.l"
-{ return ASKNUMBER;      }
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 102 "../src/lexer.l"
-{ return ASKCHOICE;      }
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 103 "../src/lexer.l"
-{ return ASKOPTIONS;     }
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 104 "../src/lexer.l"
-{ return ASKBOOL;        }
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 105 "../src/lexer.l"
-{ return ASKDISK;        }
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 106 "../src/lexer.l"
-{ return CAT;            }
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 107 "../src/lexer.l"
-{ return EXISTS;         }
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 108 "../src/lexer.l"
-{ return EXPANDPATH;     }
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 109 "../src/lexer.l"
-{ return EARLIER;        }
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 110 "../src/lexer.l"
-{ return FILEONLY;       }
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 111 "../src/lexer.l"
-{ return GETASSIGN;      }
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 112 "../src/lexer.l"
-{ return GETDEVICE;      }
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 113 "../src/lexer.l"
-{ return GETDISKSPACE;   }
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 114 "../src/lexer.l"
-{ return GETENV;         }
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 115 "../src/lexer.l"
-{ return GETSIZE;        }
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 116 "../src/lexer.l"
-{ return GETSUM;         }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 117 "../src/lexer.l"
-{ return GETVERSION;     }
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 118 "../src/lexer.l"
-{ return ICONINFO;       }
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 119 "../src/lexer.l"
-{ return QUERYDISPLAY;   }
-	YY_BREAK
-case 58:
-YY_RULE_SETUP
-#line 120 "../src/lexer.l"
-{ return PATHONLY;       }
-	YY_BREAK
-case 59:
-YY_RULE_SETUP
-#line 121 "../src/lexer.l"
-{ return PATMATCH;       }
-	YY_BREAK
-case 60:
-YY_RULE_SETUP
-#line 122 "../src/lexer.l"
-{ return SELECT;         }
-	YY_BREAK
-case 61:
-YY_RULE_SETUP
-#line 123 "../src/lexer.l"
-{ return SYMBOLSET;      }
-	YY_BREAK
-case 62:
-YY_RULE_SETUP
-#line 124 "../src/lexer.l"
-{ return SYMBOLVAL;      }
-	YY_BREAK
-case 63:
-YY_RULE_SETUP
-#line 125 "../src/lexer.l"
-{ return TACKON;         }
-	YY_BREAK
-case 64:
-YY_RULE_SETUP
-#line 126 "../src/lexer.l"
-{ return TRANSCRIPT;     }
-	YY_BREAK
-case 65:
-YY_RULE_SETUP
-#line 127 "../src/lexer.l"
-{ return COMPLETE;       }
-	YY_BREAK
-case 66:
-YY_RULE_SETUP
-#line 128 "../src/lexer.l"
-{ return CLOSEMEDIA;     }
-	YY_BREAK
-case 67:
-YY_RULE_SETUP
-#line 129 "../src/lexer.l"
-{ return EFFECT;         }
-	YY_BREAK
-case 68:
-YY_RULE_SETUP
-#line 130 "../src/lexer.l"
-{ return SETMEDIA;       }
-	YY_BREAK
-case 69:
-YY_RULE_SETUP
-#line 131 "../src/lexer.l"
-{ return SHOWMEDIA;      }
-	YY_BREAK
-case 70:
-YY_RULE_SETUP
-#line 132 "../src/lexer.l"
-{ return USER;           }
-	YY_BREAK
-case 71:
-YY_RULE_SETUP
-#line 133 "../src/lexer.l"
-{ return WORKING;        }
-	YY_BREAK
-case 72:
-YY_RULE_SETUP
-#line 134 "../src/lexer.l"
-{ return WELCOME;        }
-	YY_BREAK
-case 73:
-YY_RULE_SETUP
-#line 135 "../src/lexer.l"
-{ return ABORT;          }
-	YY_BREAK
-case 74:
-YY_RULE_SETUP
-#line 136 "../src/lexer.l"
-{ return COPYFILES;      }
-	YY_BREAK
-case 75:
-YY_RULE_SETUP
-#line 137 "../src/lexer.l"
-{ return COPYLIB;        }
-	YY_BREAK
-case 76:
-YY_RULE_SETUP
-#line 138 "../src/lexer.l"
-{ return DATABASE;       }
-	YY_BREAK
-case 77:
-YY_RULE_SETUP
-#line 139 "../src/lexer.l"
-{ return DEBUG;          }
-	YY_BREAK
-case 78:
-YY_RULE_SETUP
-#line 140 "../src/lexer.l"
-{ return DELETE;         }
-	YY_BREAK
-case 79:
-YY_RULE_SETUP
-#line 141 "../src/lexer.l"
-{ return EXECUTE;        }
-	YY_BREAK
-case 80:
-YY_RULE_SETUP
-#line 142 "../src/lexer.l"
-{ return EXIT;           }
-	YY_BREAK
-case 81:
-YY_RULE_SETUP
-#line 143 "../src/lexer.l"
-{ return FOREACH;        }
-	YY_BREAK
-case 82:
-YY_RULE_SETUP
-#line 144 "../src/lexer.l"
-{ return MAKEASSIGN;     }
-	YY_BREAK
-case 83:
-YY_RULE_SETUP
-#line 145 "../src/lexer.l"
-{ return MAKEDIR;        }
-	YY_BREAK
-case 84:
-YY_RULE_SETUP
-#line 146 "../src/lexer.l"
-{ return MESSAGE;        }
-	YY_BREAK
-case 85:
-YY_RULE_SETUP
-#line 147 "../src/lexer.l"
-{ return ONERROR;        }
-	YY_BREAK
-case 86:
-YY_RULE_SETUP
-#line 148 "../src/lexer.l"
-{ return PROTECT;        }
-	YY_BREAK
-case 87:
-YY_RULE_SETUP
-#line 149 "../src/lexer.l"
-{ return RENAME;         }
-	YY_BREAK
-case 88:
-YY_RULE_SETUP
-#line 150 "../src/lexer.l"
-{ return REXX;           }
-	YY_BREAK
-case 89:
-YY_RULE_SETUP
-#line 151 "../src/lexer.l"
-{ return RUN;            }
-	YY_BREAK
-case 90:
-YY_RULE_SETUP
-#line 152 "../src/lexer.l"
-{ return STARTUP;        }
-	YY_BREAK
-case 91:
-YY_RULE_SETUP
-#line 153 "../src/lexer.l"
-{ return TEXTFILE;       }
-	YY_BREAK
-case 92:
-YY_RULE_SETUP
-#line 154 "../src/lexer.l"
-{ return TOOLTYPE;       }
-	YY_BREAK
-case 93:
-YY_RULE_SETUP
-#line 155 "../src/lexer.l"
-{ return TRAP;           }
-	YY_BREAK
-case 94:
-YY_RULE_SETUP
-#line 156 "../src/lexer.l"
-{ return REBOOT;         }
-	YY_BREAK
-case 95:
-YY_RULE_SETUP
-#line 157 "../src/lexer.l"
-{ return OPENWBOBJECT;   }
-	YY_BREAK
-case 96:
-YY_RULE_SETUP
-#line 158 "../src/lexer.l"
-{ return SHOWWBOBJECT;   }
-	YY_BREAK
-case 97:
-YY_RULE_SETUP
-#line 159 "../src/lexer.l"
-{ return CLOSEWBOBJECT;  }
-	YY_BREAK
-case 98:
-YY_RULE_SETUP
-#line 160 "../src/lexer.l"
-{ return ALL;            }
-	YY_BREAK
-case 99:
-YY_RULE_SETUP
-#line 161 "../src/lexer.l"
-{ return APPEND;         }
-	YY_BREAK
-case 100:
-YY_RULE_SETUP
-#line 162 "../src/lexer.l"
-{ return ASSIGNS;        }
-	YY_BREAK
-case 101:
-YY_RULE_SETUP
-#line 163 "../src/lexer.l"
-{ return BACK;           }
-	YY_BREAK
-case 102:
-YY_RULE_SETUP
-#line 164 "../src/lexer.l"
-{ return CHOICES;        }
-	YY_BREAK
-case 103:
-YY_RULE_SETUP
-#line 165 "../src/lexer.l"
-{ return COMMAND;        }
-	YY_BREAK
-case 104:
-YY_RULE_SETUP
-#line 166 "../src/lexer.l"
-{ return COMPRESSION;    }
-	YY_BREAK
-case 105:
-YY_RULE_SETUP
-#line 167 "../src/lexer.l"
-{ return CONFIRM;        }
-	YY_BREAK
-case 106:
-YY_RULE_SETUP
-#line 168 "../src/lexer.l"
-{ return DEFAULT;        }
-	YY_BREAK
-case 107:
-YY_RULE_SETUP
-#line 169 "../src/lexer.l"
-{ return DELOPTS;        }
-	YY_BREAK
-case 108:
-YY_RULE_SETUP
-#line 170 "../src/lexer.l"
-{ return DEST;           }
-	YY_BREAK
-case 109:
-YY_RULE_SETUP
-#line 171 "../src/lexer.l"
-{ return DISK;           }
-	YY_BREAK
-case 110:
-YY_RULE_SETUP
-#line 172 "../src/lexer.l"
-{ return FILES;          }
-	YY_BREAK
-case 111:
-YY_RULE_SETUP
-#line 173 "../src/lexer.l"
-{ return FONTS;          }
-	YY_BREAK
-case 112:
-YY_RULE_SETUP
-#line 174 "../src/lexer.l"
-{ return GETDEFAULTTOOL; }
-	YY_BREAK
-case 113:
-YY_RULE_SETUP
-#line 175 "../src/lexer.l"
-{ return GETPOSITION;    }
-	YY_BREAK
-case 114:
-YY_RULE_SETUP
-#line 176 "../src/lexer.l"
-{ return GETSTACK;       }
-	YY_BREAK
-case 115:
-YY_RULE_SETUP
-#line 177 "../src/lexer.l"
-{ return GETTOOLTYPE;    }
-	YY_BREAK
-case 116:
-YY_RULE_SETUP
-#line 178 "../src/lexer.l"
-{ return HELP;           }
-	YY_BREAK
-case 117:
-YY_RULE_SETUP
-#line 179 "../src/lexer.l"
-{ return INFOS;          }
-	YY_BREAK
-case 118:
-YY_RULE_SETUP
-#line 180 "../src/lexer.l"
-{ return INCLUDE;        }
-	YY_BREAK
-case 119:
-YY_RULE_SETUP
-#line 181 "../src/lexer.l"
-{ return NEWNAME;        }
-	YY_BREAK
-case 120:
-YY_RULE_SETUP
-#line 182 "../src/lexer.l"
-{ return NEWPATH;        }
-	YY_BREAK
-case 121:
-YY_RULE_SETUP
-#line 183 "../src/lexer.l"
-{ return NOGAUGE;        }
-	YY_BREAK
-case 122:
-YY_RULE_SETUP
-#line 184 "../src/lexer.l"
-{ return NOPOSITION;     }
-	YY_BREAK
-case 123:
-YY_RULE_SETUP
-#line 185 "../src/lexer.l"
-{ return NOREQ;          }
-	YY_BREAK
-case 124:
-YY_RULE_SETUP
-#line 186 "../src/lexer.l"
-{ return OPTIONAL;       }
-	YY_BREAK
-case 125:
-YY_RULE_SETUP
-#line 187 "../src/lexer.l"
-{ return OVERRIDE;       }
-	YY_BREAK
-case 126:
-YY_RULE_SETUP
-#line 188 "../src/lexer.l"
-{ return PATTERN;        }
-	YY_BREAK
-case 127:
-YY_RULE_SETUP
-#line 189 "../src/lexer.l"
-{ return PROMPT;         }
-	YY_BREAK
-case 128:
-YY_RULE_SETUP
-#line 190 "../src/lexer.l"
-{ return QUIET;          }
-	YY_BREAK
-case 129:
-YY_RULE_SETUP
-#line 191 "../src/lexer.l"
-{ return RANGE;          }
-	YY_BREAK
-case 130:
-YY_RULE_SETUP
-#line 192 "../src/lexer.l"
-{ return RESIDENT;       }
-	YY_BREAK
-case 131:
-YY_RULE_SETUP
-#line 193 "../src/lexer.l"
-{ return SAFE;           }
-	YY_BREAK
-case 132:
-YY_RULE_SETUP
-#line 194 "../src/lexer.l"
-{ return SETDEFAULTTOOL; }
-	YY_BREAK
-case 133:
-YY_RULE_SETUP
-#line 195 "../src/lexer.l"
-{ return SETSTACK;       }
-	YY_BREAK
-case 134:
-YY_RULE_SETUP
-#line 196 "../src/lexer.l"
-{ return SETTOOLTYPE;    }
-	YY_BREAK
-case 135:
-YY_RULE_SETUP
-#line 197 "../src/lexer.l"
-{ return SETPOSITION;    }
-	YY_BREAK
-case 136:
-YY_RULE_SETUP
-#line 198 "../src/lexer.l"
-{ return SOURCE;         }
-	YY_BREAK
-case 137:
-YY_RULE_SETUP
-#line 199 "../src/lexer.l"
-{ return SWAPCOLORS;     }
-	YY_BREAK
-case 138:
-YY_RULE_SETUP
-#line 200 "../src/lexer.l"
-{ return ASTRAW;         }
-	YY_BREAK
-case 139:
-YY_RULE_SETUP
-#line 201 "../src/lexer.l"
-{ return ASBRAW;         }
-	YY_BREAK
-case 140:
-YY_RULE_SETUP
-#line 202 "../src/lexer.l"
-{ return ASBEVAL;        }
-	YY_BREAK
-case 141:
-YY_RULE_SETUP
-#line 203 "../src/lexer.l"
-{ return EVAL;           }
-	YY_BREAK
-case 142:
-YY_RULE_SETUP
-#line 204 "../src/lexer.l"
-{ return OPTIONS;        }
-	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Strings                                                                                                                                                                          */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-case 143:
-/* rule 143 can match eol */
-#line 210 "../src/lexer.l"
-case 144:
-/* rule 144 can match eol */
+case 9:
+/* rule 9 can match eol */
+#line 82 "../src/lexer.l"
+case 10:
+/* rule 10 can match eol */
 YY_RULE_SETUP
-#line 210 "../src/lexer.l"
+#line 82 "../src/lexer.l"
 {
     yylval->s = strduptr(yytext);
     return yylval->s ? STR : OOM;
 }
 	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-/* Symbols                                                                                                                                                                          */
+/* Symbols - Built-in functions and options are symbols too, keywords are told apart from other symbols by keyword()                                                                */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-case 145:
+case 11:
 YY_RULE_SETUP
-#line 218 "../src/lexer.l"
+#line 90 "../src/lexer.l"
 {
+    int tok = keyword(yytext, yyleng);
+
+    if(tok)
+    {
+        return tok;
+    }
+
     yylval->s = strdup(yytext);
     return yylval->s ? SYM : OOM;
 }
 	YY_BREAK
+
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* The bottom feeders - Amiga / Unix, Windows and MacOS <= V9 support                                                                                                               */
 /*----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-case 146:
-/* rule 146 can match eol */
+case 12:
+/* rule 12 can match eol */
 YY_RULE_SETUP
-#line 226 "../src/lexer.l"
+#line 105 "../src/lexer.l"
 { yylineno++;                                   }
 	YY_BREAK
-case 147:
-/* rule 147 can match eol */
+case 13:
+/* rule 13 can match eol */
 YY_RULE_SETUP
-#line 227 "../src/lexer.l"
+#line 106 "../src/lexer.l"
 { yylineno++;                                   }
 	YY_BREAK
-case 148:
+case 14:
 YY_RULE_SETUP
-#line 228 "../src/lexer.l"
+#line 107 "../src/lexer.l"
 { yylineno++;                                   }
 	YY_BREAK
-case 149:
+case 15:
 YY_RULE_SETUP
-#line 229 "../src/lexer.l"
+#line 108 "../src/lexer.l"
 {                                               }
 	YY_BREAK
-case 150:
+case 16:
 YY_RULE_SETUP
-#line 230 "../src/lexer.l"
+#line 109 "../src/lexer.l"
 { BEGIN(comment);                               }
 	YY_BREAK
-case 151:
-/* rule 151 can match eol */
+case 17:
+/* rule 17 can match eol */
 YY_RULE_SETUP
-#line 231 "../src/lexer.l"
+#line 110 "../src/lexer.l"
 { BEGIN(INITIAL); yylineno++;                   }
 	YY_BREAK
-case 152:
-/* rule 152 can match eol */
+case 18:
+/* rule 18 can match eol */
 YY_RULE_SETUP
-#line 232 "../src/lexer.l"
+#line 111 "../src/lexer.l"
 { BEGIN(INITIAL); yylineno++;                   }
 	YY_BREAK
-case 153:
+case 19:
 YY_RULE_SETUP
-#line 233 "../src/lexer.l"
+#line 112 "../src/lexer.l"
 { BEGIN(INITIAL); yylineno++;                   }
 	YY_BREAK
-case 154:
+case 20:
 YY_RULE_SETUP
-#line 234 "../src/lexer.l"
+#line 113 "../src/lexer.l"
 {                                               }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(comment):
-#line 235 "../src/lexer.l"
+#line 114 "../src/lexer.l"
 { fclose(script); script = NULL; yyterminate(); }
 	YY_BREAK
-case 155:
+case 21:
 YY_RULE_SETUP
-#line 236 "../src/lexer.l"
+#line 115 "../src/lexer.l"
 ECHO;
 	YY_BREAK
-#line 2198 "<stdout>"
+#line 1078 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2492,7 +1372,7 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 717 )
+			if ( yy_current_state >= 40 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2521,11 +1401,11 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 717 )
+		if ( yy_current_state >= 40 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 716);
+	yy_is_jam = (yy_current_state == 39);
 
 	(void)yyg;
 	return yy_is_jam ? 0 : yy_current_state;
@@ -3374,7 +2254,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 236 "../src/lexer.l"
+#line 115 "../src/lexer.l"
 
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
@@ -3386,9 +2266,14 @@ int yyerror(yyscan_t scanner, const char *err)
     int line = yyget_lineno(scanner);
     const char *info = yyget_text(scanner);
 
+    // One line per error, 'script:line: error', when checking the syntax.
+    if(arg_get(ARG_CHECK))
+    {
+        printf("%s:%d: %s '%s'\n", source, line, err, info);
+    }
     // Print to stderr if we're executing from shell, show dialogue if we're
     // executing from WB.
-    if(arg_argc(-1))
+    else if(arg_argc(-1))
     {
         // All details to stderr.
         fprintf(stderr, tr(S_SYNT), line, err, info);
@@ -3404,6 +2289,49 @@ int yyerror(yyscan_t scanner, const char *err)
     return line;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+/* parse(const char *name) - Parse script, the rest is up to the start symbol destructor. 0 on success, 1 on syntax error, 2 if out of memory and -1 if the script can't be read        */
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+int parse(const char *name)
+{
+    yyscan_t lexer;
+
+    // Allocate and initialize reentrant lexer.
+    if(yylex_init(&lexer))
+    {
+        // We most likely ran out of memory.
+        fprintf(stderr, "%s\n", tr(S_UNER));
+        return 2;
+    }
+
+    // Assume failure.
+    int ret = -1;
+
+    // Name used in error messages.
+    source = name;
+    script = fopen(name, "r");
+
+    if(script)
+    {
+        // Set input file and parse.
+        yyset_in(script, lexer);
+
+        // 1 on syntax error, 0 on success.
+        ret = yyparse(lexer);
+
+        // Input is still open if the parser returns before EOF.
+        if(script)
+        {
+            fclose(script);
+            script = NULL;
+        }
+    }
+
+    // Free all resources allocated by the lexer.
+    yylex_destroy(lexer);
+    return ret;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Main                                                                                                                                                                                 */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
@@ -3425,48 +2353,41 @@ int main(int argc, char **argv)
     if(arg_init(argc, argv))
 #endif
     {
-        yyscan_t lexer;
+        // Get script name from CLI or tooltypes / WB.
+        char *name = arg_get(ARG_SCRIPT);
 
-        // Allocate and initialize reentrant lexer.
-        if(yylex_init(&lexer) == 0)
-        {
-            // Get script name from CLI or tooltypes / WB.
-            char *name = arg_get(ARG_SCRIPT);
-            script = fopen(name, "r");
+        // Disable stderr buffering (VBCC quirk).
+        setvbuf(stderr, NULL, _IONBF, 0);
 
-            // Disable stderr buffering (VBCC quirk).
-            setvbuf(stderr, NULL, _IONBF, 0);
+        // Check the syntax of any number of scripts without executing them.
+        if(arg_get(ARG_CHECK))
+        {
+            ret = chk_run(arg_batch());
+        }
+        else
+        {
+            // Use precompiled image if there is one, no need to parse anything.
+            entry_p image = img_load(name);
 
-            if(script)
+            if(image)
             {
-                // Set input file and parse.
-                yyset_in(script, lexer);
-
-                // 1 on syntax error, 0 on success.
-                ret = yyparse(lexer);
-
-                // Input is still open if the parser returns before EOF.
-                if(script)
-                {
-                    fclose(script);
-                }
+                // Same as the start symbol destructor in the parser.
+                run(init(image));
+                ret = 0;
             }
-            else
+            // 1 on syntax error, 0 on success.
+            else if((ret = parse(name)) < 0)
             {
                 // We can't read from the file.
                 fprintf(stderr, tr(S_CNOF), name);
             }
-
-            // Free all resources allocated by the lexer.
-            yylex_destroy(lexer);
-        }
-        else
-        {
-            // We most likely ran out of memory.
-            fprintf(stderr, "%s\n", tr(S_UNER));
         }
     }
 
+#ifndef AMIGA
+    // Ignore errors on non Amiga systems, unless we're checking the syntax.
+    ret = arg_get(ARG_CHECK) ? ret : 0;
+#endif
     // Free all resources allocated by the argument handling routines.
     // This must be done even if arg_init() fails.
     arg_done();
@@ -3475,8 +2396,7 @@ int main(int argc, char **argv)
     // error is an ERROR and file not found / readable a FAIL.
     return (!ret ? ret : (ret == 1 ? RETURN_ERROR : RETURN_FAIL));
 #else
-    // Ignore errors on non Amiga systems.
-    return 0;
+    return ret;
 #endif
 }
 
@@ -3594,3 +2514,227 @@ static char *strduptr(const char *str)
     return out;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+/* Built-in functions and options. Run build/keywords.sh and replace kwd_seed and kwd_slot with the output whenever this list is changed                                                */
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+static const struct
+{
+    const char *name;
+    int token;
+} kwd_lst[] =
+{
+    { "=",                   '='            },
+    { "<",                   '<'            },
+    { "<=",                  LTE            },
+    { ">",                   '>'            },
+    { ">=",                  GTE            },
+    { "<>",                  NEQ            },
+    { "-",                   '-'            },
+    { "and",                 AND            },
+    { "or",                  OR             },
+    { "xor",                 XOR            },
+    { "not",                 NOT            },
+    { "bitand",              BITAND         },
+    { "bitor",               BITOR          },
+    { "bitxor",              BITXOR         },
+    { "bitnot",              BITNOT         },
+    { "shiftleft",           SHIFTLEFT      },
+    { "shiftright",          SHIFTRIGHT     },
+    { "in",                  IN             },
+    { "set",                 SET            },
+    { "procedure",           DCL            },
+    { "if",                  IF             },
+    { "while",               WHILE          },
+    { "until",               UNTIL          },
+    { "trace",               TRACE          },
+    { "retrace",             RETRACE        },
+    { "strlen",              STRLEN         },
+    { "substr",              SUBSTR         },
+    { "askdir",              ASKDIR         },
+    { "askfile",             ASKFILE        },
+    { "askstring",           ASKSTRING      },
+    { "asknumber",           ASKNUMBER      },
+    { "askchoice",           ASKCHOICE      },
+    { "askoptions",          ASKOPTIONS     },
+    { "askbool",             ASKBOOL        },
+    { "askdisk",             ASKDISK        },
+    { "cat",                 CAT            },
+    { "exists",              EXISTS         },
+    { "expandpath",          EXPANDPATH     },
+    { "earlier",             EARLIER        },
+    { "fileonly",            FILEONLY       },
+    { "getassign",           GETASSIGN      },
+    { "getdevice",           GETDEVICE      },
+    { "getdiskspace",        GETDISKSPACE   },
+    { "getenv",              GETENV         },
+    { "getsize",             GETSIZE        },
+    { "getsum",              GETSUM         },
+    { "getversion",          GETVERSION     },
+    { "iconinfo",            ICONINFO       },
+    { "querydisplay",        QUERYDISPLAY   },
+    { "pathonly",            PATHONLY       },
+    { "patmatch",            PATMATCH       },
+    { "select",              SELECT         },
+    { "symbolset",           SYMBOLSET      },
+    { "symbolval",           SYMBOLVAL      },
+    { "tackon",              TACKON         },
+    { "transcript",          TRANSCRIPT     },
+    { "complete",            COMPLETE       },
+    { "closemedia",          CLOSEMEDIA     },
+    { "effect",              EFFECT         },
+    { "setmedia",            SETMEDIA       },
+    { "showmedia",           SHOWMEDIA      },
+    { "user",                USER           },
+    { "working",             WORKING        },
+    { "welcome",             WELCOME        },
+    { "abort",               ABORT          },
+    { "copyfiles",           COPYFILES      },
+    { "copylib",             COPYLIB        },
+    { "database",            DATABASE       },
+    { "debug",               DEBUG          },
+    { "delete",              DELETE         },
+    { "execute",             EXECUTE        },
+    { "exit",                EXIT           },
+    { "foreach",             FOREACH        },
+    { "makeassign",          MAKEASSIGN     },
+    { "makedir",             MAKEDIR        },
+    { "message",             MESSAGE        },
+    { "onerror",             ONERROR        },
+    { "protect",             PROTECT        },
+    { "rename",              RENAME         },
+    { "rexx",                REXX           },
+    { "run",                 RUN            },
+    { "startup",             STARTUP        },
+    { "textfile",            TEXTFILE       },
+    { "tooltype",            TOOLTYPE       },
+    { "trap",                TRAP           },
+    { "reboot",              REBOOT         },
+    { "openwbobject",        OPENWBOBJECT   },
+    { "showwbobject",        SHOWWBOBJECT   },
+    { "closewbobject",       CLOSEWBOBJECT  },
+    { "all",                 ALL            },
+    { "append",              APPEND         },
+    { "assigns",             ASSIGNS        },
+    { "back",                BACK           },
+    { "choices",             CHOICES        },
+    { "command",             COMMAND        },
+    { "compression",         COMPRESSION    },
+    { "confirm",             CONFIRM        },
+    { "default",             DEFAULT        },
+    { "delopts",             DELOPTS        },
+    { "dest",                DEST           },
+    { "disk",                DISK           },
+    { "files",               FILES          },
+    { "fonts",               FONTS          },
+    { "getdefaulttool",      GETDEFAULTTOOL },
+    { "getposition",         GETPOSITION    },
+    { "getstack",            GETSTACK       },
+    { "gettooltype",         GETTOOLTYPE    },
+    { "help",                HELP           },
+    { "infos",               INFOS          },
+    { "include",             INCLUDE        },
+    { "newname",             NEWNAME        },
+    { "newpath",             NEWPATH        },
+    { "nogauge",             NOGAUGE        },
+    { "noposition",          NOPOSITION     },
+    { "noreq",               NOREQ          },
+    { "optional",            OPTIONAL       },
+    { "override",            OVERRIDE       },
+    { "pattern",             PATTERN        },
+    { "prompt",              PROMPT         },
+    { "quiet",               QUIET          },
+    { "range",               RANGE          },
+    { "resident",            RESIDENT       },
+    { "safe",                SAFE           },
+    { "setdefaulttool",      SETDEFAULTTOOL },
+    { "setstack",            SETSTACK       },
+    { "settooltype",         SETTOOLTYPE    },
+    { "setposition",         SETPOSITION    },
+    { "source",              SOURCE         },
+    { "swapcolors",          SWAPCOLORS     },
+    { "___astraw",           ASTRAW         },
+    { "___asbraw",           ASBRAW         },
+    { "___asbeval",          ASBEVAL        },
+    { "___eval",             EVAL           },
+    { "___options",          OPTIONS        }
+};
+
+static const uint8_t kwd_seed[32] =
+{
+      7,   4,   5,   1,   7,   3,   2,   4,  13,   2,   2,  18,   4,   1,   1,   3,
+      2,   2,   3,   4,   1,   1,   5,   1,   3,   2,   2,  14,   2,   1,   2,   1
+};
+static const uint8_t kwd_slot[256] =
+{
+     10,   0,   0,  42,   0,   0,   0, 108,   0,  44,   0,   0,   0, 116,  16,   0,
+      0,   5,   0, 125,  36, 134,   0, 119,   0,  56,   0,   0,  82,   0,  89,  53,
+    118,   0,   0, 104,   0,   0,   0,   0, 127,   0,  38,   0,  45,   0,  73,  26,
+     19,  66,  46, 121,   0,   0,   0,   0,  49,   0,   0,  14,  27,   2,   0,   0,
+      0,   0,   8,  84,   0,  52,   0,  92,   3,  54,   0,   0,   0, 128,  60,   0,
+      0,  33,   0,   0,   0,   1,  21, 115,  11,  99,  35,   0,   0,   0,  98,  95,
+      0, 106,   0, 105,  47,   0,  85,  34,   0,  18, 120,  80,  65,   0,  59,   0,
+      0, 129,   0,   0,   0,  78,  40,   0,   0, 117,   0,   0,  32,  28,  90, 131,
+      0,   0,   0,   0,   0,   0,   6,  96,  69,   0,  63,   0,  83,   0,  86,   0,
+     48, 107,  61,  15,  91,  57,   0,   0,   0,  20,   0, 124,  97,   0, 100,  75,
+      0,   0,   0,   0,   0,  55,   0,   0,   0,  64,  29,  70,  94,   0, 113,  12,
+      0,   0,  24,  50, 103,  22,   0,   0,  37,   0,   0,  62,   0,   0,  13,   0,
+     25,   0,  79,  23,  74,   0, 102,   0,   0,  58,  68,  77,   0,  43,   0,   0,
+      0,  31, 110,   0,  30,   0,   0, 133,  93,  72,  51,   0, 111,   9, 112,   0,
+      0,   0, 126,   0,   0,   7,  71, 132,   0,   0,   0,  39,   0, 109,   0,   4,
+     67,   0,  88, 101,  76, 114,   0, 123,   0, 130,  17,   0,  41, 122,  87,  81
+};
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+/* kwdhash(const char *str, size_t len) - Case insensitive FNV-1a hash                                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+static uint32_t kwdhash(const char *str, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    // Same as tolower() for letters. Other characters may be folded as well,
+    // which is fine, keyword() confirms every hit with an exact comparison.
+    while(len--)
+    {
+        hash ^= (uint8_t) (*str++ | 0x20);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+/* keyword(const char *str, size_t len) - Get the token of a built-in function or option, 0 if 'str' isn't a keyword                                                                    */
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+static int keyword(const char *str, size_t len)
+{
+    // The hash picks the seed. The seeded hash, multiplied by the golden ratio
+    // and with the top 8 bits used as index, picks the slot, which is unique
+    // for every keyword. Anything else will end up in a slot that is either
+    // empty or belongs to some other keyword.
+    uint32_t hash = kwdhash(str, len);
+    uint32_t seed = kwd_seed[hash % (sizeof(kwd_seed) / sizeof(kwd_seed[0]))];
+    size_t ndx = kwd_slot[(uint32_t) ((hash ^ seed) * 2654435761u) >> 24];
+
+    if(!ndx)
+    {
+        // Not a keyword.
+        return 0;
+    }
+
+    const char *name = kwd_lst[ndx - 1].name;
+
+    // Keywords are in lower case. Only ASCII letters are folded, just like
+    // flex does. Symbols may contain NUL, don't stop until 'len' is reached.
+    for(size_t i = 0; i < len; i++)
+    {
+        char chr = (str[i] >= 'A' && str[i] <= 'Z') ? (char) (str[i] | 0x20) : str[i];
+
+        if(!name[i] || chr != name[i])
+        {
+            return 0;
+        }
+    }
+
+    return name[len] ? 0 : kwd_lst[ndx - 1].token;
+}
+
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2019 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -88,7 +89,7 @@
 // Always debug.
 #define YYDEBUG 1
 
-#line 92 "parser.c"
+#line 93 "parser.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -111,182 +112,329 @@
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_PARSER_H_INCLUDED
-# define YY_YY_PARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SYM = 258,
-    STR = 259,
-    OOM = 260,
-    INT = 261,
-    HEX = 262,
-    BIN = 263,
-    EQ = 264,
-    GT = 265,
-    GTE = 266,
-    LT = 267,
-    LTE = 268,
-    NEQ = 269,
-    IF = 270,
-    SELECT = 271,
-    UNTIL = 272,
-    WHILE = 273,
-    TRACE = 274,
-    RETRACE = 275,
-    ASTRAW = 276,
-    ASBRAW = 277,
-    ASBEVAL = 278,
-    EVAL = 279,
-    OPTIONS = 280,
-    EXECUTE = 281,
-    REXX = 282,
-    RUN = 283,
-    ABORT = 284,
-    EXIT = 285,
-    ONERROR = 286,
-    TRAP = 287,
-    REBOOT = 288,
-    COPYFILES = 289,
-    COPYLIB = 290,
-    DELETE = 291,
-    EXISTS = 292,
-    FILEONLY = 293,
-    FOREACH = 294,
-    MAKEASSIGN = 295,
-    MAKEDIR = 296,
-    PROTECT = 297,
-    STARTUP = 298,
-    TEXTFILE = 299,
-    TOOLTYPE = 300,
-    TRANSCRIPT = 301,
-    RENAME = 302,
-    COMPLETE = 303,
-    DEBUG = 304,
-    MESSAGE = 305,
-    USER = 306,
-    WELCOME = 307,
-    WORKING = 308,
-    AND = 309,
-    BITAND = 310,
-    BITNOT = 311,
-    BITOR = 312,
-    BITXOR = 313,
-    NOT = 314,
-    IN = 315,
-    OR = 316,
-    SHIFTLEFT = 317,
-    SHIFTRIGHT = 318,
-    XOR = 319,
-    CLOSEMEDIA = 320,
-    EFFECT = 321,
-    SETMEDIA = 322,
-    SHOWMEDIA = 323,
-    DATABASE = 324,
-    EARLIER = 325,
-    GETASSIGN = 326,
-    GETDEVICE = 327,
-    GETDISKSPACE = 328,
-    GETENV = 329,
-    GETSIZE = 330,
-    GETSUM = 331,
-    GETVERSION = 332,
-    ICONINFO = 333,
-    QUERYDISPLAY = 334,
-    CUS = 335,
-    DCL = 336,
-    ASKBOOL = 337,
-    ASKCHOICE = 338,
-    ASKDIR = 339,
-    ASKDISK = 340,
-    ASKFILE = 341,
-    ASKNUMBER = 342,
-    ASKOPTIONS = 343,
-    ASKSTRING = 344,
-    CAT = 345,
-    EXPANDPATH = 346,
-    FMT = 347,
-    PATHONLY = 348,
-    PATMATCH = 349,
-    STRLEN = 350,
-    SUBSTR = 351,
-    TACKON = 352,
-    SET = 353,
-    SYMBOLSET = 354,
-    SYMBOLVAL = 355,
-    OPENWBOBJECT = 356,
-    SHOWWBOBJECT = 357,
-    CLOSEWBOBJECT = 358,
-    ALL = 359,
-    APPEND = 360,
-    ASSIGNS = 361,
-    BACK = 362,
-    CHOICES = 363,
-    COMMAND = 364,
-    COMPRESSION = 365,
-    CONFIRM = 366,
-    DEFAULT = 367,
-    DELOPTS = 368,
-    DEST = 369,
-    DISK = 370,
-    FILES = 371,
-    FONTS = 372,
-    GETDEFAULTTOOL = 373,
-    GETPOSITION = 374,
-    GETSTACK = 375,
-    GETTOOLTYPE = 376,
-    HELP = 377,
-    INFOS = 378,
-    INCLUDE = 379,
-    NEWNAME = 380,
-    NEWPATH = 381,
-    NOGAUGE = 382,
-    NOPOSITION = 383,
-    NOREQ = 384,
-    PATTERN = 385,
-    PROMPT = 386,
-    QUIET = 387,
-    RANGE = 388,
-    SAFE = 389,
-    SETDEFAULTTOOL = 390,
-    SETPOSITION = 391,
-    SETSTACK = 392,
-    SETTOOLTYPE = 393,
-    SOURCE = 394,
-    SWAPCOLORS = 395,
-    OPTIONAL = 396,
-    RESIDENT = 397,
-    OVERRIDE = 398
-  };
-#endif
-
-/* Value type.  */
-
-
-
-int yyparse (yyscan_t scanner);
+#include "parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SYM = 3,                        /* SYM  */
+  YYSYMBOL_STR = 4,                        /* STR  */
+  YYSYMBOL_OOM = 5,                        /* OOM  */
+  YYSYMBOL_INT = 6,                        /* INT  */
+  YYSYMBOL_HEX = 7,                        /* HEX  */
+  YYSYMBOL_BIN = 8,                        /* BIN  */
+  YYSYMBOL_EQ = 9,                         /* EQ  */
+  YYSYMBOL_GT = 10,                        /* GT  */
+  YYSYMBOL_GTE = 11,                       /* GTE  */
+  YYSYMBOL_LT = 12,                        /* LT  */
+  YYSYMBOL_LTE = 13,                       /* LTE  */
+  YYSYMBOL_NEQ = 14,                       /* NEQ  */
+  YYSYMBOL_IF = 15,                        /* IF  */
+  YYSYMBOL_SELECT = 16,                    /* SELECT  */
+  YYSYMBOL_UNTIL = 17,                     /* UNTIL  */
+  YYSYMBOL_WHILE = 18,                     /* WHILE  */
+  YYSYMBOL_TRACE = 19,                     /* TRACE  */
+  YYSYMBOL_RETRACE = 20,                   /* RETRACE  */
+  YYSYMBOL_ASTRAW = 21,                    /* ASTRAW  */
+  YYSYMBOL_ASBRAW = 22,                    /* ASBRAW  */
+  YYSYMBOL_ASBEVAL = 23,                   /* ASBEVAL  */
+  YYSYMBOL_EVAL = 24,                      /* EVAL  */
+  YYSYMBOL_OPTIONS = 25,                   /* OPTIONS  */
+  YYSYMBOL_EXECUTE = 26,                   /* EXECUTE  */
+  YYSYMBOL_REXX = 27,                      /* REXX  */
+  YYSYMBOL_RUN = 28,                       /* RUN  */
+  YYSYMBOL_ABORT = 29,                     /* ABORT  */
+  YYSYMBOL_EXIT = 30,                      /* EXIT  */
+  YYSYMBOL_ONERROR = 31,                   /* ONERROR  */
+  YYSYMBOL_TRAP = 32,                      /* TRAP  */
+  YYSYMBOL_REBOOT = 33,                    /* REBOOT  */
+  YYSYMBOL_COPYFILES = 34,                 /* COPYFILES  */
+  YYSYMBOL_COPYLIB = 35,                   /* COPYLIB  */
+  YYSYMBOL_DELETE = 36,                    /* DELETE  */
+  YYSYMBOL_EXISTS = 37,                    /* EXISTS  */
+  YYSYMBOL_FILEONLY = 38,                  /* FILEONLY  */
+  YYSYMBOL_FOREACH = 39,                   /* FOREACH  */
+  YYSYMBOL_MAKEASSIGN = 40,                /* MAKEASSIGN  */
+  YYSYMBOL_MAKEDIR = 41,                   /* MAKEDIR  */
+  YYSYMBOL_PROTECT = 42,                   /* PROTECT  */
+  YYSYMBOL_STARTUP = 43,                   /* STARTUP  */
+  YYSYMBOL_TEXTFILE = 44,                  /* TEXTFILE  */
+  YYSYMBOL_TOOLTYPE = 45,                  /* TOOLTYPE  */
+  YYSYMBOL_TRANSCRIPT = 46,                /* TRANSCRIPT  */
+  YYSYMBOL_RENAME = 47,                    /* RENAME  */
+  YYSYMBOL_COMPLETE = 48,                  /* COMPLETE  */
+  YYSYMBOL_DEBUG = 49,                     /* DEBUG  */
+  YYSYMBOL_MESSAGE = 50,                   /* MESSAGE  */
+  YYSYMBOL_USER = 51,                      /* USER  */
+  YYSYMBOL_WELCOME = 52,                   /* WELCOME  */
+  YYSYMBOL_WORKING = 53,                   /* WORKING  */
+  YYSYMBOL_AND = 54,                       /* AND  */
+  YYSYMBOL_BITAND = 55,                    /* BITAND  */
+  YYSYMBOL_BITNOT = 56,                    /* BITNOT  */
+  YYSYMBOL_BITOR = 57,                     /* BITOR  */
+  YYSYMBOL_BITXOR = 58,                    /* BITXOR  */
+  YYSYMBOL_NOT = 59,                       /* NOT  */
+  YYSYMBOL_IN = 60,                        /* IN  */
+  YYSYMBOL_OR = 61,                        /* OR  */
+  YYSYMBOL_SHIFTLEFT = 62,                 /* SHIFTLEFT  */
+  YYSYMBOL_SHIFTRIGHT = 63,                /* SHIFTRIGHT  */
+  YYSYMBOL_XOR = 64,                       /* XOR  */
+  YYSYMBOL_CLOSEMEDIA = 65,                /* CLOSEMEDIA  */
+  YYSYMBOL_EFFECT = 66,                    /* EFFECT  */
+  YYSYMBOL_SETMEDIA = 67,                  /* SETMEDIA  */
+  YYSYMBOL_SHOWMEDIA = 68,                 /* SHOWMEDIA  */
+  YYSYMBOL_DATABASE = 69,                  /* DATABASE  */
+  YYSYMBOL_EARLIER = 70,                   /* EARLIER  */
+  YYSYMBOL_GETASSIGN = 71,                 /* GETASSIGN  */
+  YYSYMBOL_GETDEVICE = 72,                 /* GETDEVICE  */
+  YYSYMBOL_GETDISKSPACE = 73,              /* GETDISKSPACE  */
+  YYSYMBOL_GETENV = 74,                    /* GETENV  */
+  YYSYMBOL_GETSIZE = 75,                   /* GETSIZE  */
+  YYSYMBOL_GETSUM = 76,                    /* GETSUM  */
+  YYSYMBOL_GETVERSION = 77,                /* GETVERSION  */
+  YYSYMBOL_ICONINFO = 78,                  /* ICONINFO  */
+  YYSYMBOL_QUERYDISPLAY = 79,              /* QUERYDISPLAY  */
+  YYSYMBOL_CUS = 80,                       /* CUS  */
+  YYSYMBOL_DCL = 81,                       /* DCL  */
+  YYSYMBOL_ASKBOOL = 82,                   /* ASKBOOL  */
+  YYSYMBOL_ASKCHOICE = 83,                 /* ASKCHOICE  */
+  YYSYMBOL_ASKDIR = 84,                    /* ASKDIR  */
+  YYSYMBOL_ASKDISK = 85,                   /* ASKDISK  */
+  YYSYMBOL_ASKFILE = 86,                   /* ASKFILE  */
+  YYSYMBOL_ASKNUMBER = 87,                 /* ASKNUMBER  */
+  YYSYMBOL_ASKOPTIONS = 88,                /* ASKOPTIONS  */
+  YYSYMBOL_ASKSTRING = 89,                 /* ASKSTRING  */
+  YYSYMBOL_CAT = 90,                       /* CAT  */
+  YYSYMBOL_EXPANDPATH = 91,                /* EXPANDPATH  */
+  YYSYMBOL_FMT = 92,                       /* FMT  */
+  YYSYMBOL_PATHONLY = 93,                  /* PATHONLY  */
+  YYSYMBOL_PATMATCH = 94,                  /* PATMATCH  */
+  YYSYMBOL_STRLEN = 95,                    /* STRLEN  */
+  YYSYMBOL_SUBSTR = 96,                    /* SUBSTR  */
+  YYSYMBOL_TACKON = 97,                    /* TACKON  */
+  YYSYMBOL_SET = 98,                       /* SET  */
+  YYSYMBOL_SYMBOLSET = 99,                 /* SYMBOLSET  */
+  YYSYMBOL_SYMBOLVAL = 100,                /* SYMBOLVAL  */
+  YYSYMBOL_OPENWBOBJECT = 101,             /* OPENWBOBJECT  */
+  YYSYMBOL_SHOWWBOBJECT = 102,             /* SHOWWBOBJECT  */
+  YYSYMBOL_CLOSEWBOBJECT = 103,            /* CLOSEWBOBJECT  */
+  YYSYMBOL_ALL = 104,                      /* ALL  */
+  YYSYMBOL_APPEND = 105,                   /* APPEND  */
+  YYSYMBOL_ASSIGNS = 106,                  /* ASSIGNS  */
+  YYSYMBOL_BACK = 107,                     /* BACK  */
+  YYSYMBOL_CHOICES = 108,                  /* CHOICES  */
+  YYSYMBOL_COMMAND = 109,                  /* COMMAND  */
+  YYSYMBOL_COMPRESSION = 110,              /* COMPRESSION  */
+  YYSYMBOL_CONFIRM = 111,                  /* CONFIRM  */
+  YYSYMBOL_DEFAULT = 112,                  /* DEFAULT  */
+  YYSYMBOL_DELOPTS = 113,                  /* DELOPTS  */
+  YYSYMBOL_DEST = 114,                     /* DEST  */
+  YYSYMBOL_DISK = 115,                     /* DISK  */
+  YYSYMBOL_FILES = 116,                    /* FILES  */
+  YYSYMBOL_FONTS = 117,                    /* FONTS  */
+  YYSYMBOL_GETDEFAULTTOOL = 118,           /* GETDEFAULTTOOL  */
+  YYSYMBOL_GETPOSITION = 119,              /* GETPOSITION  */
+  YYSYMBOL_GETSTACK = 120,                 /* GETSTACK  */
+  YYSYMBOL_GETTOOLTYPE = 121,              /* GETTOOLTYPE  */
+  YYSYMBOL_HELP = 122,                     /* HELP  */
+  YYSYMBOL_INFOS = 123,                    /* INFOS  */
+  YYSYMBOL_INCLUDE = 124,                  /* INCLUDE  */
+  YYSYMBOL_NEWNAME = 125,                  /* NEWNAME  */
+  YYSYMBOL_NEWPATH = 126,                  /* NEWPATH  */
+  YYSYMBOL_NOGAUGE = 127,                  /* NOGAUGE  */
+  YYSYMBOL_NOPOSITION = 128,               /* NOPOSITION  */
+  YYSYMBOL_NOREQ = 129,                    /* NOREQ  */
+  YYSYMBOL_PATTERN = 130,                  /* PATTERN  */
+  YYSYMBOL_PROMPT = 131,                   /* PROMPT  */
+  YYSYMBOL_QUIET = 132,                    /* QUIET  */
+  YYSYMBOL_RANGE = 133,                    /* RANGE  */
+  YYSYMBOL_SAFE = 134,                     /* SAFE  */
+  YYSYMBOL_SETDEFAULTTOOL = 135,           /* SETDEFAULTTOOL  */
+  YYSYMBOL_SETPOSITION = 136,              /* SETPOSITION  */
+  YYSYMBOL_SETSTACK = 137,                 /* SETSTACK  */
+  YYSYMBOL_SETTOOLTYPE = 138,              /* SETTOOLTYPE  */
+  YYSYMBOL_SOURCE = 139,                   /* SOURCE  */
+  YYSYMBOL_SWAPCOLORS = 140,               /* SWAPCOLORS  */
+  YYSYMBOL_OPTIONAL = 141,                 /* OPTIONAL  */
+  YYSYMBOL_RESIDENT = 142,                 /* RESIDENT  */
+  YYSYMBOL_OVERRIDE = 143,                 /* OVERRIDE  */
+  YYSYMBOL_144_ = 144,                     /* '('  */
+  YYSYMBOL_145_ = 145,                     /* ')'  */
+  YYSYMBOL_146_ = 146,                     /* '+'  */
+  YYSYMBOL_147_ = 147,                     /* '/'  */
+  YYSYMBOL_148_ = 148,                     /* '*'  */
+  YYSYMBOL_149_ = 149,                     /* '-'  */
+  YYSYMBOL_150_ = 150,                     /* '='  */
+  YYSYMBOL_151_ = 151,                     /* '>'  */
+  YYSYMBOL_152_ = 152,                     /* '<'  */
+  YYSYMBOL_YYACCEPT = 153,                 /* $accept  */
+  YYSYMBOL_start = 154,                    /* start  */
+  YYSYMBOL_top = 155,                      /* top  */
+  YYSYMBOL_tps = 156,                      /* tps  */
+  YYSYMBOL_s = 157,                        /* s  */
+  YYSYMBOL_p = 158,                        /* p  */
+  YYSYMBOL_pp = 159,                       /* pp  */
+  YYSYMBOL_ps = 160,                       /* ps  */
+  YYSYMBOL_pps = 161,                      /* pps  */
+  YYSYMBOL_vp = 162,                       /* vp  */
+  YYSYMBOL_vps = 163,                      /* vps  */
+  YYSYMBOL_opts = 164,                     /* opts  */
+  YYSYMBOL_xopt = 165,                     /* xopt  */
+  YYSYMBOL_xpb = 166,                      /* xpb  */
+  YYSYMBOL_xpbs = 167,                     /* xpbs  */
+  YYSYMBOL_np = 168,                       /* np  */
+  YYSYMBOL_sps = 169,                      /* sps  */
+  YYSYMBOL_par = 170,                      /* par  */
+  YYSYMBOL_cv = 171,                       /* cv  */
+  YYSYMBOL_cvv = 172,                      /* cvv  */
+  YYSYMBOL_opt = 173,                      /* opt  */
+  YYSYMBOL_ivp = 174,                      /* ivp  */
+  YYSYMBOL_add = 175,                      /* add  */
+  YYSYMBOL_div = 176,                      /* div  */
+  YYSYMBOL_mul = 177,                      /* mul  */
+  YYSYMBOL_sub = 178,                      /* sub  */
+  YYSYMBOL_eq = 179,                       /* eq  */
+  YYSYMBOL_gt = 180,                       /* gt  */
+  YYSYMBOL_gte = 181,                      /* gte  */
+  YYSYMBOL_lt = 182,                       /* lt  */
+  YYSYMBOL_lte = 183,                      /* lte  */
+  YYSYMBOL_neq = 184,                      /* neq  */
+  YYSYMBOL_if = 185,                       /* if  */
+  YYSYMBOL_select = 186,                   /* select  */
+  YYSYMBOL_until = 187,                    /* until  */
+  YYSYMBOL_while = 188,                    /* while  */
+  YYSYMBOL_trace = 189,                    /* trace  */
+  YYSYMBOL_retrace = 190,                  /* retrace  */
+  YYSYMBOL_astraw = 191,                   /* astraw  */
+  YYSYMBOL_asbraw = 192,                   /* asbraw  */
+  YYSYMBOL_asbeval = 193,                  /* asbeval  */
+  YYSYMBOL_eval = 194,                     /* eval  */
+  YYSYMBOL_options = 195,                  /* options  */
+  YYSYMBOL_execute = 196,                  /* execute  */
+  YYSYMBOL_rexx = 197,                     /* rexx  */
+  YYSYMBOL_run = 198,                      /* run  */
+  YYSYMBOL_abort = 199,                    /* abort  */
+  YYSYMBOL_exit = 200,                     /* exit  */
+  YYSYMBOL_onerror = 201,                  /* onerror  */
+  YYSYMBOL_reboot = 202,                   /* reboot  */
+  YYSYMBOL_trap = 203,                     /* trap  */
+  YYSYMBOL_copyfiles = 204,                /* copyfiles  */
+  YYSYMBOL_copylib = 205,                  /* copylib  */
+  YYSYMBOL_delete = 206,                   /* delete  */
+  YYSYMBOL_exists = 207,                   /* exists  */
+  YYSYMBOL_fileonly = 208,                 /* fileonly  */
+  YYSYMBOL_foreach = 209,                  /* foreach  */
+  YYSYMBOL_makeassign = 210,               /* makeassign  */
+  YYSYMBOL_makedir = 211,                  /* makedir  */
+  YYSYMBOL_protect = 212,                  /* protect  */
+  YYSYMBOL_startup = 213,                  /* startup  */
+  YYSYMBOL_textfile = 214,                 /* textfile  */
+  YYSYMBOL_tooltype = 215,                 /* tooltype  */
+  YYSYMBOL_transcript = 216,               /* transcript  */
+  YYSYMBOL_rename = 217,                   /* rename  */
+  YYSYMBOL_complete = 218,                 /* complete  */
+  YYSYMBOL_debug = 219,                    /* debug  */
+  YYSYMBOL_message = 220,                  /* message  */
+  YYSYMBOL_user = 221,                     /* user  */
+  YYSYMBOL_welcome = 222,                  /* welcome  */
+  YYSYMBOL_working = 223,                  /* working  */
+  YYSYMBOL_and = 224,                      /* and  */
+  YYSYMBOL_bitand = 225,                   /* bitand  */
+  YYSYMBOL_bitnot = 226,                   /* bitnot  */
+  YYSYMBOL_bitor = 227,                    /* bitor  */
+  YYSYMBOL_bitxor = 228,                   /* bitxor  */
+  YYSYMBOL_not = 229,                      /* not  */
+  YYSYMBOL_in = 230,                       /* in  */
+  YYSYMBOL_or = 231,                       /* or  */
+  YYSYMBOL_shiftleft = 232,                /* shiftleft  */
+  YYSYMBOL_shiftright = 233,               /* shiftright  */
+  YYSYMBOL_xor = 234,                      /* xor  */
+  YYSYMBOL_closemedia = 235,               /* closemedia  */
+  YYSYMBOL_effect = 236,                   /* effect  */
+  YYSYMBOL_setmedia = 237,                 /* setmedia  */
+  YYSYMBOL_showmedia = 238,                /* showmedia  */
+  YYSYMBOL_database = 239,                 /* database  */
+  YYSYMBOL_earlier = 240,                  /* earlier  */
+  YYSYMBOL_getassign = 241,                /* getassign  */
+  YYSYMBOL_getdevice = 242,                /* getdevice  */
+  YYSYMBOL_getdiskspace = 243,             /* getdiskspace  */
+  YYSYMBOL_getenv = 244,                   /* getenv  */
+  YYSYMBOL_getsize = 245,                  /* getsize  */
+  YYSYMBOL_getsum = 246,                   /* getsum  */
+  YYSYMBOL_getversion = 247,               /* getversion  */
+  YYSYMBOL_iconinfo = 248,                 /* iconinfo  */
+  YYSYMBOL_querydisplay = 249,             /* querydisplay  */
+  YYSYMBOL_dcl = 250,                      /* dcl  */
+  YYSYMBOL_cus = 251,                      /* cus  */
+  YYSYMBOL_askbool = 252,                  /* askbool  */
+  YYSYMBOL_askchoice = 253,                /* askchoice  */
+  YYSYMBOL_askdir = 254,                   /* askdir  */
+  YYSYMBOL_askdisk = 255,                  /* askdisk  */
+  YYSYMBOL_askfile = 256,                  /* askfile  */
+  YYSYMBOL_asknumber = 257,                /* asknumber  */
+  YYSYMBOL_askoptions = 258,               /* askoptions  */
+  YYSYMBOL_askstring = 259,                /* askstring  */
+  YYSYMBOL_cat = 260,                      /* cat  */
+  YYSYMBOL_expandpath = 261,               /* expandpath  */
+  YYSYMBOL_fmt = 262,                      /* fmt  */
+  YYSYMBOL_pathonly = 263,                 /* pathonly  */
+  YYSYMBOL_patmatch = 264,                 /* patmatch  */
+  YYSYMBOL_strlen = 265,                   /* strlen  */
+  YYSYMBOL_substr = 266,                   /* substr  */
+  YYSYMBOL_tackon = 267,                   /* tackon  */
+  YYSYMBOL_set = 268,                      /* set  */
+  YYSYMBOL_symbolset = 269,                /* symbolset  */
+  YYSYMBOL_symbolval = 270,                /* symbolval  */
+  YYSYMBOL_openwbobject = 271,             /* openwbobject  */
+  YYSYMBOL_showwbobject = 272,             /* showwbobject  */
+  YYSYMBOL_closewbobject = 273,            /* closewbobject  */
+  YYSYMBOL_all = 274,                      /* all  */
+  YYSYMBOL_append = 275,                   /* append  */
+  YYSYMBOL_assigns = 276,                  /* assigns  */
+  YYSYMBOL_back = 277,                     /* back  */
+  YYSYMBOL_choices = 278,                  /* choices  */
+  YYSYMBOL_command = 279,                  /* command  */
+  YYSYMBOL_compression = 280,              /* compression  */
+  YYSYMBOL_confirm = 281,                  /* confirm  */
+  YYSYMBOL_default = 282,                  /* default  */
+  YYSYMBOL_delopts = 283,                  /* delopts  */
+  YYSYMBOL_dest = 284,                     /* dest  */
+  YYSYMBOL_disk = 285,                     /* disk  */
+  YYSYMBOL_files = 286,                    /* files  */
+  YYSYMBOL_fonts = 287,                    /* fonts  */
+  YYSYMBOL_getdefaulttool = 288,           /* getdefaulttool  */
+  YYSYMBOL_getposition = 289,              /* getposition  */
+  YYSYMBOL_getstack = 290,                 /* getstack  */
+  YYSYMBOL_gettooltype = 291,              /* gettooltype  */
+  YYSYMBOL_help = 292,                     /* help  */
+  YYSYMBOL_infos = 293,                    /* infos  */
+  YYSYMBOL_include = 294,                  /* include  */
+  YYSYMBOL_newname = 295,                  /* newname  */
+  YYSYMBOL_newpath = 296,                  /* newpath  */
+  YYSYMBOL_nogauge = 297,                  /* nogauge  */
+  YYSYMBOL_noposition = 298,               /* noposition  */
+  YYSYMBOL_noreq = 299,                    /* noreq  */
+  YYSYMBOL_pattern = 300,                  /* pattern  */
+  YYSYMBOL_prompt = 301,                   /* prompt  */
+  YYSYMBOL_quiet = 302,                    /* quiet  */
+  YYSYMBOL_range = 303,                    /* range  */
+  YYSYMBOL_safe = 304,                     /* safe  */
+  YYSYMBOL_setdefaulttool = 305,           /* setdefaulttool  */
+  YYSYMBOL_setposition = 306,              /* setposition  */
+  YYSYMBOL_setstack = 307,                 /* setstack  */
+  YYSYMBOL_settooltype = 308,              /* settooltype  */
+  YYSYMBOL_source = 309,                   /* source  */
+  YYSYMBOL_swapcolors = 310,               /* swapcolors  */
+  YYSYMBOL_optional = 311,                 /* optional  */
+  YYSYMBOL_resident = 312,                 /* resident  */
+  YYSYMBOL_override = 313,                 /* override  */
+  YYSYMBOL_dynopt = 314                    /* dynopt  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-#endif /* !YY_YY_PARSER_H_INCLUDED  */
 
 
 
@@ -327,6 +475,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -386,6 +546,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_int16 yy_state_t;
 
@@ -404,6 +565,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -422,17 +584,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -461,7 +629,7 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -526,8 +694,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -590,27 +757,29 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  291
+#define YYFINAL  292
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   2447
+#define YYLAST   2496
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  153
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  159
+#define YYNNTS  162
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  391
+#define YYNRULES  402
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  754
+#define YYNSTATES  779
 
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   398
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -659,132 +828,123 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,    87,    87,    88,    92,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,   173,
+       0,    90,    90,    91,    92,    93,    94,    95,    96,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
      174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
-     264,   265,   266,   267,   268,   269,   270,   271,   275,   276,
-     277,   278,   282,   283,   284,   285,   286,   287,   288,   289,
-     290,   291,   292,   293,   297,   298,   299,   300,   301,   302,
-     303,   304,   308,   309,   310,   311,   312,   316,   317,   318,
-     319,   320,   321,   322,   323,   324,   325,   326,   327,   331,
-     332,   333,   334,   335,   336,   337,   339,   340,   344,   345,
-     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
-     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
-     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   289,
+     290,   291,   292,   296,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   311,   312,   313,   314,   315,
+     316,   317,   318,   322,   323,   324,   325,   326,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     345,   346,   347,   348,   349,   350,   351,   353,   354,   358,
+     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
      379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
-     389,   390,   394,   395,   396,   397,   398,   399,   400,   401,
-     402,   403,   404,   408,   409,   410,   411,   412,   416,   417,
-     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
-     428,   429,   430,   431,   435,   436,   437,   438,   439,   440,
-     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
-     454,   455,   456,   460,   461,   462,   463,   464,   465,   466,
-     467,   468,   469,   473,   474,   475,   479,   480,   481,   482,
-     483,   484,   488,   489,   490,   491,   492,   493,   494,   495,
-     496,   497,   498,   499,   500,   501,   502,   503,   504,   505,
-     506,   507,   508,   509,   510,   511,   512,   513,   514,   515,
-     516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
-     526,   527,   528,   529,   530,   531,   532,   533,   534,   535,
-     536,   537
+     389,   393,   394,   395,   396,   397,   398,   399,   400,   401,
+     402,   403,   404,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   422,   423,   424,   425,   426,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   449,   450,   451,   452,   453,
+     454,   458,   459,   460,   461,   462,   463,   464,   465,   466,
+     467,   468,   469,   470,   474,   475,   476,   477,   478,   479,
+     480,   481,   482,   483,   487,   488,   489,   493,   494,   495,
+     496,   497,   498,   502,   503,   504,   505,   506,   507,   508,
+     509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
+     519,   520,   521,   522,   523,   524,   525,   526,   527,   528,
+     529,   530,   531,   532,   533,   534,   535,   536,   537,   538,
+     539,   540,   541,   542,   543,   544,   545,   546,   547,   548,
+     549,   550,   551
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SYM", "STR", "OOM", "INT", "HEX", "BIN",
-  "EQ", "GT", "GTE", "LT", "LTE", "NEQ", "IF", "SELECT", "UNTIL", "WHILE",
-  "TRACE", "RETRACE", "ASTRAW", "ASBRAW", "ASBEVAL", "EVAL", "OPTIONS",
-  "EXECUTE", "REXX", "RUN", "ABORT", "EXIT", "ONERROR", "TRAP", "REBOOT",
-  "COPYFILES", "COPYLIB", "DELETE", "EXISTS", "FILEONLY", "FOREACH",
-  "MAKEASSIGN", "MAKEDIR", "PROTECT", "STARTUP", "TEXTFILE", "TOOLTYPE",
-  "TRANSCRIPT", "RENAME", "COMPLETE", "DEBUG", "MESSAGE", "USER",
-  "WELCOME", "WORKING", "AND", "BITAND", "BITNOT", "BITOR", "BITXOR",
-  "NOT", "IN", "OR", "SHIFTLEFT", "SHIFTRIGHT", "XOR", "CLOSEMEDIA",
-  "EFFECT", "SETMEDIA", "SHOWMEDIA", "DATABASE", "EARLIER", "GETASSIGN",
-  "GETDEVICE", "GETDISKSPACE", "GETENV", "GETSIZE", "GETSUM", "GETVERSION",
-  "ICONINFO", "QUERYDISPLAY", "CUS", "DCL", "ASKBOOL", "ASKCHOICE",
-  "ASKDIR", "ASKDISK", "ASKFILE", "ASKNUMBER", "ASKOPTIONS", "ASKSTRING",
-  "CAT", "EXPANDPATH", "FMT", "PATHONLY", "PATMATCH", "STRLEN", "SUBSTR",
-  "TACKON", "SET", "SYMBOLSET", "SYMBOLVAL", "OPENWBOBJECT",
-  "SHOWWBOBJECT", "CLOSEWBOBJECT", "ALL", "APPEND", "ASSIGNS", "BACK",
-  "CHOICES", "COMMAND", "COMPRESSION", "CONFIRM", "DEFAULT", "DELOPTS",
-  "DEST", "DISK", "FILES", "FONTS", "GETDEFAULTTOOL", "GETPOSITION",
-  "GETSTACK", "GETTOOLTYPE", "HELP", "INFOS", "INCLUDE", "NEWNAME",
-  "NEWPATH", "NOGAUGE", "NOPOSITION", "NOREQ", "PATTERN", "PROMPT",
-  "QUIET", "RANGE", "SAFE", "SETDEFAULTTOOL", "SETPOSITION", "SETSTACK",
-  "SETTOOLTYPE", "SOURCE", "SWAPCOLORS", "OPTIONAL", "RESIDENT",
-  "OVERRIDE", "'('", "')'", "'+'", "'/'", "'*'", "'-'", "'='", "'>'",
-  "'<'", "$accept", "start", "s", "p", "pp", "ps", "pps", "vp", "vps",
-  "opts", "xpb", "xpbs", "np", "sps", "par", "cv", "cvv", "opt", "ivp",
-  "add", "div", "mul", "sub", "eq", "gt", "gte", "lt", "lte", "neq", "if",
-  "select", "until", "while", "trace", "retrace", "astraw", "asbraw",
-  "asbeval", "eval", "options", "execute", "rexx", "run", "abort", "exit",
-  "onerror", "reboot", "trap", "copyfiles", "copylib", "delete", "exists",
-  "fileonly", "foreach", "makeassign", "makedir", "protect", "startup",
-  "textfile", "tooltype", "transcript", "rename", "complete", "debug",
-  "message", "user", "welcome", "working", "and", "bitand", "bitnot",
-  "bitor", "bitxor", "not", "in", "or", "shiftleft", "shiftright", "xor",
-  "closemedia", "effect", "setmedia", "showmedia", "database", "earlier",
-  "getassign", "getdevice", "getdiskspace", "getenv", "getsize", "getsum",
-  "getversion", "iconinfo", "querydisplay", "dcl", "cus", "askbool",
-  "askchoice", "askdir", "askdisk", "askfile", "asknumber", "askoptions",
-  "askstring", "cat", "expandpath", "fmt", "pathonly", "patmatch",
-  "strlen", "substr", "tackon", "set", "symbolset", "symbolval",
-  "openwbobject", "showwbobject", "closewbobject", "all", "append",
-  "assigns", "back", "choices", "command", "compression", "confirm",
-  "default", "delopts", "dest", "disk", "files", "fonts", "getdefaulttool",
-  "getposition", "getstack", "gettooltype", "help", "infos", "include",
-  "newname", "newpath", "nogauge", "noposition", "noreq", "pattern",
-  "prompt", "quiet", "range", "safe", "setdefaulttool", "setposition",
-  "setstack", "settooltype", "source", "swapcolors", "optional",
-  "resident", "override", "dynopt", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "SYM", "STR", "OOM",
+  "INT", "HEX", "BIN", "EQ", "GT", "GTE", "LT", "LTE", "NEQ", "IF",
+  "SELECT", "UNTIL", "WHILE", "TRACE", "RETRACE", "ASTRAW", "ASBRAW",
+  "ASBEVAL", "EVAL", "OPTIONS", "EXECUTE", "REXX", "RUN", "ABORT", "EXIT",
+  "ONERROR", "TRAP", "REBOOT", "COPYFILES", "COPYLIB", "DELETE", "EXISTS",
+  "FILEONLY", "FOREACH", "MAKEASSIGN", "MAKEDIR", "PROTECT", "STARTUP",
+  "TEXTFILE", "TOOLTYPE", "TRANSCRIPT", "RENAME", "COMPLETE", "DEBUG",
+  "MESSAGE", "USER", "WELCOME", "WORKING", "AND", "BITAND", "BITNOT",
+  "BITOR", "BITXOR", "NOT", "IN", "OR", "SHIFTLEFT", "SHIFTRIGHT", "XOR",
+  "CLOSEMEDIA", "EFFECT", "SETMEDIA", "SHOWMEDIA", "DATABASE", "EARLIER",
+  "GETASSIGN", "GETDEVICE", "GETDISKSPACE", "GETENV", "GETSIZE", "GETSUM",
+  "GETVERSION", "ICONINFO", "QUERYDISPLAY", "CUS", "DCL", "ASKBOOL",
+  "ASKCHOICE", "ASKDIR", "ASKDISK", "ASKFILE", "ASKNUMBER", "ASKOPTIONS",
+  "ASKSTRING", "CAT", "EXPANDPATH", "FMT", "PATHONLY", "PATMATCH",
+  "STRLEN", "SUBSTR", "TACKON", "SET", "SYMBOLSET", "SYMBOLVAL",
+  "OPENWBOBJECT", "SHOWWBOBJECT", "CLOSEWBOBJECT", "ALL", "APPEND",
+  "ASSIGNS", "BACK", "CHOICES", "COMMAND", "COMPRESSION", "CONFIRM",
+  "DEFAULT", "DELOPTS", "DEST", "DISK", "FILES", "FONTS", "GETDEFAULTTOOL",
+  "GETPOSITION", "GETSTACK", "GETTOOLTYPE", "HELP", "INFOS", "INCLUDE",
+  "NEWNAME", "NEWPATH", "NOGAUGE", "NOPOSITION", "NOREQ", "PATTERN",
+  "PROMPT", "QUIET", "RANGE", "SAFE", "SETDEFAULTTOOL", "SETPOSITION",
+  "SETSTACK", "SETTOOLTYPE", "SOURCE", "SWAPCOLORS", "OPTIONAL",
+  "RESIDENT", "OVERRIDE", "'('", "')'", "'+'", "'/'", "'*'", "'-'", "'='",
+  "'>'", "'<'", "$accept", "start", "top", "tps", "s", "p", "pp", "ps",
+  "pps", "vp", "vps", "opts", "xopt", "xpb", "xpbs", "np", "sps", "par",
+  "cv", "cvv", "opt", "ivp", "add", "div", "mul", "sub", "eq", "gt", "gte",
+  "lt", "lte", "neq", "if", "select", "until", "while", "trace", "retrace",
+  "astraw", "asbraw", "asbeval", "eval", "options", "execute", "rexx",
+  "run", "abort", "exit", "onerror", "reboot", "trap", "copyfiles",
+  "copylib", "delete", "exists", "fileonly", "foreach", "makeassign",
+  "makedir", "protect", "startup", "textfile", "tooltype", "transcript",
+  "rename", "complete", "debug", "message", "user", "welcome", "working",
+  "and", "bitand", "bitnot", "bitor", "bitxor", "not", "in", "or",
+  "shiftleft", "shiftright", "xor", "closemedia", "effect", "setmedia",
+  "showmedia", "database", "earlier", "getassign", "getdevice",
+  "getdiskspace", "getenv", "getsize", "getsum", "getversion", "iconinfo",
+  "querydisplay", "dcl", "cus", "askbool", "askchoice", "askdir",
+  "askdisk", "askfile", "asknumber", "askoptions", "askstring", "cat",
+  "expandpath", "fmt", "pathonly", "patmatch", "strlen", "substr",
+  "tackon", "set", "symbolset", "symbolval", "openwbobject",
+  "showwbobject", "closewbobject", "all", "append", "assigns", "back",
+  "choices", "command", "compression", "confirm", "default", "delopts",
+  "dest", "disk", "files", "fonts", "getdefaulttool", "getposition",
+  "getstack", "gettooltype", "help", "infos", "include", "newname",
+  "newpath", "nogauge", "noposition", "noreq", "pattern", "prompt",
+  "quiet", "range", "safe", "setdefaulttool", "setposition", "setstack",
+  "settooltype", "source", "swapcolors", "optional", "resident",
+  "override", "dynopt", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,    40,    41,    43,    47,    42,    45,
-      61,    62,    60
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF (-404)
+#define YYPACT_NINF (-314)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -794,108 +954,110 @@ static const yytype_int16 yytoknum[] =
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -140,  1295,    29,  -404,  -404,  -140,  -140,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,     7,
-      13,   454,   454,   454,   454,   454,   454,   454,  -112,  -102,
-     -99,   454,   454,   454,   -96,   549,   549,   549,   454,    34,
-    -140,   454,   -79,   -67,   -67,   549,   549,   454,   454,   454,
-     549,   454,   549,   -67,   -67,   454,   454,   454,    57,   549,
-     454,    64,   108,   454,   454,   454,   454,   454,   454,   454,
-     454,   454,   454,   454,   454,   454,   454,   454,   454,   454,
-     454,   454,   454,   454,   454,   454,   118,   -67,   454,    79,
-    -122,   -67,  -113,   -67,  -109,   -91,   -67,   -89,   454,   454,
-     454,   454,   454,   454,   454,    87,   454,   454,   549,   454,
-     454,   -45,   454,   -39,  -140,   454,   454,   -37,   125,   454,
-     141,   454,   -28,    -9,    -4,   454,   454,   454,   454,   156,
-      36,   454,   454,   251,    40,    43,    46,   454,   269,    48,
-     454,    53,   454,   454,   454,   454,   454,    67,   301,    71,
-     454,   454,   454,   454,   454,   454,   454,   454,    83,   -87,
-     -71,  -404,  -140,  -140,  -140,  -140,  -404,  -404,  -404,  -404,
-    -404,  -404,  1895,  -404,  -404,   307,  -404,  -404,  -404,   320,
-     384,   102,   397,   106,   418,   115,   463,   123,   126,   575,
-    -140,  -140,  -404,  -404,  -404,   139,   146,   186,  -404,  1445,
-     469,   549,   475,   549,   482,   549,   488,  1595,  -404,   495,
-     517,   -69,  -140,  -404,  2303,   -64,   -59,   566,   549,   -56,
-     549,   188,   454,  -140,   597,   -51,   -49,   549,   639,   -46,
-     -67,   652,   -42,   -25,   806,   -10,   195,  -404,   813,   836,
-     549,   198,  -404,   856,  -404,   893,   917,   203,   207,   212,
-     221,   240,   454,   923,   252,   265,   273,   289,   454,   985,
-     454,  1013,   290,   291,  1036,   292,   293,  1094,   295,   296,
-     297,   298,  -404,    -6,     9,   302,    27,  -404,    11,    24,
-    -404,    52,    59,  -404,    61,  -404,    66,    70,  -404,    74,
-    1111,   303,   304,   305,   308,  1117,   309,   575,     5,  -404,
-    1133,   311,    86,   549,   318,   359,  -404,  1705,  -404,    88,
-    1711,  1717,  -404,  -404,  1725,   360,  -404,  1860,   361,  -404,
-    -404,  -404,   362,   364,   365,   367,  -404,  1868,  -404,   368,
-     369,  -404,   371,  -404,  -404,  -404,   382,  -404,  1877,  -404,
-     386,  -404,   387,   389,   390,  2011,   391,    90,  -404,  -404,
-    2020,  -404,   392,  2026,   393,  2146,  2154,  2169,   394,  2175,
-     398,  2195,   399,  -404,  -404,  -404,   454,    83,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  1295,  -404,
-    -404,    92,   575,  -404,  -404,  2045,  -404,  2201,    95,    98,
-    -404,  -404,  -404,   101,  -404,   105,  2207,   -67,  -404,   120,
-    2213,  -404,   122,  2219,  -404,  -404,   400,  -404,  2225,  -404,
-     134,   454,  -404,  -404,  -404,   136,  2231,  -404,   138,   402,
-    -404,   143,  1745,  -404,   403,   415,  -404,   405,  -404,   152,
-     154,  -404,   158,  -404,   174,   192,  -404,   194,  -404,  -404,
-    -404,  -404,   201,  -404,  -404,  -404,   206,  2237,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  2243,  -404,  -404,
-    -404,  -404,  -404,   413,  -404,   414,   454,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,   419,  -404,
-     420,  -404,  -404,  -404,  -404,   421,    42,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,   423,  -404,  -404,   575,  -404,  -404,  -404,  -404,  -404,
-     210,   217,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,   460,  -404,
-     430,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  2249,  2255,  -404,   219,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,   230,  -404,  -404,   232,  -404,  -404,
-     234,  -404,  -404,  -404,   -67,  -404,  -404,   238,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,   249,  -404,  -404,  -404,  -404,
-     264,  -404,  -404,  -404,   272,  -404,  -404,  -404,  2261,  -404,
-    -404,  -404,  -404,   431,  -404,  -404,  -404,  -404,   283,  -404,
-    -404,   439,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404
+    -142,  1381,    22,  -142,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,     6,    40,
+      95,    95,    95,    95,    95,    95,    95,  -117,  -114,  -103,
+      95,    95,    95,   -65,   557,   557,   557,    95,    46,   -57,
+      95,   -54,   -38,   -38,   557,   557,    95,    95,    95,   557,
+      95,   557,   -38,   -38,    95,    95,    95,    56,   557,    95,
+      78,    89,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,   104,   -38,    95,   127,  -139,
+     -38,  -126,   -38,  -124,  -109,   -38,  -107,    95,    95,    95,
+      95,    95,    95,    95,   143,    95,    95,   557,    95,    95,
+      32,    95,    35,   -57,    95,    95,    37,   111,    95,   117,
+      95,    41,    44,    53,    95,    95,    95,    95,   129,    59,
+      95,    95,   135,    62,    67,    75,    95,   150,    83,    95,
+      85,    95,    95,    95,    95,    95,    90,   156,   101,    95,
+    1381,    95,    95,    95,    95,    95,    95,    95,   109,  -104,
+       8,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    1986,  -314,  -314,   331,  -314,  -314,  -314,   367,   373,   120,
+     389,   122,   442,   125,   448,   136,   147,   668,   -57,   -57,
+    -314,  -314,  -314,   159,   164,   172,  -314,  1536,   461,   857,
+     484,   857,   537,   857,   571,  1686,  -314,   591,   604,  -314,
+     -89,   -57,  -314,  2352,   -87,   -79,   610,   857,   -76,   857,
+     179,    95,   -57,   647,   -66,   -55,   857,   722,   -40,   -38,
+     739,   -18,   -16,   756,    21,   187,  -314,   780,   906,   857,
+     198,  -314,   913,  -314,   935,   956,   210,   241,   259,   261,
+     264,    95,  1014,   267,   269,   272,   277,    95,  1022,    95,
+    1028,   286,   290,  1064,   292,   298,  1078,   316,   325,   329,
+     341,  -314,    28,    30,   350,     4,  -314,    48,    51,  -314,
+      58,    73,  -314,    80,  -314,    82,   107,  -314,   113,  1085,
+     360,   377,   378,   379,  1110,   382,   668,    26,  -314,  1120,
+     383,   115,   857,   386,   390,  -314,  1127,  -314,   119,  1142,
+    1184,  -314,  -314,  1213,   392,  -314,  1228,   393,  -314,  -314,
+    -314,   401,   403,   405,   406,  -314,  1238,  -314,   407,   409,
+    -314,   410,  -314,  -314,  -314,   412,  -314,  1244,  -314,   413,
+    -314,   421,   423,   424,  1796,   426,   131,  -314,  -314,  1802,
+    -314,   436,   133,   139,  1808,   438,  1816,  1951,  1959,   440,
+    1968,   443,  2102,   444,  -314,  1381,  -314,  -314,  -314,  1381,
+    -314,  -314,    95,   109,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  1381,  -314,  -314,   141,   668,  -314,
+    -314,  -314,  2136,  -314,  2111,   152,   154,  -314,  -314,  -314,
+     158,  -314,   162,  1536,  2117,  -314,   167,  2237,  -314,   171,
+    2245,  -314,  -314,   445,  -314,  2260,  -314,   175,    95,  2352,
+    -314,  -314,  -314,   183,  2266,  -314,   197,   446,  -314,   207,
+    1836,  -314,   455,    33,  -314,   456,  -314,   209,   213,  -314,
+     219,  -314,   222,   238,  -314,   245,  -314,  -314,  -314,  -314,
+     254,  -314,  -314,  -314,   257,  2286,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  2292,  -314,  -314,  -314,  -314,
+    -314,   457,  -314,   458,    95,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,   130,  -314,   459,  -314,
+    -314,  -314,  -314,   474,   477,    24,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+     478,  -314,  -314,   668,  -314,  -314,    95,  -314,  -314,   276,
+     283,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,   184,  -314,   480,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,   285,   295,   297,   313,  2298,  2304,
+     315,  -314,   328,  -314,  -314,  -314,  -314,  -314,  -314,   333,
+    -314,   336,  -314,  -314,   349,  -314,  -314,   353,  -314,  -314,
+    -314,   486,  -314,  -314,   355,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,   359,  -314,  -314,  -314,  -314,   363,  -314,  -314,
+    -314,   365,  -314,  -314,  -314,  2310,  -314,  -314,  -314,  -314,
+     487,  -314,  -314,  -314,  -314,  -314,   369,  -314,  -314,  -314,
+    -314,  -314,  -314,   488,  -314,  -314,  -314,  -314,  -314,  2352,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,   371
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-       0,     0,     0,     2,    16,     3,     0,    19,    11,    79,
-      80,    81,    82,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   118,   117,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,   152,   153,   155,   154,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    58,    57,    59,
-      60,    61,    62,    63,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    64,    78,    65,    77,     0,
+       0,     0,     0,     2,     4,     5,     6,    16,    90,    91,
+      92,    93,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   129,   128,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   166,   165,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    69,    68,    70,    71,
+      72,    73,    74,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    75,    89,    76,    88,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -909,733 +1071,751 @@ static const yytype_int16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    16,     0,
-       0,     1,    13,    14,    15,    18,    30,    29,    31,    26,
-      27,    28,     0,   309,     8,     0,     4,     5,   326,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+       0,    28,     1,     3,    41,    40,    42,    37,    38,    39,
+       0,   320,    13,     0,     9,    10,   337,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   200,   201,   202,     0,     0,     0,   206,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,     0,
-       0,     0,     0,   226,     0,     0,     0,     0,     0,     0,
+     211,   212,   213,     0,     0,     0,   217,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,     0,     0,    24,
+       0,     0,   237,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   262,     0,     0,
-       0,     0,   269,     0,   271,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   273,     0,     0,     0,
+       0,   280,     0,   282,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   299,     0,     0,     0,     0,   310,     0,     0,
-     313,     0,     0,   316,     0,   318,     0,     0,   321,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
-       0,     0,     0,     0,     0,     0,   342,     0,   344,     0,
-       0,     0,   348,   350,     0,     0,   353,     0,     0,   355,
-     356,   357,     0,     0,     0,     0,   363,     0,   364,     0,
-       0,   367,     0,   369,   370,   371,     0,   374,     0,   375,
-       0,   377,     0,     0,     0,     0,     0,     0,   385,   387,
-       0,   388,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    12,    17,    20,     0,     0,   308,     7,
-     325,   187,     6,   186,   191,   190,   193,   192,     0,   196,
-      23,     0,    36,   195,   194,     0,    24,     0,     0,     0,
-     203,   204,   205,     0,   210,     0,     0,    18,   214,     0,
-       0,   218,     0,     0,   219,   223,     0,   222,     0,   225,
-       0,     0,   228,   229,   233,     0,     0,   234,     0,     0,
-     237,     0,     0,   242,     0,     0,   240,     0,   246,     0,
-       0,   250,     0,   248,     0,     0,   254,     0,   255,   256,
-     257,   259,     0,   260,   261,   266,     0,     0,   267,   268,
-     270,   272,   273,   274,   275,   276,   277,     0,   279,   280,
-     281,   282,   283,     0,   285,     0,     0,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,     0,   300,
-       0,   302,   303,    35,   307,     0,     0,   311,   312,   314,
-     315,   317,   319,   320,   322,   323,   324,   327,   328,   329,
-     330,     0,   332,    33,     0,   333,   334,     9,   335,   336,
-       0,     0,   340,   341,   343,   345,   346,   347,   349,   351,
-     352,   354,   358,   359,   360,   361,   362,   365,   366,   368,
-     372,   373,   376,   378,   379,   380,   382,   381,     0,   383,
-       0,   386,   389,   178,   179,   180,   181,   183,   182,   185,
-     184,   189,   188,     0,     0,   390,     0,    37,   197,    25,
-     198,   199,   207,   208,     0,   211,   212,     0,   215,   216,
-       0,   220,   221,   227,     0,   230,   231,     0,   235,   236,
-     238,   241,   239,   243,   244,     0,   249,   247,   251,   252,
-       0,   258,   263,   264,     0,   278,   284,   286,     0,   301,
-     306,    34,   305,     0,   331,    32,   337,   338,     0,   384,
-      21,     0,   391,   209,   213,   217,   232,   245,   253,   265,
-     287,   304,   339,    22
+       0,   310,     0,     0,     0,     0,   321,     0,     0,   324,
+       0,     0,   327,     0,   329,     0,     0,   332,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    15,     0,
+       0,     0,     0,     0,     0,   353,     0,   355,     0,     0,
+       0,   359,   361,     0,     0,   364,     0,     0,   366,   367,
+     368,     0,     0,     0,     0,   374,     0,   375,     0,     0,
+     378,     0,   380,   381,   382,     0,   385,     0,   386,     0,
+     388,     0,     0,     0,     0,     0,     0,   396,   398,     0,
+     399,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    17,     0,     7,    18,    19,     0,
+      22,    26,     0,     0,   319,    12,   336,   198,    11,   197,
+     202,   201,   204,   203,     0,   207,    34,     0,    47,    30,
+     206,   205,     0,    35,     0,     0,     0,   214,   215,   216,
+       0,   221,     0,     0,     0,   225,     0,     0,   229,     0,
+       0,   230,   234,     0,   233,     0,   236,     0,     0,     0,
+     239,   240,   244,     0,     0,   245,     0,     0,   248,     0,
+       0,   253,     0,     0,   251,     0,   257,     0,     0,   261,
+       0,   259,     0,     0,   265,     0,   266,   267,   268,   270,
+       0,   271,   272,   277,     0,     0,   278,   279,   281,   283,
+     284,   285,   286,   287,   288,     0,   290,   291,   292,   293,
+     294,     0,   296,     0,     0,   299,   300,   301,   302,   303,
+     304,   305,   306,   307,   308,   309,     0,   311,     0,   313,
+     314,    46,   318,     0,     8,     0,   322,   323,   325,   326,
+     328,   330,   331,   333,   334,   335,   338,   339,   340,   341,
+       0,   343,    44,     0,   344,   345,     0,   346,   347,     0,
+       0,   351,   352,   354,   356,   357,   358,   360,   362,   363,
+     365,   369,   370,   371,   372,   373,   376,   377,   379,   383,
+     384,   387,   389,   390,   391,   393,   392,     0,   394,     0,
+     397,   400,    25,    29,   189,   190,   191,   192,   194,   193,
+     196,   195,   200,   199,     0,     0,     0,     0,     0,     0,
+       0,   401,     0,    48,   208,    36,   209,   210,   218,     0,
+     219,     0,   222,   223,     0,   226,   227,     0,   231,   232,
+     238,     0,   241,   242,     0,   246,   247,   249,   252,   250,
+     254,   255,     0,   260,   258,   262,   263,     0,   269,   274,
+     275,     0,   289,   295,   297,     0,   312,   317,    45,   316,
+       0,   342,    43,    14,   348,   349,     0,   395,    20,    21,
+      23,    27,    32,     0,    31,   402,   220,   224,   228,     0,
+     243,   256,   264,   276,   298,   315,   350,    33,     0
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -404,  -404,  -403,   519,   877,  -141,  -404,    78,    91,     0,
-    -317,  -404,   -97,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,   111,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,  -162,  -404,    75,  -404,
-    -404,  -404,  -404,  -404,  -404,  -404,   182,  -404,  -404
+    -314,  -314,  -314,   619,     9,   620,    36,  1012,  -314,   144,
+       7,  -149,  -314,  -313,  -314,   -68,  -314,  -314,  -314,  -314,
+       0,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,   160,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,
+    -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -314,  -167,
+    -314,   166,  -314,  -314,  -314,  -314,  -314,  -314,  -314,   233,
+    -314,  -314
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     2,     3,   304,   311,   305,   430,   306,   292,   527,
-     512,   517,   307,   428,   616,   317,   318,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,   146,   147,   148
+       0,     2,     3,     4,   623,   302,   309,   303,   429,   304,
+     624,   290,   517,   518,   524,   305,   427,   625,   315,   316,
+     291,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-       6,   290,   516,   615,     1,   293,   295,   340,   634,   309,
-     296,   297,   298,   299,   300,   301,   296,   297,   298,   299,
-     300,   301,   344,   407,   330,   332,   334,   336,   339,   291,
-     613,   344,   410,   322,   347,   344,   413,   296,   297,   298,
-     299,   300,   301,   323,   364,   731,   324,   368,   369,   328,
-     373,   375,   376,   344,   415,   344,   418,     1,   494,   383,
-     296,   297,   298,   299,   300,   301,   343,   296,   297,   298,
-     299,   300,   301,     1,   495,     1,   539,   344,     4,   288,
-     344,   542,   406,     4,     4,   344,   543,   420,   344,   547,
-     427,     5,   289,   555,   556,   344,   558,   294,   344,   563,
-     436,   437,   344,   568,   440,   441,   438,   444,   442,   447,
-     633,   296,   297,   298,   299,   300,   301,   449,   457,   344,
-     569,   296,   297,   298,   299,   300,   301,   468,   296,   297,
-     298,   299,   300,   301,   344,   571,   450,   480,   608,   609,
-     483,   451,   485,   486,   296,   297,   298,   299,   300,   301,
-     635,   302,   303,   344,   611,   344,   617,   302,   308,   296,
-     297,   298,   299,   300,   301,   331,   333,   335,   344,   618,
-       6,     1,   614,   345,   346,   348,   350,   536,   337,   338,
-     357,   458,   361,   362,   363,   463,     1,   732,   464,   370,
-     526,   465,   530,   469,   533,   687,   344,   619,   471,   538,
-     689,   302,   367,   344,   620,   344,   621,   546,   302,   372,
-     344,   622,   478,   733,   344,   623,   481,   404,   344,   624,
-     408,   409,   411,   412,   414,   416,   417,   419,   493,   577,
-     344,   639,     1,   645,   668,   669,   344,   685,   433,     1,
-     690,   587,     1,   691,     6,   344,   495,   503,     4,   344,
-     692,   505,   302,   374,   296,   297,   298,   299,   300,   301,
-     507,   341,   302,   402,   344,   695,   344,   698,   513,   302,
-     443,   514,   296,   297,   298,   299,   300,   301,     1,   703,
-     344,   705,   344,   708,   520,   302,   446,     1,   710,   293,
-     295,   521,   293,   295,   293,   295,   344,   713,   344,   714,
-     302,   456,   344,   716,   296,   297,   298,   299,   300,   301,
-     296,   297,   298,   299,   300,   301,   511,   735,   344,   717,
-       6,     6,     4,   296,   297,   298,   299,   300,   301,   523,
-     525,   522,   529,   550,   532,   439,   344,   718,   344,   719,
-     573,   293,     6,   578,   523,   344,   721,   545,   582,   548,
-     344,   722,   583,     6,   344,   736,   559,   584,   562,   564,
-     565,   344,   737,   344,   742,   572,   585,     4,     4,   576,
-       4,     4,     4,     4,   344,   743,   344,   744,   344,   745,
-     497,   294,   344,   746,   294,   586,   294,   296,   297,   298,
-     299,   300,   301,   344,   747,   302,   461,   589,     4,     4,
-     296,   297,   298,   299,   300,   301,     6,   497,   344,   748,
-     590,   518,   519,   302,   467,   497,   344,   749,   591,     4,
-       4,   296,   297,   298,   299,   300,   301,   344,   752,   554,
-     557,     4,   640,   540,   592,   598,   599,   601,   602,   293,
-     604,   605,   606,   607,   551,   302,   479,   612,   626,   627,
-     628,   302,   498,   629,   632,   728,   638,   296,   297,   298,
-     299,   300,   301,   642,   302,   500,   296,   297,   298,   299,
-     300,   301,   296,   297,   298,   299,   300,   301,   296,   297,
-     298,   299,   300,   301,     4,   296,   297,   298,   299,   300,
-     301,   296,   297,   298,   299,   300,   301,     5,   296,   297,
-     298,   299,   300,   301,   643,   649,   651,   652,   290,   653,
-     654,   686,   655,   657,   658,     6,   659,     4,   293,   293,
-     296,   297,   298,   299,   300,   301,   694,   660,   302,   501,
-     697,   662,   663,   700,   664,   665,   667,   672,   674,   678,
-     293,   302,   504,   680,   682,   701,   707,   709,   711,   271,
-     712,   293,   296,   297,   298,   299,   300,   301,   726,   727,
-     715,   279,   302,   506,   241,   729,   730,   720,   734,   296,
-     297,   298,   299,   300,   301,   739,   751,   724,   296,   297,
-     298,   299,   300,   301,   753,   610,   288,   741,   670,     0,
-       0,     0,     0,   288,     0,     0,     4,     4,   302,   684,
-     296,   297,   298,   299,   300,   301,   684,   508,   509,     0,
-       0,     0,     0,   329,   524,     0,     6,     0,     4,   329,
-     528,     0,     0,     0,     0,     0,   329,   531,     0,     4,
-     497,     0,   302,   534,     0,     0,     0,     0,     0,   337,
-     535,   738,   296,   297,   298,   299,   300,   301,     0,     0,
-       0,     0,     0,     0,     0,   296,   297,   298,   299,   300,
-     301,   302,   537,     0,     0,     0,     0,     0,     0,     0,
-     310,   312,   314,   316,   319,   320,   321,     0,     0,     0,
-     325,   326,   327,     0,   293,     0,     0,     0,     0,     0,
-     342,     0,     0,   329,     4,   349,   351,   352,   354,   356,
-     358,   360,     0,     0,   511,   352,   366,     5,     0,   371,
-     329,   544,     0,   352,   378,   352,   352,   381,   382,   515,
-     352,   352,   352,   387,   352,   352,   352,   391,   352,   394,
-     396,   397,   399,   400,   401,   403,     0,   352,     0,     0,
-       0,   552,   553,     0,     0,     0,     0,     0,   421,   422,
-     352,   424,   352,   352,     0,   352,   431,   432,   434,   435,
-       0,     0,     4,     0,     0,     0,     0,     0,   445,     0,
-     448,     0,     0,     0,   452,   352,   454,   352,     0,     0,
-     459,   460,   462,   329,   561,     0,   466,     0,     0,   352,
-       0,   472,   352,   474,   475,   477,   329,   566,     0,   482,
-       0,   352,     0,     0,   487,   489,   491,     0,     0,   296,
-     297,   298,   299,   300,   301,     0,   296,   297,   298,   299,
-     300,   301,     0,     0,   499,     0,     0,     0,   499,   502,
-       0,   502,     0,   502,     0,   510,     0,     0,   510,   296,
-     297,   298,   299,   300,   301,     0,     0,     0,     0,   499,
-       0,   499,     0,   499,     0,   499,     0,     0,   499,   296,
-     297,   298,   299,   300,   301,     0,   499,     0,     0,   549,
-       0,   502,     0,   502,     0,     0,   560,   502,     0,     0,
-     567,     0,     0,   499,     0,     0,     0,   499,   499,     0,
-       0,     0,   499,     0,   499,   499,   296,   297,   298,   299,
-     300,   301,   499,     0,     0,     0,     0,   352,   595,   352,
-     502,     0,     0,   502,     0,     0,   502,     0,     0,     0,
-     296,   297,   298,   299,   300,   301,   296,   297,   298,   299,
-     300,   301,     0,     0,     0,     0,     0,     0,     0,   499,
-       0,     0,     0,     0,   631,     0,   510,     0,     0,   352,
-     302,   570,   641,     0,     0,     0,   499,   302,   574,   499,
-     499,     0,     0,   499,     0,     0,   499,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   499,     0,     0,     0,
-     329,   575,     0,     0,     0,     0,     0,   499,   296,   297,
-     298,   299,   300,   301,   502,     0,     0,     0,     0,   499,
-     302,   579,   499,     0,   499,   499,   502,     0,   502,     0,
-     502,     0,     0,     0,     0,   683,   296,   297,   298,   299,
-     300,   301,     0,     0,     0,     0,     0,     0,     0,   313,
-     315,   510,     0,     0,     0,     0,   510,   302,   580,   296,
-     297,   298,   299,   300,   301,   499,     0,     0,     0,   499,
-       0,     0,   499,     0,     0,   353,   355,   499,   359,     0,
-     704,   302,   581,   365,     0,   499,     0,   302,   588,     0,
-       0,   377,     0,   379,   380,     0,     0,     0,   384,   385,
-     386,     0,   388,   389,   390,   392,   393,   395,     0,   398,
-       0,     0,     0,     0,     0,   405,   499,   296,   297,   298,
-     299,   300,   301,     0,     0,     0,   499,     0,   423,     0,
-     425,   426,     0,   429,   296,   297,   298,   299,   300,   301,
-     296,   297,   298,   299,   300,   301,     0,     0,     0,   302,
-     594,     0,     0,   453,     0,   455,   296,   297,   298,   299,
-     300,   301,     0,     0,     0,     0,     0,   470,     0,     0,
-     473,     0,   476,   510,     0,     0,     0,   302,   597,   484,
-       0,     0,   488,   490,   492,     0,     0,     0,     0,     0,
+       6,   338,     1,     6,   523,   343,   406,   621,   289,   294,
+     295,   296,   297,   298,   299,   329,   331,   333,   343,   409,
+     343,   412,   292,   344,   345,   347,   349,   748,   320,   643,
+     356,   321,   360,   361,   362,   343,   414,   343,   417,   369,
+     495,   496,   322,   294,   295,   296,   297,   298,   299,   294,
+     295,   296,   297,   298,   299,   495,   546,   549,   550,   294,
+     295,   296,   297,   298,   299,   549,   551,   403,   343,   555,
+     407,   408,   410,   411,   413,   415,   416,   418,   563,   564,
+     326,   294,   295,   296,   297,   298,   299,   280,   432,   343,
+     566,   342,   294,   295,   296,   297,   298,   299,   294,   295,
+     296,   297,   298,   299,   343,   571,   343,   294,   295,   296,
+     297,   298,   299,   642,   294,   295,   296,   297,   298,   299,
+     294,   295,   296,   297,   298,   299,   549,   576,   549,   577,
+     405,   483,   294,   295,   296,   297,   298,   299,   294,   295,
+     296,   297,   298,   299,     5,   288,   426,     5,   280,   622,
+     300,   301,   499,   294,   295,   296,   297,   298,   299,   294,
+     295,   296,   297,   298,   299,   343,   579,   270,   280,   749,
+     543,   644,   616,   617,   549,   619,   340,   435,   530,   532,
+     437,   536,   441,   539,   300,   306,   448,   311,   313,   449,
+     335,   336,   549,   626,   530,   549,   627,   553,   450,   556,
+     300,   366,   549,   628,   457,   703,   567,   462,   570,   572,
+     573,   705,   463,   352,   354,   580,   358,   549,   629,   584,
+     464,   364,   300,   371,   549,   630,   549,   631,   468,   376,
+     470,   378,   379,   300,   373,   477,   383,   384,   385,   300,
+     387,   388,   389,   391,   392,   394,   480,   397,   300,   401,
+     438,   549,   632,   404,   494,   300,   442,   549,   633,   343,
+     648,   300,   445,   495,   654,   509,   422,   511,   424,   425,
+     513,   428,   278,   300,   455,   677,   678,   495,   682,   300,
+     460,   520,   649,   499,   683,   343,   701,   482,   240,   498,
+     501,   452,   521,   454,   300,   466,   495,   706,   495,   707,
+     300,   478,   549,   683,   527,   469,   549,   708,   472,   528,
+     475,   549,   712,   339,   519,   549,   715,   529,   485,   495,
+     720,   489,   491,   493,   558,   525,   526,   549,   722,   501,
+     752,   501,   581,   501,   294,   295,   296,   297,   298,   299,
+     498,   549,   725,   586,   501,   501,   695,   501,   547,   501,
+     697,   495,   727,   549,   730,   590,   501,   343,   731,   559,
+     501,   501,   501,   549,   733,   700,   549,   734,   702,   501,
+     294,   295,   296,   297,   298,   299,   294,   295,   296,   297,
+     298,   299,   549,   735,   709,   711,   591,   339,   714,   343,
+     736,   717,   294,   295,   296,   297,   298,   299,   549,   738,
+     709,   549,   739,   501,   592,   724,   593,   501,   501,   594,
+     501,   501,   597,   501,   598,   501,   501,   599,   501,   732,
+     549,   754,   600,   601,   288,   604,   737,   343,   755,   495,
+     758,   606,   501,   497,   500,   607,   741,   609,   498,   499,
+     759,   495,   760,   610,   503,   294,   295,   296,   297,   298,
+     299,   294,   295,   296,   297,   298,   299,   499,   761,   499,
+     764,   612,   339,   339,   294,   295,   296,   297,   298,   299,
+     613,   503,   549,   765,   614,   300,   504,   549,   761,   503,
+     549,   766,   498,   501,   497,   339,   615,   294,   295,   296,
+     297,   298,   299,   549,   767,   620,   339,   549,   768,   549,
+     770,   756,   694,   549,   771,   635,   696,   549,   772,   549,
+     773,   300,   506,   549,   776,   549,   764,   300,   507,   562,
+     565,   699,   636,   637,   638,   498,   498,   641,   647,   699,
+     501,   651,   501,   300,   510,   652,   501,   658,   660,   501,
+     294,   295,   296,   297,   298,   299,   661,   498,   662,   339,
+     663,   664,   666,   501,   667,   668,   501,   669,   671,   498,
+     294,   295,   296,   297,   298,   299,   672,   501,   673,   674,
+     501,   676,   501,   501,   294,   295,   296,   297,   298,   299,
+     501,   681,   497,   685,   501,   689,   300,   512,   691,   693,
+     718,   726,   514,   515,   294,   295,   296,   297,   298,   299,
+     728,   729,   743,   744,   746,   327,   531,   294,   295,   296,
+     297,   298,   299,   294,   295,   296,   297,   298,   299,   747,
+     778,   495,   293,   751,   498,   757,   497,   500,   327,   535,
+     769,   763,   775,   777,   750,   618,   679,     0,     0,   288,
+       0,     0,     0,   288,     0,     0,     0,     0,     0,   501,
+     294,   295,   296,   297,   298,   299,     0,     0,   288,     0,
+       0,     0,     0,     0,     0,     0,   288,     0,     0,   497,
+     497,   294,   295,   296,   297,   298,   299,   503,     0,     0,
+       0,   327,   538,     0,     0,     0,     0,     0,     0,     0,
+       0,   497,     0,     0,   498,   501,   498,   501,     0,   498,
+     501,   327,   501,   497,   503,     0,     0,     0,     0,   501,
+       0,   501,     0,     0,   501,   300,   541,   501,     0,     0,
+       0,   519,     0,     0,   501,   294,   295,   296,   297,   298,
+     299,     0,   501,     0,     0,   335,   542,   501,     0,     0,
+       0,   501,   294,   295,   296,   297,   298,   299,   300,   544,
+       0,     0,     0,     0,   327,   552,   501,     0,     0,   294,
+     295,   296,   297,   298,   299,     0,     0,     0,   497,   339,
+     308,   310,   312,   314,   317,   318,   319,     0,   501,     0,
+     323,   324,   325,   294,   295,   296,   297,   298,   299,     0,
+     341,   560,   561,     0,     0,   348,   350,   351,   353,   355,
+     357,   359,     0,     0,     0,   351,   365,     0,     0,   370,
+       0,     0,   522,   351,   377,   351,   351,   380,   381,     0,
+     351,   351,   351,   386,   351,   351,   351,   390,   351,   393,
+     395,   396,   398,   399,   400,   402,     0,   351,   497,   500,
+     497,   500,     0,   497,   500,     0,     0,     0,   420,   421,
+     351,   423,   351,   351,     0,   351,   430,   431,   433,   434,
+     294,   295,   296,   297,   298,   299,   327,   569,   444,     0,
+     447,     0,     0,     0,   451,   351,   453,   351,     0,     0,
+     458,   459,   461,   533,   574,     0,   465,     0,     0,   351,
+       0,   471,   351,   473,   474,   476,     0,     0,     0,   481,
+     300,   578,   351,     0,     0,   488,   490,   492,     0,   294,
+     295,   296,   297,   298,   299,     0,   294,   295,   296,   297,
+     298,   299,     0,   505,   300,   582,     0,   505,   508,     0,
+     508,     0,   508,     0,   516,     0,     0,   516,   294,   295,
+     296,   297,   298,   299,     0,     0,     0,     0,   505,     0,
+     505,     0,   505,     0,   505,     0,     0,   505,     0,   294,
+     295,   296,   297,   298,   299,     0,   505,     0,     0,   557,
+       0,   508,     0,   508,     0,     0,   568,   508,     0,     0,
+     575,     0,     0,   505,     0,     0,     0,   505,   505,     0,
+       0,     0,   505,     0,   505,   505,     0,     0,     0,     0,
+       0,   533,   505,     0,     0,     0,     0,   351,   603,   351,
+     508,     0,     0,   508,     0,     0,   508,   294,   295,   296,
+     297,   298,   299,     0,     0,   294,   295,   296,   297,   298,
+     299,   294,   295,   296,   297,   298,   299,     0,     0,   505,
+       0,     0,     0,     0,   640,     0,   516,     0,     0,   646,
+     327,   583,   650,     0,     0,     0,   505,   300,   587,   505,
+     505,     0,     0,   505,     0,     0,   505,   294,   295,   296,
+     297,   298,   299,     0,     0,     0,   505,     0,     0,   300,
+     588,   294,   295,   296,   297,   298,   299,   505,   294,   295,
+     296,   297,   298,   299,   508,     0,     0,     0,     0,   505,
+     300,   589,     0,     0,   505,     0,   505,   505,   508,     0,
+     508,     0,   508,   294,   295,   296,   297,   298,   299,     0,
+       0,     0,   698,   294,   295,   296,   297,   298,   299,     0,
+     294,   295,   296,   297,   298,   299,     0,     0,   516,     0,
+       0,     0,     0,     0,   516,   294,   295,   296,   297,   298,
+     299,     0,     0,     0,   505,     0,     0,   505,   300,   596,
+     505,   307,     0,     0,     0,   505,   300,   602,   721,     0,
+       0,     0,   300,   605,   505,     0,   328,   330,   332,   334,
+     337,     0,     0,     0,     0,     0,   346,   294,   295,   296,
+     297,   298,   299,     0,     0,     0,   363,     0,     0,   367,
+     368,     0,   372,   374,   375,   505,     0,     0,   300,   608,
+       0,   382,     0,     0,     0,   505,   294,   295,   296,   297,
+     298,   299,   300,   611,     0,     0,     0,     0,     0,   300,
+     634,   294,   295,   296,   297,   298,   299,     0,     0,   419,
+       0,   294,   295,   296,   297,   298,   299,   294,   295,   296,
+     297,   298,   299,   436,   300,   639,   439,   440,     0,   443,
+       0,   446,     0,   516,   300,   645,   753,     0,     0,     0,
+     456,   300,   653,     0,     0,     0,     0,     0,     0,   467,
+       0,     0,     0,     0,     0,     0,   300,   655,     0,   479,
+       0,     0,     0,   484,     0,   486,   487,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     302,   600,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   516,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   300,   656,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   510,     0,     0,     0,     0,     0,     0,     0,
+       0,   534,     0,   537,     0,   540,     0,     0,     0,     0,
+     545,     0,     0,     0,     0,     0,     0,   300,   657,   554,
+       0,     0,     0,     0,     0,   505,     0,     0,     0,     0,
+       0,     0,   300,   659,     0,     0,     0,     0,     0,     0,
+       0,   585,   300,   665,   148,   149,     0,     0,   300,   670,
+       0,     0,   150,   595,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,     0,   218,   219,   220,   221,   222,   223,   224,   225,
+     226,   227,   228,     0,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,     0,   281,   282,   283,
+     284,   285,   286,   287,     0,     0,     0,     0,     0,   148,
+     149,     0,     0,     0,     0,     0,     0,   150,     0,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   745,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,     0,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     327,     0,   281,   282,   283,   284,   285,   286,   287,   148,
+     149,     0,     0,     0,     0,     0,     0,   150,     0,   151,
+     152,   502,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,     0,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,     0,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   294,
+     295,   296,   297,   298,   299,   294,   295,   296,   297,   298,
+     299,   294,   295,   296,   297,   298,   299,     0,   268,   294,
+     295,   296,   297,   298,   299,     0,     0,     0,     0,     0,
+     300,     0,   281,   282,   283,   284,   285,   286,   287,   148,
+     149,     0,     0,     0,     0,     0,     0,   150,     0,   151,
+     152,   502,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,     0,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,     0,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     300,   675,     0,     0,     0,     0,   300,   680,     0,     0,
+       0,     0,   300,   684,   294,   295,   296,   297,   298,   299,
+     300,   686,   294,   295,   296,   297,   298,   299,     0,     0,
+     270,   294,   295,   296,   297,   298,   299,     0,     0,     0,
+     300,     0,   281,   282,   283,   284,   285,   286,   287,   148,
+     149,     0,     0,     0,     0,     0,     0,   150,     0,   151,
+     152,   502,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,     0,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,     0,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+       0,     0,     0,     0,     0,   300,   687,     0,     0,     0,
+       0,     0,     0,   300,   688,   294,   295,   296,   297,   298,
+     299,     0,   300,   690,   294,   295,   296,   297,   298,   299,
+     294,   295,   296,   297,   298,   299,     0,     0,     0,     0,
+     300,     0,   281,   282,   283,   284,   285,   286,   287,   148,
+     149,     0,     0,     0,     0,     0,     0,   150,     0,   151,
+     152,   502,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,     0,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   227,   228,     0,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     294,   295,   296,   297,   298,   299,   300,   692,   294,   295,
+     296,   297,   298,   299,     0,   522,   704,     0,     0,     0,
+       0,   327,   710,   294,   295,   296,   297,   298,   299,   294,
+     295,   296,   297,   298,   299,     0,     0,     0,     0,     0,
+     280,     0,   281,   282,   283,   284,   285,   286,   287,   294,
+     295,   296,   297,   298,   299,   294,   295,   296,   297,   298,
+     299,   294,   295,   296,   297,   298,   299,   294,   295,   296,
+     297,   298,   299,   294,   295,   296,   297,   298,   299,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   302,   603,
-       0,     0,     0,     0,     0,     0,     0,   499,     0,     0,
-       0,     0,     0,     0,     0,   302,   625,     0,     0,     0,
-       0,   302,   630,     0,     0,   593,     0,   596,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   302,   636,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,   637,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   275,   276,   277,   278,   279,   280,     1,
-       0,   281,   282,   283,   284,   285,   286,   287,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,     0,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   275,   276,   277,   278,   279,   280,   329,
-       0,   281,   282,   283,   284,   285,   286,   287,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,     0,   152,   153,
-     496,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   296,   297,
-     298,   299,   300,   301,   296,   297,   298,   299,   300,   301,
-     296,   297,   298,   299,   300,   301,     0,   269,   296,   297,
-     298,   299,   300,   301,     0,     0,     0,     0,     0,   302,
-       0,   281,   282,   283,   284,   285,   286,   287,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,     0,   152,   153,
-     496,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   302,
-     644,     0,     0,     0,     0,   302,   646,     0,     0,     0,
-       0,   302,   647,   296,   297,   298,   299,   300,   301,   302,
-     648,   296,   297,   298,   299,   300,   301,     0,     0,   271,
-     296,   297,   298,   299,   300,   301,     0,     0,     0,   302,
-       0,   281,   282,   283,   284,   285,   286,   287,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,     0,   152,   153,
-     496,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,     0,
-       0,     0,     0,     0,   302,   650,     0,     0,     0,     0,
-       0,     0,   302,   656,   296,   297,   298,   299,   300,   301,
-       0,   302,   661,   296,   297,   298,   299,   300,   301,   296,
-     297,   298,   299,   300,   301,     0,     0,     0,     0,   302,
-       0,   281,   282,   283,   284,   285,   286,   287,   149,   150,
-       0,     0,     0,     0,     0,     0,   151,     0,   152,   153,
-     496,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
-     214,   215,   216,   217,   218,     0,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,   230,   231,
-     232,   233,   234,   235,   236,   237,   238,   239,   240,   296,
-     297,   298,   299,   300,   301,   302,   666,   296,   297,   298,
-     299,   300,   301,     0,   302,   671,     0,     0,     0,     0,
-     302,   673,   296,   297,   298,   299,   300,   301,   296,   297,
-     298,   299,   300,   301,     0,     0,     0,     0,     0,     1,
-       0,   281,   282,   283,   284,   285,   286,   287,   296,   297,
-     298,   299,   300,   301,   296,   297,   298,   299,   300,   301,
-     296,   297,   298,   299,   300,   301,   296,   297,   298,   299,
-     300,   301,   296,   297,   298,   299,   300,   301,   296,   297,
-     298,   299,   300,   301,   296,   297,   298,   299,   300,   301,
-     296,   297,   298,   299,   300,   301,   296,   297,   298,   299,
-     300,   301,   296,   297,   298,   299,   300,   301,   296,   297,
-     298,   299,   300,   301,   296,   297,   298,   299,   300,   301,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   548,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     302,   675,     0,     0,     0,     0,     0,     0,   302,   676,
+       0,   327,   713,     0,     0,     0,     0,     0,     0,   327,
+     716,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   300,   719,     0,     0,     0,     0,
+     327,   723,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   302,   677,     0,     0,     0,   541,   302,
-     679,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   302,
-     681,     0,     0,     0,     0,   515,   688,     0,     0,     0,
-       0,   329,   693,     0,     0,     0,     0,   329,   696,     0,
-       0,     0,     0,   329,   699,     0,     0,     0,     0,   302,
-     702,     0,     0,     0,     0,   329,   706,     0,     0,     0,
-       0,   329,   723,     0,     0,     0,     0,   302,   725,     0,
-       0,     0,     0,   515,   509,     0,     0,     0,     0,     1,
-     740,     0,     0,     0,     0,   302,   750,   241,   242,   243,
+     327,   740,     0,     0,     0,     0,   300,   742,     0,     0,
+       0,     0,   522,   515,     0,     0,     0,     0,   495,   762,
+       0,     0,     0,     0,   300,   774,   240,   241,   242,   243,
      244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
      254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
      264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   275,   276,   277,   278,   279,   280,   344
+     274,   275,   276,   277,   278,   279,   343
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,     1,   319,   406,   144,     5,     6,   169,     3,   150,
+       0,   168,   144,     3,   317,   144,   145,     3,     1,     3,
+       4,     5,     6,     7,     8,   164,   165,   166,   144,   145,
+     144,   145,     0,   172,   173,   174,   175,     3,   145,     3,
+     179,   145,   181,   182,   183,   144,   145,   144,   145,   188,
+     144,   145,   145,     3,     4,     5,     6,     7,     8,     3,
+       4,     5,     6,     7,     8,   144,   145,   144,   145,     3,
+       4,     5,     6,     7,     8,   144,   145,   216,   144,   145,
+     219,   220,   221,   222,   223,   224,   225,   226,   144,   145,
+     145,     3,     4,     5,     6,     7,     8,   144,   237,   144,
+     145,   145,     3,     4,     5,     6,     7,     8,     3,     4,
+       5,     6,     7,     8,   144,   145,   144,     3,     4,     5,
+       6,     7,     8,   426,     3,     4,     5,     6,     7,     8,
+       3,     4,     5,     6,     7,     8,   144,   145,   144,   145,
+       3,   280,     3,     4,     5,     6,     7,     8,     3,     4,
+       5,     6,     7,     8,     0,     1,     3,     3,   144,   145,
+     144,   145,   144,     3,     4,     5,     6,     7,     8,     3,
+       4,     5,     6,     7,     8,   144,   145,   134,   144,   145,
+     337,   145,   144,   145,   144,   145,   169,   145,   327,   328,
+     145,   330,   145,   332,   144,   145,   145,   151,   152,   145,
+     144,   145,   144,   145,   343,   144,   145,   346,   145,   348,
+     144,   145,   144,   145,   145,   518,   355,   145,   357,   358,
+     359,   524,   145,   177,   178,   364,   180,   144,   145,   368,
+     145,   185,   144,   145,   144,   145,   144,   145,   145,   193,
+     145,   195,   196,   144,   145,   145,   200,   201,   202,   144,
+     204,   205,   206,   207,   208,   209,   145,   211,   144,   145,
+     243,   144,   145,   217,   145,   144,   145,   144,   145,   144,
+     145,   144,   145,   144,   145,   145,   230,   145,   232,   233,
+     145,   235,   142,   144,   145,   144,   145,   144,   145,   144,
+     145,   145,   431,   144,   145,   144,   145,   280,   104,   289,
+     290,   255,   145,   257,   144,   145,   144,   145,   144,   145,
+     144,   145,   144,   145,   145,   269,   144,   145,   272,   145,
+     274,   144,   145,   169,   314,   144,   145,   145,   282,   144,
+     145,   285,   286,   287,   145,   318,   319,   144,   145,   329,
+     643,   331,   145,   333,     3,     4,     5,     6,     7,     8,
+     340,   144,   145,   145,   344,   345,   495,   347,   341,   349,
+     499,   144,   145,   144,   145,   145,   356,   144,   145,   352,
+     360,   361,   362,   144,   145,   514,   144,   145,   517,   369,
        3,     4,     5,     6,     7,     8,     3,     4,     5,     6,
-       7,     8,   144,   145,   165,   166,   167,   168,   169,     0,
-       3,   144,   145,   145,   175,   144,   145,     3,     4,     5,
-       6,     7,     8,   145,   185,     3,   145,   188,   189,   145,
-     191,   192,   193,   144,   145,   144,   145,   144,   145,   200,
-       3,     4,     5,     6,     7,     8,   145,     3,     4,     5,
-       6,     7,     8,   144,   145,   144,   145,   144,     0,     1,
-     144,   145,     3,     5,     6,   144,   145,   228,   144,   145,
-       3,     0,     1,   144,   145,   144,   145,     6,   144,   145,
-     145,   242,   144,   145,   245,   246,   145,   248,   145,   250,
-     427,     3,     4,     5,     6,     7,     8,   145,   259,   144,
-     145,     3,     4,     5,     6,     7,     8,   268,     3,     4,
-       5,     6,     7,     8,   144,   145,   145,   278,   144,   145,
-     281,   145,   283,   284,     3,     4,     5,     6,     7,     8,
-     145,   144,   145,   144,   145,   144,   145,   144,   145,     3,
-       4,     5,     6,     7,     8,   165,   166,   167,   144,   145,
-     170,   144,   145,   173,   174,   175,   176,   339,   144,   145,
-     180,   145,   182,   183,   184,   145,   144,   145,   145,   189,
-     331,   145,   333,   145,   335,   512,   144,   145,   145,   340,
-     517,   144,   145,   144,   145,   144,   145,   348,   144,   145,
-     144,   145,   145,   616,   144,   145,   145,   217,   144,   145,
-     220,   221,   222,   223,   224,   225,   226,   227,   145,   370,
-     144,   145,   144,   145,   144,   145,   144,   145,   238,   144,
-     145,   382,   144,   145,   244,   144,   145,   145,   170,   144,
+       7,     8,   144,   145,   533,   534,   145,   243,   537,   144,
+     145,   540,     3,     4,     5,     6,     7,     8,   144,   145,
+     549,   144,   145,   403,   145,   554,   145,   407,   408,   145,
+     410,   411,   145,   413,   145,   415,   416,   145,   418,   568,
+     144,   145,   145,   387,   280,   389,   575,   144,   145,   144,
+     145,   145,   432,   289,   290,   145,   585,   145,   438,   144,
+     145,   144,   145,   145,   300,     3,     4,     5,     6,     7,
+       8,     3,     4,     5,     6,     7,     8,   144,   145,   144,
+     145,   145,   318,   319,     3,     4,     5,     6,     7,     8,
+     145,   327,   144,   145,   145,   144,   145,   144,   145,   335,
+     144,   145,   482,   483,   340,   341,   145,     3,     4,     5,
+       6,     7,     8,   144,   145,   145,   352,   144,   145,   144,
+     145,   650,   495,   144,   145,   145,   499,   144,   145,   144,
+     145,   144,   145,   144,   145,   144,   145,   144,   145,   353,
+     354,   514,   145,   145,   145,   525,   526,   145,   145,   522,
+     530,   145,   532,   144,   145,   145,   536,   145,   145,   539,
+       3,     4,     5,     6,     7,     8,   145,   547,   145,   405,
+     145,   145,   145,   553,   145,   145,   556,   145,   145,   559,
+       3,     4,     5,     6,     7,     8,   145,   567,   145,   145,
+     570,   145,   572,   573,     3,     4,     5,     6,     7,     8,
+     580,   145,   438,   145,   584,   145,   144,   145,   145,   145,
      145,   145,   144,   145,     3,     4,     5,     6,     7,     8,
-     145,   170,   144,   145,   144,   145,   144,   145,   145,   144,
-     145,   145,     3,     4,     5,     6,     7,     8,   144,   145,
-     144,   145,   144,   145,   145,   144,   145,   144,   145,   289,
-     290,   145,   292,   293,   294,   295,   144,   145,   144,   145,
-     144,   145,   144,   145,     3,     4,     5,     6,     7,     8,
-       3,     4,     5,     6,     7,     8,   316,   634,   144,   145,
-     320,   321,   244,     3,     4,     5,     6,     7,     8,   329,
-     330,   145,   332,   145,   334,   244,   144,   145,   144,   145,
-     145,   341,   342,   145,   344,   144,   145,   347,   145,   349,
-     144,   145,   145,   353,   144,   145,   356,   145,   358,   359,
-     360,   144,   145,   144,   145,   365,   145,   289,   290,   369,
-     292,   293,   294,   295,   144,   145,   144,   145,   144,   145,
-     302,   290,   144,   145,   293,   145,   295,     3,     4,     5,
-       6,     7,     8,   144,   145,   144,   145,   145,   320,   321,
-       3,     4,     5,     6,     7,     8,   406,   329,   144,   145,
-     145,   320,   321,   144,   145,   337,   144,   145,   145,   341,
-     342,     3,     4,     5,     6,     7,     8,   144,   145,   354,
-     355,   353,   432,   342,   145,   145,   145,   145,   145,   439,
-     145,   145,   145,   145,   353,   144,   145,   145,   145,   145,
-     145,   144,   145,   145,   145,   596,   145,     3,     4,     5,
-       6,     7,     8,   145,   144,   145,     3,     4,     5,     6,
-       7,     8,     3,     4,     5,     6,     7,     8,     3,     4,
-       5,     6,     7,     8,   406,     3,     4,     5,     6,     7,
-       8,     3,     4,     5,     6,     7,     8,   406,     3,     4,
-       5,     6,     7,     8,   145,   145,   145,   145,   508,   145,
-     145,   511,   145,   145,   145,   515,   145,   439,   518,   519,
-       3,     4,     5,     6,     7,     8,   526,   145,   144,   145,
-     530,   145,   145,   533,   145,   145,   145,   145,   145,   145,
-     540,   144,   145,   145,   145,   145,   546,   145,   145,   134,
-     145,   551,     3,     4,     5,     6,     7,     8,   145,   145,
-     560,   142,   144,   145,   104,   145,   145,   567,   145,     3,
-       4,     5,     6,     7,     8,   145,   145,   577,     3,     4,
-       5,     6,     7,     8,   145,   403,   508,   684,   477,    -1,
-      -1,    -1,    -1,   515,    -1,    -1,   518,   519,   144,   508,
-       3,     4,     5,     6,     7,     8,   515,   144,   145,    -1,
-      -1,    -1,    -1,   144,   145,    -1,   616,    -1,   540,   144,
-     145,    -1,    -1,    -1,    -1,    -1,   144,   145,    -1,   551,
-     552,    -1,   144,   145,    -1,    -1,    -1,    -1,    -1,   144,
-     145,   641,     3,     4,     5,     6,     7,     8,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
-       8,   144,   145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     151,   152,   153,   154,   155,   156,   157,    -1,    -1,    -1,
-     161,   162,   163,    -1,   684,    -1,    -1,    -1,    -1,    -1,
-     171,    -1,    -1,   144,   616,   176,   177,   178,   179,   180,
-     181,   182,    -1,    -1,   704,   186,   187,   616,    -1,   190,
-     144,   145,    -1,   194,   195,   196,   197,   198,   199,   144,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,    -1,   218,    -1,    -1,
-      -1,   144,   145,    -1,    -1,    -1,    -1,    -1,   229,   230,
-     231,   232,   233,   234,    -1,   236,   237,   238,   239,   240,
-      -1,    -1,   684,    -1,    -1,    -1,    -1,    -1,   249,    -1,
-     251,    -1,    -1,    -1,   255,   256,   257,   258,    -1,    -1,
-     261,   262,   263,   144,   145,    -1,   267,    -1,    -1,   270,
-      -1,   272,   273,   274,   275,   276,   144,   145,    -1,   280,
-      -1,   282,    -1,    -1,   285,   286,   287,    -1,    -1,     3,
+     145,   145,   145,   145,   145,   144,   145,     3,     4,     5,
+       6,     7,     8,     3,     4,     5,     6,     7,     8,   145,
+     769,   144,     3,   145,   624,   145,   482,   483,   144,   145,
+     144,   699,   145,   145,   625,   402,   476,    -1,    -1,   495,
+      -1,    -1,    -1,   499,    -1,    -1,    -1,    -1,    -1,   649,
+       3,     4,     5,     6,     7,     8,    -1,    -1,   514,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   522,    -1,    -1,   525,
+     526,     3,     4,     5,     6,     7,     8,   533,    -1,    -1,
+      -1,   144,   145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   547,    -1,    -1,   694,   695,   696,   697,    -1,   699,
+     700,   144,   702,   559,   560,    -1,    -1,    -1,    -1,   709,
+      -1,   711,    -1,    -1,   714,   144,   145,   717,    -1,    -1,
+      -1,   721,    -1,    -1,   724,     3,     4,     5,     6,     7,
+       8,    -1,   732,    -1,    -1,   144,   145,   737,    -1,    -1,
+      -1,   741,     3,     4,     5,     6,     7,     8,   144,   145,
+      -1,    -1,    -1,    -1,   144,   145,   756,    -1,    -1,     3,
+       4,     5,     6,     7,     8,    -1,    -1,    -1,   624,   625,
+     150,   151,   152,   153,   154,   155,   156,    -1,   778,    -1,
+     160,   161,   162,     3,     4,     5,     6,     7,     8,    -1,
+     170,   144,   145,    -1,    -1,   175,   176,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,   185,   186,    -1,    -1,   189,
+      -1,    -1,   144,   193,   194,   195,   196,   197,   198,    -1,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,   213,   214,   215,    -1,   217,   694,   695,
+     696,   697,    -1,   699,   700,    -1,    -1,    -1,   228,   229,
+     230,   231,   232,   233,    -1,   235,   236,   237,   238,   239,
+       3,     4,     5,     6,     7,     8,   144,   145,   248,    -1,
+     250,    -1,    -1,    -1,   254,   255,   256,   257,    -1,    -1,
+     260,   261,   262,   144,   145,    -1,   266,    -1,    -1,   269,
+      -1,   271,   272,   273,   274,   275,    -1,    -1,    -1,   279,
+     144,   145,   282,    -1,    -1,   285,   286,   287,    -1,     3,
        4,     5,     6,     7,     8,    -1,     3,     4,     5,     6,
-       7,     8,    -1,    -1,   305,    -1,    -1,    -1,   309,   310,
-      -1,   312,    -1,   314,    -1,   316,    -1,    -1,   319,     3,
-       4,     5,     6,     7,     8,    -1,    -1,    -1,    -1,   330,
-      -1,   332,    -1,   334,    -1,   336,    -1,    -1,   339,     3,
-       4,     5,     6,     7,     8,    -1,   347,    -1,    -1,   350,
-      -1,   352,    -1,   354,    -1,    -1,   357,   358,    -1,    -1,
-     361,    -1,    -1,   364,    -1,    -1,    -1,   368,   369,    -1,
-      -1,    -1,   373,    -1,   375,   376,     3,     4,     5,     6,
-       7,     8,   383,    -1,    -1,    -1,    -1,   388,   389,   390,
-     391,    -1,    -1,   394,    -1,    -1,   397,    -1,    -1,    -1,
-       3,     4,     5,     6,     7,     8,     3,     4,     5,     6,
-       7,     8,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   420,
-      -1,    -1,    -1,    -1,   425,    -1,   427,    -1,    -1,   430,
-     144,   145,   433,    -1,    -1,    -1,   437,   144,   145,   440,
-     441,    -1,    -1,   444,    -1,    -1,   447,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   457,    -1,    -1,    -1,
-     144,   145,    -1,    -1,    -1,    -1,    -1,   468,     3,     4,
-       5,     6,     7,     8,   475,    -1,    -1,    -1,    -1,   480,
-     144,   145,   483,    -1,   485,   486,   487,    -1,   489,    -1,
-     491,    -1,    -1,    -1,    -1,   496,     3,     4,     5,     6,
-       7,     8,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,
-     153,   512,    -1,    -1,    -1,    -1,   517,   144,   145,     3,
-       4,     5,     6,     7,     8,   526,    -1,    -1,    -1,   530,
-      -1,    -1,   533,    -1,    -1,   178,   179,   538,   181,    -1,
-     541,   144,   145,   186,    -1,   546,    -1,   144,   145,    -1,
-      -1,   194,    -1,   196,   197,    -1,    -1,    -1,   201,   202,
-     203,    -1,   205,   206,   207,   208,   209,   210,    -1,   212,
-      -1,    -1,    -1,    -1,    -1,   218,   577,     3,     4,     5,
-       6,     7,     8,    -1,    -1,    -1,   587,    -1,   231,    -1,
-     233,   234,    -1,   236,     3,     4,     5,     6,     7,     8,
-       3,     4,     5,     6,     7,     8,    -1,    -1,    -1,   144,
-     145,    -1,    -1,   256,    -1,   258,     3,     4,     5,     6,
-       7,     8,    -1,    -1,    -1,    -1,    -1,   270,    -1,    -1,
-     273,    -1,   275,   634,    -1,    -1,    -1,   144,   145,   282,
-      -1,    -1,   285,   286,   287,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     144,   145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   683,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       7,     8,    -1,   303,   144,   145,    -1,   307,   308,    -1,
+     310,    -1,   312,    -1,   314,    -1,    -1,   317,     3,     4,
+       5,     6,     7,     8,    -1,    -1,    -1,    -1,   328,    -1,
+     330,    -1,   332,    -1,   334,    -1,    -1,   337,    -1,     3,
+       4,     5,     6,     7,     8,    -1,   346,    -1,    -1,   349,
+      -1,   351,    -1,   353,    -1,    -1,   356,   357,    -1,    -1,
+     360,    -1,    -1,   363,    -1,    -1,    -1,   367,   368,    -1,
+      -1,    -1,   372,    -1,   374,   375,    -1,    -1,    -1,    -1,
+      -1,   144,   382,    -1,    -1,    -1,    -1,   387,   388,   389,
+     390,    -1,    -1,   393,    -1,    -1,   396,     3,     4,     5,
+       6,     7,     8,    -1,    -1,     3,     4,     5,     6,     7,
+       8,     3,     4,     5,     6,     7,     8,    -1,    -1,   419,
+      -1,    -1,    -1,    -1,   424,    -1,   426,    -1,    -1,   429,
+     144,   145,   432,    -1,    -1,    -1,   436,   144,   145,   439,
+     440,    -1,    -1,   443,    -1,    -1,   446,     3,     4,     5,
+       6,     7,     8,    -1,    -1,    -1,   456,    -1,    -1,   144,
+     145,     3,     4,     5,     6,     7,     8,   467,     3,     4,
+       5,     6,     7,     8,   474,    -1,    -1,    -1,    -1,   479,
+     144,   145,    -1,    -1,   484,    -1,   486,   487,   488,    -1,
+     490,    -1,   492,     3,     4,     5,     6,     7,     8,    -1,
+      -1,    -1,   502,     3,     4,     5,     6,     7,     8,    -1,
+       3,     4,     5,     6,     7,     8,    -1,    -1,   518,    -1,
+      -1,    -1,    -1,    -1,   524,     3,     4,     5,     6,     7,
+       8,    -1,    -1,    -1,   534,    -1,    -1,   537,   144,   145,
+     540,   149,    -1,    -1,    -1,   545,   144,   145,   548,    -1,
+      -1,    -1,   144,   145,   554,    -1,   164,   165,   166,   167,
+     168,    -1,    -1,    -1,    -1,    -1,   174,     3,     4,     5,
+       6,     7,     8,    -1,    -1,    -1,   184,    -1,    -1,   187,
+     188,    -1,   190,   191,   192,   585,    -1,    -1,   144,   145,
+      -1,   199,    -1,    -1,    -1,   595,     3,     4,     5,     6,
+       7,     8,   144,   145,    -1,    -1,    -1,    -1,    -1,   144,
+     145,     3,     4,     5,     6,     7,     8,    -1,    -1,   227,
+      -1,     3,     4,     5,     6,     7,     8,     3,     4,     5,
+       6,     7,     8,   241,   144,   145,   244,   245,    -1,   247,
+      -1,   249,    -1,   643,   144,   145,   646,    -1,    -1,    -1,
+     258,   144,   145,    -1,    -1,    -1,    -1,    -1,    -1,   267,
+      -1,    -1,    -1,    -1,    -1,    -1,   144,   145,    -1,   277,
+      -1,    -1,    -1,   281,    -1,   283,   284,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   698,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   728,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,
-      -1,   144,   145,    -1,    -1,   388,    -1,   390,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,   430,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
-       5,     6,     7,     8,     3,     4,     5,     6,     7,     8,
-       3,     4,     5,     6,     7,     8,    -1,   132,     3,     4,
-       5,     6,     7,     8,    -1,    -1,    -1,    -1,    -1,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   144,
-     145,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,
-      -1,   144,   145,     3,     4,     5,     6,     7,     8,   144,
-     145,     3,     4,     5,     6,     7,     8,    -1,    -1,   134,
-       3,     4,     5,     6,     7,     8,    -1,    -1,    -1,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
-      -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,    -1,
+      -1,   329,    -1,   331,    -1,   333,    -1,    -1,    -1,    -1,
+     338,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,   347,
+      -1,    -1,    -1,    -1,    -1,   745,    -1,    -1,    -1,    -1,
+      -1,    -1,   144,   145,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   369,   144,   145,     3,     4,    -1,    -1,   144,   145,
+      -1,    -1,    11,   381,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    -1,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    -1,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,    -1,   146,   147,   148,
+     149,   150,   151,   152,    -1,    -1,    -1,    -1,    -1,     3,
+       4,    -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,   604,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,    -1,   146,   147,   148,   149,   150,   151,   152,     3,
+       4,    -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    -1,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,     6,     7,     8,     3,     4,     5,     6,     7,
+       8,     3,     4,     5,     6,     7,     8,    -1,   132,     3,
+       4,     5,     6,     7,     8,    -1,    -1,    -1,    -1,    -1,
+     144,    -1,   146,   147,   148,   149,   150,   151,   152,     3,
+       4,    -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    -1,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     144,   145,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,
       -1,    -1,   144,   145,     3,     4,     5,     6,     7,     8,
+     144,   145,     3,     4,     5,     6,     7,     8,    -1,    -1,
+     134,     3,     4,     5,     6,     7,     8,    -1,    -1,    -1,
+     144,    -1,   146,   147,   148,   149,   150,   151,   152,     3,
+       4,    -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    -1,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,
+      -1,    -1,    -1,   144,   145,     3,     4,     5,     6,     7,
+       8,    -1,   144,   145,     3,     4,     5,     6,     7,     8,
+       3,     4,     5,     6,     7,     8,    -1,    -1,    -1,    -1,
+     144,    -1,   146,   147,   148,   149,   150,   151,   152,     3,
+       4,    -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    -1,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+       3,     4,     5,     6,     7,     8,   144,   145,     3,     4,
+       5,     6,     7,     8,    -1,   144,   145,    -1,    -1,    -1,
       -1,   144,   145,     3,     4,     5,     6,     7,     8,     3,
-       4,     5,     6,     7,     8,    -1,    -1,    -1,    -1,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-      -1,    -1,    -1,    -1,    -1,    -1,    11,    -1,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    -1,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,     3,
-       4,     5,     6,     7,     8,   144,   145,     3,     4,     5,
-       6,     7,     8,    -1,   144,   145,    -1,    -1,    -1,    -1,
-     144,   145,     3,     4,     5,     6,     7,     8,     3,     4,
-       5,     6,     7,     8,    -1,    -1,    -1,    -1,    -1,   144,
-      -1,   146,   147,   148,   149,   150,   151,   152,     3,     4,
-       5,     6,     7,     8,     3,     4,     5,     6,     7,     8,
-       3,     4,     5,     6,     7,     8,     3,     4,     5,     6,
-       7,     8,     3,     4,     5,     6,     7,     8,     3,     4,
-       5,     6,     7,     8,     3,     4,     5,     6,     7,     8,
-       3,     4,     5,     6,     7,     8,     3,     4,     5,     6,
-       7,     8,     3,     4,     5,     6,     7,     8,     3,     4,
-       5,     6,     7,     8,     3,     4,     5,     6,     7,     8,
+       4,     5,     6,     7,     8,    -1,    -1,    -1,    -1,    -1,
+     144,    -1,   146,   147,   148,   149,   150,   151,   152,     3,
+       4,     5,     6,     7,     8,     3,     4,     5,     6,     7,
+       8,     3,     4,     5,     6,     7,     8,     3,     4,     5,
+       6,     7,     8,     3,     4,     5,     6,     7,     8,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     144,   145,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   144,   145,    -1,    -1,    -1,    15,   144,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   144,   145,    -1,    -1,    -1,    -1,    -1,    -1,   144,
      145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,
-     145,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,
-      -1,   144,   145,    -1,    -1,    -1,    -1,   144,   145,    -1,
-      -1,    -1,    -1,   144,   145,    -1,    -1,    -1,    -1,   144,
-     145,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,
-      -1,   144,   145,    -1,    -1,    -1,    -1,   144,   145,    -1,
-      -1,    -1,    -1,   144,   145,    -1,    -1,    -1,    -1,   144,
-     145,    -1,    -1,    -1,    -1,   144,   145,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144
+      -1,    -1,    -1,    -1,   144,   145,    -1,    -1,    -1,    -1,
+     144,   145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     144,   145,    -1,    -1,    -1,    -1,   144,   145,    -1,    -1,
+      -1,    -1,   144,   145,    -1,    -1,    -1,    -1,   144,   145,
+      -1,    -1,    -1,    -1,   144,   145,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,   144,   154,   155,   160,   161,   162,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
-     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
-     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,     3,
-       4,    11,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   146,   147,   148,   149,   150,   151,   152,   160,   161,
-     162,     0,   161,   162,   161,   162,     3,     4,     5,     6,
-       7,     8,   144,   145,   156,   158,   160,   165,   145,   158,
-     156,   157,   156,   157,   156,   157,   156,   168,   169,   156,
-     156,   156,   145,   145,   145,   156,   156,   156,   145,   144,
-     158,   162,   158,   162,   158,   162,   158,   144,   145,   158,
-     299,   161,   156,   145,   144,   162,   162,   158,   162,   156,
-     162,   156,   156,   157,   156,   157,   156,   162,   156,   157,
-     156,   162,   162,   162,   158,   157,   156,   145,   158,   158,
-     162,   156,   145,   158,   145,   158,   158,   157,   156,   157,
-     157,   156,   156,   158,   157,   157,   157,   156,   157,   157,
-     157,   156,   157,   157,   156,   157,   156,   156,   157,   156,
-     156,   156,   145,   156,   162,   157,     3,   145,   162,   162,
-     145,   162,   162,   145,   162,   145,   162,   162,   145,   162,
-     158,   156,   156,   157,   156,   157,   157,     3,   166,   157,
-     159,   156,   156,   162,   156,   156,   145,   158,   145,   161,
-     158,   158,   145,   145,   158,   156,   145,   158,   156,   145,
-     145,   145,   156,   157,   156,   157,   145,   158,   145,   156,
-     156,   145,   156,   145,   145,   145,   156,   145,   158,   145,
-     157,   145,   156,   157,   156,   156,   157,   156,   145,   145,
-     158,   145,   156,   158,   157,   158,   158,   156,   157,   156,
-     157,   156,   157,   145,   145,   145,    15,   160,   145,   156,
-     145,   145,   156,   145,   145,   145,   145,   145,   144,   145,
-     156,   162,   163,   145,   145,   144,   163,   164,   161,   161,
-     145,   145,   145,   162,   145,   162,   158,   162,   145,   162,
-     158,   145,   162,   158,   145,   145,   299,   145,   158,   145,
-     161,    15,   145,   145,   145,   162,   158,   145,   162,   156,
-     145,   161,   144,   145,   301,   144,   145,   301,   145,   162,
-     156,   145,   162,   145,   162,   162,   145,   156,   145,   145,
-     145,   145,   162,   145,   145,   145,   162,   158,   145,   145,
-     145,   145,   145,   145,   145,   145,   145,   158,   145,   145,
-     145,   145,   145,   157,   145,   156,   157,   145,   145,   145,
-     145,   145,   145,   145,   145,   145,   145,   145,   144,   145,
-     309,   145,   145,     3,   145,   155,   167,   145,   145,   145,
+       0,   144,   154,   155,   156,   162,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   312,   313,   314,     3,     4,
+      11,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   146,   147,   148,   149,   150,   151,   152,   162,   163,
+     164,   173,     0,   156,     3,     4,     5,     6,     7,     8,
+     144,   145,   158,   160,   162,   168,   145,   160,   158,   159,
+     158,   159,   158,   159,   158,   171,   172,   158,   158,   158,
+     145,   145,   145,   158,   158,   158,   145,   144,   160,   164,
+     160,   164,   160,   164,   160,   144,   145,   160,   302,   162,
+     163,   158,   145,   144,   164,   164,   160,   164,   158,   164,
+     158,   158,   159,   158,   159,   158,   164,   158,   159,   158,
+     164,   164,   164,   160,   159,   158,   145,   160,   160,   164,
+     158,   145,   160,   145,   160,   160,   159,   158,   159,   159,
+     158,   158,   160,   159,   159,   159,   158,   159,   159,   159,
+     158,   159,   159,   158,   159,   158,   158,   159,   158,   158,
+     158,   145,   158,   164,   159,     3,   145,   164,   164,   145,
+     164,   164,   145,   164,   145,   164,   164,   145,   164,   160,
+     158,   158,   159,   158,   159,   159,     3,   169,   159,   161,
+     158,   158,   164,   158,   158,   145,   160,   145,   163,   160,
+     160,   145,   145,   160,   158,   145,   160,   158,   145,   145,
+     145,   158,   159,   158,   159,   145,   160,   145,   158,   158,
+     145,   158,   145,   145,   145,   158,   145,   160,   145,   159,
+     145,   158,   159,   158,   158,   159,   158,   145,   145,   160,
+     145,   158,   163,   164,   160,   159,   160,   160,   158,   159,
+     158,   159,   158,   159,   145,   144,   145,   162,   173,   144,
+     162,   173,    15,   162,   145,   158,   145,   145,   158,   145,
+     145,   145,   145,   145,   144,   145,   158,   165,   166,   173,
+     145,   145,   144,   166,   167,   163,   163,   145,   145,   145,
+     164,   145,   164,   144,   160,   145,   164,   160,   145,   164,
+     160,   145,   145,   302,   145,   160,   145,   163,    15,   144,
+     145,   145,   145,   164,   160,   145,   164,   158,   145,   163,
+     144,   145,   304,   144,   145,   304,   145,   164,   158,   145,
+     164,   145,   164,   164,   145,   158,   145,   145,   145,   145,
+     164,   145,   145,   145,   164,   160,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   160,   145,   145,   145,   145,
+     145,   159,   145,   158,   159,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   144,   145,   312,   145,
+     145,     3,   145,   157,   163,   170,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     158,   145,   166,     3,   145,   145,   158,   145,   145,   164,
+     158,   145,   145,   145,   145,   145,   145,   145,   145,   145,
      145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
-     145,   156,   145,   163,     3,   145,   145,   157,   145,   145,
-     162,   156,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   145,   145,   144,   145,   274,
      145,   145,   145,   145,   145,   145,   145,   145,   145,   145,
-     145,   145,   145,   145,   145,   145,   145,   145,   144,   145,
-     271,   145,   145,   145,   145,   145,   145,   145,   145,   145,
-     145,   145,   145,   156,   161,   145,   162,   163,   145,   163,
-     145,   145,   145,   145,   162,   145,   145,   162,   145,   145,
-     162,   145,   145,   145,   156,   145,   145,   162,   145,   145,
-     145,   145,   145,   145,   145,   162,   145,   145,   145,   145,
-     162,   145,   145,   145,   162,   145,   145,   145,   158,   145,
-     145,     3,   145,   155,   145,   163,   145,   145,   162,   145,
-     145,   165,   145,   145,   145,   145,   145,   145,   145,   145,
-     145,   145,   145,   145
+     145,   145,   145,   145,   163,   164,   163,   164,   158,   163,
+     164,   145,   164,   166,   145,   166,   145,   145,   145,   164,
+     145,   164,   145,   145,   164,   145,   145,   164,   145,   145,
+     145,   158,   145,   145,   164,   145,   145,   145,   145,   145,
+     145,   145,   164,   145,   145,   145,   145,   164,   145,   145,
+     145,   164,   145,   145,   145,   160,   145,   145,     3,   145,
+     157,   145,   166,   158,   145,   145,   164,   145,   145,   145,
+     145,   145,   145,   168,   145,   145,   145,   145,   145,   144,
+     145,   145,   145,   145,   145,   145,   145,   145,   164
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   153,   154,   155,   156,   156,   157,   158,   158,   159,
-     159,   160,   160,   161,   161,   161,   161,   161,   162,   162,
-     162,   163,   163,   163,   164,   164,   165,   165,   165,   165,
-     165,   165,   166,   166,   167,   167,   168,   169,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   170,   170,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   172,   173,
-     174,   175,   176,   176,   177,   177,   178,   178,   179,   179,
-     180,   180,   181,   181,   182,   182,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   191,   192,   193,   193,   193,
-     193,   194,   194,   194,   194,   195,   195,   195,   195,   196,
-     197,   197,   197,   197,   197,   198,   199,   200,   201,   202,
-     203,   203,   203,   203,   204,   204,   204,   205,   206,   207,
-     207,   207,   207,   208,   208,   208,   208,   209,   209,   209,
-     209,   210,   210,   210,   210,   211,   212,   213,   214,   214,
-     215,   216,   216,   217,   217,   217,   217,   218,   219,   219,
-     220,   220,   221,   222,   223,   224,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   234,   235,   236,   236,
-     237,   238,   238,   239,   240,   240,   241,   242,   243,   244,
-     244,   244,   245,   246,   247,   247,   247,   247,   248,   248,
-     249,   249,   250,   251,   251,   252,   253,   253,   254,   254,
-     255,   256,   256,   257,   258,   259,   259,   260,   261,   262,
-     263,   263,   264,   265,   266,   267,   268,   268,   268,   268,
-     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
-     278,   279,   280,   280,   281,   282,   283,   284,   285,   286,
-     287,   288,   289,   289,   290,   291,   292,   293,   293,   294,
-     295,   296,   297,   298,   298,   299,   300,   301,   302,   303,
-     304,   305,   305,   306,   306,   307,   308,   308,   309,   310,
-     311,   311
+       0,   153,   154,   155,   155,   156,   156,   156,   157,   158,
+     158,   159,   160,   160,   161,   161,   162,   162,   163,   163,
+     163,   163,   163,   163,   163,   163,   164,   164,   164,   164,
+     165,   165,   166,   166,   166,   167,   167,   168,   168,   168,
+     168,   168,   168,   169,   169,   170,   170,   171,   172,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   174,   174,   175,
+     176,   177,   178,   179,   179,   180,   180,   181,   181,   182,
+     182,   183,   183,   184,   184,   185,   185,   185,   186,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,   196,
+     196,   196,   197,   197,   197,   197,   198,   198,   198,   198,
+     199,   200,   200,   200,   200,   200,   201,   202,   203,   204,
+     205,   206,   206,   206,   206,   207,   207,   207,   208,   209,
+     210,   210,   210,   210,   211,   211,   211,   211,   212,   212,
+     212,   212,   213,   213,   213,   213,   214,   215,   216,   217,
+     217,   218,   219,   219,   220,   220,   220,   220,   221,   222,
+     222,   223,   223,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   235,   236,   237,   237,   238,   239,
+     239,   240,   241,   241,   242,   243,   243,   244,   245,   246,
+     247,   247,   247,   248,   249,   250,   250,   250,   250,   251,
+     251,   252,   252,   253,   254,   254,   255,   256,   256,   257,
+     257,   258,   259,   259,   260,   261,   262,   262,   263,   264,
+     265,   266,   266,   267,   268,   269,   270,   271,   271,   271,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   281,   282,   283,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   292,   292,   293,   294,   295,   296,   296,
+     297,   298,   299,   300,   301,   301,   302,   303,   304,   305,
+     306,   307,   308,   308,   309,   309,   310,   311,   311,   312,
+     313,   314,   314
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
-       0,     2,     1,     1,     1,     1,     2,     2,     1,     2,
-       1,     1,     3,     2,     2,     2,     1,     3,     2,     1,
-       3,     3,     4,     1,     1,     2,     1,     1,     1,     1,
-       1,     1,     3,     2,     2,     1,     2,     3,     1,     1,
+       0,     2,     1,     2,     1,     1,     1,     3,     1,     1,
+       1,     2,     2,     1,     3,     1,     1,     3,     2,     2,
+       4,     4,     2,     4,     1,     3,     2,     4,     1,     3,
+       1,     3,     3,     4,     1,     1,     2,     1,     1,     1,
+       1,     1,     1,     3,     2,     2,     1,     2,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -1649,40 +1829,41 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     5,     5,     5,
-       3,     3,     3,     4,     4,     4,     3,     5,     5,     6,
-       4,     5,     5,     6,     4,     5,     5,     6,     4,     4,
-       5,     5,     4,     4,     3,     4,     3,     5,     4,     4,
-       5,     5,     6,     4,     4,     5,     5,     4,     5,     5,
-       4,     5,     4,     5,     5,     6,     4,     5,     4,     5,
-       4,     5,     5,     6,     4,     4,     4,     4,     5,     4,
-       4,     4,     3,     5,     5,     6,     4,     4,     4,     3,
-       4,     3,     4,     4,     4,     4,     4,     4,     5,     4,
-       4,     4,     4,     4,     5,     4,     5,     6,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     3,
-       4,     5,     4,     4,     6,     5,     5,     4,     4,     3,
-       3,     4,     4,     3,     4,     4,     3,     4,     3,     4,
-       4,     3,     4,     4,     4,     4,     3,     4,     4,     4,
-       4,     5,     4,     4,     4,     4,     4,     5,     5,     6,
-       4,     4,     3,     4,     3,     4,     4,     4,     3,     4,
-       3,     4,     4,     3,     4,     3,     3,     3,     4,     4,
-       4,     4,     4,     3,     3,     4,     4,     3,     4,     3,
-       3,     3,     4,     4,     3,     3,     4,     3,     4,     4,
-       4,     4,     4,     4,     5,     3,     4,     3,     3,     4,
-       5,     6
+       4,     4,     4,     4,     4,     4,     4,     4,     5,     5,
+       5,     3,     3,     3,     4,     4,     4,     3,     5,     5,
+       6,     4,     5,     5,     6,     4,     5,     5,     6,     4,
+       4,     5,     5,     4,     4,     3,     4,     3,     5,     4,
+       4,     5,     5,     6,     4,     4,     5,     5,     4,     5,
+       5,     4,     5,     4,     5,     5,     6,     4,     5,     4,
+       5,     4,     5,     5,     6,     4,     4,     4,     4,     5,
+       4,     4,     4,     3,     5,     5,     6,     4,     4,     4,
+       3,     4,     3,     4,     4,     4,     4,     4,     4,     5,
+       4,     4,     4,     4,     4,     5,     4,     5,     6,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       3,     4,     5,     4,     4,     6,     5,     5,     4,     4,
+       3,     3,     4,     4,     3,     4,     4,     3,     4,     3,
+       4,     4,     3,     4,     4,     4,     4,     3,     4,     4,
+       4,     4,     5,     4,     4,     4,     4,     4,     5,     5,
+       6,     4,     4,     3,     4,     3,     4,     4,     4,     3,
+       4,     3,     4,     4,     3,     4,     3,     3,     3,     4,
+       4,     4,     4,     4,     3,     3,     4,     4,     3,     4,
+       3,     3,     3,     4,     4,     3,     3,     4,     3,     4,
+       4,     4,     4,     4,     4,     5,     3,     4,     3,     3,
+       4,     5,     6
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -1704,10 +1885,9 @@ static const yytype_int8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1724,19 +1904,16 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, scanner); \
+                  Kind, Value, scanner); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -1747,19 +1924,16 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, yyscan_t scanner)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (scanner);
+  YY_USE (yyoutput);
+  YY_USE (scanner);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -1769,12 +1943,13 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, yy
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, yyscan_t scanner)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep, scanner);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner);
   YYFPRINTF (yyo, ")");
 }
 
@@ -1807,7 +1982,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule, yyscan_t scanner)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, yyscan_t scanner)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -1819,9 +1995,8 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule, yyscan_t scanner
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              , scanner);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1836,8 +2011,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1860,12 +2035,60 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
 static YYPTRDIFF_T
 yystrlen (const char *yystr)
@@ -1875,13 +2098,13 @@ yystrlen (const char *yystr)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1895,10 +2118,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1913,7 +2136,6 @@ yytnamerr (char *yyres, const char *yystr)
     {
       YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1947,31 +2169,15 @@ yytnamerr (char *yyres, const char *yystr)
   else
     return yystrlen (yystr);
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
   /* Actual size of YYARG. */
   int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1995,52 +2201,54 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
     default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
@@ -2048,17 +2256,23 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -2067,7 +2281,7 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -2079,7 +2293,7 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
@@ -2090,982 +2304,1001 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, yyscan_t scanner)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner)
 {
-  YYUSE (yyvaluep);
-  YYUSE (scanner);
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  switch (yytype)
+  switch (yykind)
     {
-    case 3: /* SYM  */
-#line 73 "../src/parser.y"
+    case YYSYMBOL_SYM: /* SYM  */
+#line 76 "../src/parser.y"
             { free(((*yyvaluep).s)); }
-#line 2115 "parser.c"
+#line 2330 "parser.c"
         break;
 
-    case 4: /* STR  */
-#line 73 "../src/parser.y"
+    case YYSYMBOL_STR: /* STR  */
+#line 76 "../src/parser.y"
             { free(((*yyvaluep).s)); }
-#line 2121 "parser.c"
+#line 2336 "parser.c"
         break;
 
-    case 154: /* start  */
-#line 71 "../src/parser.y"
+    case YYSYMBOL_start: /* start  */
+#line 72 "../src/parser.y"
             { run(((*yyvaluep).e));  }
-#line 2127 "parser.c"
+#line 2342 "parser.c"
+        break;
+
+    case YYSYMBOL_top: /* top  */
+#line 74 "../src/parser.y"
+            { stop(((*yyvaluep).e)); }
+#line 2348 "parser.c"
+        break;
+
+    case YYSYMBOL_tps: /* tps  */
+#line 78 "../src/parser.y"
+            { kill(((*yyvaluep).e)); }
+#line 2354 "parser.c"
+        break;
+
+    case YYSYMBOL_s: /* s  */
+#line 78 "../src/parser.y"
+            { kill(((*yyvaluep).e)); }
+#line 2360 "parser.c"
         break;
 
-    case 155: /* s  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_p: /* p  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2133 "parser.c"
+#line 2366 "parser.c"
         break;
 
-    case 156: /* p  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_pp: /* pp  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2139 "parser.c"
+#line 2372 "parser.c"
         break;
 
-    case 157: /* pp  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_ps: /* ps  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2145 "parser.c"
+#line 2378 "parser.c"
         break;
 
-    case 158: /* ps  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_pps: /* pps  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2151 "parser.c"
+#line 2384 "parser.c"
         break;
 
-    case 159: /* pps  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_vp: /* vp  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2157 "parser.c"
+#line 2390 "parser.c"
         break;
 
-    case 160: /* vp  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_vps: /* vps  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2163 "parser.c"
+#line 2396 "parser.c"
         break;
 
-    case 161: /* vps  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_opts: /* opts  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2169 "parser.c"
+#line 2402 "parser.c"
         break;
 
-    case 162: /* opts  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_xopt: /* xopt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2175 "parser.c"
+#line 2408 "parser.c"
         break;
 
-    case 163: /* xpb  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_xpb: /* xpb  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2181 "parser.c"
+#line 2414 "parser.c"
         break;
 
-    case 164: /* xpbs  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_xpbs: /* xpbs  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2187 "parser.c"
+#line 2420 "parser.c"
         break;
 
-    case 165: /* np  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_np: /* np  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2193 "parser.c"
+#line 2426 "parser.c"
         break;
 
-    case 166: /* sps  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_sps: /* sps  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2199 "parser.c"
+#line 2432 "parser.c"
         break;
 
-    case 167: /* par  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_par: /* par  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2205 "parser.c"
+#line 2438 "parser.c"
         break;
 
-    case 168: /* cv  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_cv: /* cv  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2211 "parser.c"
+#line 2444 "parser.c"
         break;
 
-    case 169: /* cvv  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_cvv: /* cvv  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2217 "parser.c"
+#line 2450 "parser.c"
         break;
 
-    case 170: /* opt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_opt: /* opt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2223 "parser.c"
+#line 2456 "parser.c"
         break;
 
-    case 171: /* ivp  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_ivp: /* ivp  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2229 "parser.c"
+#line 2462 "parser.c"
         break;
 
-    case 172: /* add  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_add: /* add  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2235 "parser.c"
+#line 2468 "parser.c"
         break;
 
-    case 173: /* div  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_div: /* div  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2241 "parser.c"
+#line 2474 "parser.c"
         break;
 
-    case 174: /* mul  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_mul: /* mul  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2247 "parser.c"
+#line 2480 "parser.c"
         break;
 
-    case 175: /* sub  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_sub: /* sub  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2253 "parser.c"
+#line 2486 "parser.c"
         break;
 
-    case 176: /* eq  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_eq: /* eq  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2259 "parser.c"
+#line 2492 "parser.c"
         break;
 
-    case 177: /* gt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_gt: /* gt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2265 "parser.c"
+#line 2498 "parser.c"
         break;
 
-    case 178: /* gte  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_gte: /* gte  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2271 "parser.c"
+#line 2504 "parser.c"
         break;
 
-    case 179: /* lt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_lt: /* lt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2277 "parser.c"
+#line 2510 "parser.c"
         break;
 
-    case 180: /* lte  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_lte: /* lte  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2283 "parser.c"
+#line 2516 "parser.c"
         break;
 
-    case 181: /* neq  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_neq: /* neq  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2289 "parser.c"
+#line 2522 "parser.c"
         break;
 
-    case 182: /* if  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_if: /* if  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2295 "parser.c"
+#line 2528 "parser.c"
         break;
 
-    case 183: /* select  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_select: /* select  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2301 "parser.c"
+#line 2534 "parser.c"
         break;
 
-    case 184: /* until  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_until: /* until  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2307 "parser.c"
+#line 2540 "parser.c"
         break;
 
-    case 185: /* while  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_while: /* while  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2313 "parser.c"
+#line 2546 "parser.c"
         break;
 
-    case 186: /* trace  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_trace: /* trace  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2319 "parser.c"
+#line 2552 "parser.c"
         break;
 
-    case 187: /* retrace  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_retrace: /* retrace  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2325 "parser.c"
+#line 2558 "parser.c"
         break;
 
-    case 188: /* astraw  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_astraw: /* astraw  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2331 "parser.c"
+#line 2564 "parser.c"
         break;
 
-    case 189: /* asbraw  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_asbraw: /* asbraw  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2337 "parser.c"
+#line 2570 "parser.c"
         break;
 
-    case 190: /* asbeval  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_asbeval: /* asbeval  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2343 "parser.c"
+#line 2576 "parser.c"
         break;
 
-    case 191: /* eval  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_eval: /* eval  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2349 "parser.c"
+#line 2582 "parser.c"
         break;
 
-    case 192: /* options  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_options: /* options  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2355 "parser.c"
+#line 2588 "parser.c"
         break;
 
-    case 193: /* execute  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_execute: /* execute  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2361 "parser.c"
+#line 2594 "parser.c"
         break;
 
-    case 194: /* rexx  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_rexx: /* rexx  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2367 "parser.c"
+#line 2600 "parser.c"
         break;
 
-    case 195: /* run  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_run: /* run  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2373 "parser.c"
+#line 2606 "parser.c"
         break;
 
-    case 196: /* abort  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_abort: /* abort  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2379 "parser.c"
+#line 2612 "parser.c"
         break;
 
-    case 197: /* exit  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_exit: /* exit  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2385 "parser.c"
+#line 2618 "parser.c"
         break;
 
-    case 198: /* onerror  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_onerror: /* onerror  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2391 "parser.c"
+#line 2624 "parser.c"
         break;
 
-    case 199: /* reboot  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_reboot: /* reboot  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2397 "parser.c"
+#line 2630 "parser.c"
         break;
 
-    case 200: /* trap  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_trap: /* trap  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2403 "parser.c"
+#line 2636 "parser.c"
         break;
 
-    case 201: /* copyfiles  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_copyfiles: /* copyfiles  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2409 "parser.c"
+#line 2642 "parser.c"
         break;
 
-    case 202: /* copylib  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_copylib: /* copylib  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2415 "parser.c"
+#line 2648 "parser.c"
         break;
 
-    case 203: /* delete  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_delete: /* delete  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2421 "parser.c"
+#line 2654 "parser.c"
         break;
 
-    case 204: /* exists  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_exists: /* exists  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2427 "parser.c"
+#line 2660 "parser.c"
         break;
 
-    case 205: /* fileonly  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_fileonly: /* fileonly  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2433 "parser.c"
+#line 2666 "parser.c"
         break;
 
-    case 206: /* foreach  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_foreach: /* foreach  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2439 "parser.c"
+#line 2672 "parser.c"
         break;
 
-    case 207: /* makeassign  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_makeassign: /* makeassign  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2445 "parser.c"
+#line 2678 "parser.c"
         break;
 
-    case 208: /* makedir  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_makedir: /* makedir  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2451 "parser.c"
+#line 2684 "parser.c"
         break;
 
-    case 209: /* protect  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_protect: /* protect  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2457 "parser.c"
+#line 2690 "parser.c"
         break;
 
-    case 210: /* startup  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_startup: /* startup  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2463 "parser.c"
+#line 2696 "parser.c"
         break;
 
-    case 211: /* textfile  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_textfile: /* textfile  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2469 "parser.c"
+#line 2702 "parser.c"
         break;
 
-    case 212: /* tooltype  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_tooltype: /* tooltype  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2475 "parser.c"
+#line 2708 "parser.c"
         break;
 
-    case 213: /* transcript  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_transcript: /* transcript  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2481 "parser.c"
+#line 2714 "parser.c"
         break;
 
-    case 214: /* rename  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_rename: /* rename  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2487 "parser.c"
+#line 2720 "parser.c"
         break;
 
-    case 215: /* complete  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_complete: /* complete  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2493 "parser.c"
+#line 2726 "parser.c"
         break;
 
-    case 216: /* debug  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_debug: /* debug  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2499 "parser.c"
+#line 2732 "parser.c"
         break;
 
-    case 217: /* message  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_message: /* message  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2505 "parser.c"
+#line 2738 "parser.c"
         break;
 
-    case 218: /* user  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_user: /* user  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2511 "parser.c"
+#line 2744 "parser.c"
         break;
 
-    case 219: /* welcome  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_welcome: /* welcome  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2517 "parser.c"
+#line 2750 "parser.c"
         break;
 
-    case 220: /* working  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_working: /* working  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2523 "parser.c"
+#line 2756 "parser.c"
         break;
 
-    case 221: /* and  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_and: /* and  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2529 "parser.c"
+#line 2762 "parser.c"
         break;
 
-    case 222: /* bitand  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_bitand: /* bitand  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2535 "parser.c"
+#line 2768 "parser.c"
         break;
 
-    case 223: /* bitnot  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_bitnot: /* bitnot  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2541 "parser.c"
+#line 2774 "parser.c"
         break;
 
-    case 224: /* bitor  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_bitor: /* bitor  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2547 "parser.c"
+#line 2780 "parser.c"
         break;
 
-    case 225: /* bitxor  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_bitxor: /* bitxor  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2553 "parser.c"
+#line 2786 "parser.c"
         break;
 
-    case 226: /* not  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_not: /* not  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2559 "parser.c"
+#line 2792 "parser.c"
         break;
 
-    case 227: /* in  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_in: /* in  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2565 "parser.c"
+#line 2798 "parser.c"
         break;
 
-    case 228: /* or  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_or: /* or  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2571 "parser.c"
+#line 2804 "parser.c"
         break;
 
-    case 229: /* shiftleft  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_shiftleft: /* shiftleft  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2577 "parser.c"
+#line 2810 "parser.c"
         break;
 
-    case 230: /* shiftright  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_shiftright: /* shiftright  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2583 "parser.c"
+#line 2816 "parser.c"
         break;
 
-    case 231: /* xor  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_xor: /* xor  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2589 "parser.c"
+#line 2822 "parser.c"
         break;
 
-    case 232: /* closemedia  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_closemedia: /* closemedia  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2595 "parser.c"
+#line 2828 "parser.c"
         break;
 
-    case 233: /* effect  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_effect: /* effect  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2601 "parser.c"
+#line 2834 "parser.c"
         break;
 
-    case 234: /* setmedia  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_setmedia: /* setmedia  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2607 "parser.c"
+#line 2840 "parser.c"
         break;
 
-    case 235: /* showmedia  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_showmedia: /* showmedia  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2613 "parser.c"
+#line 2846 "parser.c"
         break;
 
-    case 236: /* database  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_database: /* database  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2619 "parser.c"
+#line 2852 "parser.c"
         break;
 
-    case 237: /* earlier  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_earlier: /* earlier  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2625 "parser.c"
+#line 2858 "parser.c"
         break;
 
-    case 238: /* getassign  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getassign: /* getassign  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2631 "parser.c"
+#line 2864 "parser.c"
         break;
 
-    case 239: /* getdevice  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getdevice: /* getdevice  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2637 "parser.c"
+#line 2870 "parser.c"
         break;
 
-    case 240: /* getdiskspace  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getdiskspace: /* getdiskspace  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2643 "parser.c"
+#line 2876 "parser.c"
         break;
 
-    case 241: /* getenv  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getenv: /* getenv  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2649 "parser.c"
+#line 2882 "parser.c"
         break;
 
-    case 242: /* getsize  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getsize: /* getsize  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2655 "parser.c"
+#line 2888 "parser.c"
         break;
 
-    case 243: /* getsum  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getsum: /* getsum  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2661 "parser.c"
+#line 2894 "parser.c"
         break;
 
-    case 244: /* getversion  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getversion: /* getversion  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2667 "parser.c"
+#line 2900 "parser.c"
         break;
 
-    case 245: /* iconinfo  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_iconinfo: /* iconinfo  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2673 "parser.c"
+#line 2906 "parser.c"
         break;
 
-    case 246: /* querydisplay  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_querydisplay: /* querydisplay  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2679 "parser.c"
+#line 2912 "parser.c"
         break;
 
-    case 247: /* dcl  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_dcl: /* dcl  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2685 "parser.c"
+#line 2918 "parser.c"
         break;
 
-    case 248: /* cus  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_cus: /* cus  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2691 "parser.c"
+#line 2924 "parser.c"
         break;
 
-    case 249: /* askbool  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askbool: /* askbool  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2697 "parser.c"
+#line 2930 "parser.c"
         break;
 
-    case 250: /* askchoice  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askchoice: /* askchoice  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2703 "parser.c"
+#line 2936 "parser.c"
         break;
 
-    case 251: /* askdir  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askdir: /* askdir  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2709 "parser.c"
+#line 2942 "parser.c"
         break;
 
-    case 252: /* askdisk  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askdisk: /* askdisk  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2715 "parser.c"
+#line 2948 "parser.c"
         break;
 
-    case 253: /* askfile  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askfile: /* askfile  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2721 "parser.c"
+#line 2954 "parser.c"
         break;
 
-    case 254: /* asknumber  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_asknumber: /* asknumber  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2727 "parser.c"
+#line 2960 "parser.c"
         break;
 
-    case 255: /* askoptions  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askoptions: /* askoptions  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2733 "parser.c"
+#line 2966 "parser.c"
         break;
 
-    case 256: /* askstring  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_askstring: /* askstring  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2739 "parser.c"
+#line 2972 "parser.c"
         break;
 
-    case 257: /* cat  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_cat: /* cat  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2745 "parser.c"
+#line 2978 "parser.c"
         break;
 
-    case 258: /* expandpath  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_expandpath: /* expandpath  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2751 "parser.c"
+#line 2984 "parser.c"
         break;
 
-    case 259: /* fmt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_fmt: /* fmt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2757 "parser.c"
+#line 2990 "parser.c"
         break;
 
-    case 260: /* pathonly  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_pathonly: /* pathonly  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2763 "parser.c"
+#line 2996 "parser.c"
         break;
 
-    case 261: /* patmatch  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_patmatch: /* patmatch  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2769 "parser.c"
+#line 3002 "parser.c"
         break;
 
-    case 262: /* strlen  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_strlen: /* strlen  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2775 "parser.c"
+#line 3008 "parser.c"
         break;
 
-    case 263: /* substr  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_substr: /* substr  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2781 "parser.c"
+#line 3014 "parser.c"
         break;
 
-    case 264: /* tackon  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_tackon: /* tackon  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2787 "parser.c"
+#line 3020 "parser.c"
         break;
 
-    case 265: /* set  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_set: /* set  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2793 "parser.c"
+#line 3026 "parser.c"
         break;
 
-    case 266: /* symbolset  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_symbolset: /* symbolset  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2799 "parser.c"
+#line 3032 "parser.c"
         break;
 
-    case 267: /* symbolval  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_symbolval: /* symbolval  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2805 "parser.c"
+#line 3038 "parser.c"
         break;
 
-    case 268: /* openwbobject  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_openwbobject: /* openwbobject  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2811 "parser.c"
+#line 3044 "parser.c"
         break;
 
-    case 269: /* showwbobject  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_showwbobject: /* showwbobject  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2817 "parser.c"
+#line 3050 "parser.c"
         break;
 
-    case 270: /* closewbobject  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_closewbobject: /* closewbobject  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2823 "parser.c"
+#line 3056 "parser.c"
         break;
 
-    case 271: /* all  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_all: /* all  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2829 "parser.c"
+#line 3062 "parser.c"
         break;
 
-    case 272: /* append  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_append: /* append  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2835 "parser.c"
+#line 3068 "parser.c"
         break;
 
-    case 273: /* assigns  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_assigns: /* assigns  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2841 "parser.c"
+#line 3074 "parser.c"
         break;
 
-    case 274: /* back  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_back: /* back  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2847 "parser.c"
+#line 3080 "parser.c"
         break;
 
-    case 275: /* choices  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_choices: /* choices  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2853 "parser.c"
+#line 3086 "parser.c"
         break;
 
-    case 276: /* command  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_command: /* command  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2859 "parser.c"
+#line 3092 "parser.c"
         break;
 
-    case 277: /* compression  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_compression: /* compression  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2865 "parser.c"
+#line 3098 "parser.c"
         break;
 
-    case 278: /* confirm  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_confirm: /* confirm  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2871 "parser.c"
+#line 3104 "parser.c"
         break;
 
-    case 279: /* default  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_default: /* default  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2877 "parser.c"
+#line 3110 "parser.c"
         break;
 
-    case 280: /* delopts  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_delopts: /* delopts  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2883 "parser.c"
+#line 3116 "parser.c"
         break;
 
-    case 281: /* dest  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_dest: /* dest  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2889 "parser.c"
+#line 3122 "parser.c"
         break;
 
-    case 282: /* disk  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_disk: /* disk  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2895 "parser.c"
+#line 3128 "parser.c"
         break;
 
-    case 283: /* files  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_files: /* files  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2901 "parser.c"
+#line 3134 "parser.c"
         break;
 
-    case 284: /* fonts  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_fonts: /* fonts  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2907 "parser.c"
+#line 3140 "parser.c"
         break;
 
-    case 285: /* getdefaulttool  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getdefaulttool: /* getdefaulttool  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2913 "parser.c"
+#line 3146 "parser.c"
         break;
 
-    case 286: /* getposition  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getposition: /* getposition  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2919 "parser.c"
+#line 3152 "parser.c"
         break;
 
-    case 287: /* getstack  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_getstack: /* getstack  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2925 "parser.c"
+#line 3158 "parser.c"
         break;
 
-    case 288: /* gettooltype  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_gettooltype: /* gettooltype  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2931 "parser.c"
+#line 3164 "parser.c"
         break;
 
-    case 289: /* help  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_help: /* help  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2937 "parser.c"
+#line 3170 "parser.c"
         break;
 
-    case 290: /* infos  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_infos: /* infos  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2943 "parser.c"
+#line 3176 "parser.c"
         break;
 
-    case 291: /* include  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_include: /* include  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2949 "parser.c"
+#line 3182 "parser.c"
         break;
 
-    case 292: /* newname  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_newname: /* newname  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2955 "parser.c"
+#line 3188 "parser.c"
         break;
 
-    case 293: /* newpath  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_newpath: /* newpath  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2961 "parser.c"
+#line 3194 "parser.c"
         break;
 
-    case 294: /* nogauge  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_nogauge: /* nogauge  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2967 "parser.c"
+#line 3200 "parser.c"
         break;
 
-    case 295: /* noposition  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_noposition: /* noposition  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2973 "parser.c"
+#line 3206 "parser.c"
         break;
 
-    case 296: /* noreq  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_noreq: /* noreq  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2979 "parser.c"
+#line 3212 "parser.c"
         break;
 
-    case 297: /* pattern  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_pattern: /* pattern  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2985 "parser.c"
+#line 3218 "parser.c"
         break;
 
-    case 298: /* prompt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_prompt: /* prompt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2991 "parser.c"
+#line 3224 "parser.c"
         break;
 
-    case 299: /* quiet  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_quiet: /* quiet  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 2997 "parser.c"
+#line 3230 "parser.c"
         break;
 
-    case 300: /* range  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_range: /* range  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3003 "parser.c"
+#line 3236 "parser.c"
         break;
 
-    case 301: /* safe  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_safe: /* safe  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3009 "parser.c"
+#line 3242 "parser.c"
         break;
 
-    case 302: /* setdefaulttool  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_setdefaulttool: /* setdefaulttool  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3015 "parser.c"
+#line 3248 "parser.c"
         break;
 
-    case 303: /* setposition  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_setposition: /* setposition  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3021 "parser.c"
+#line 3254 "parser.c"
         break;
 
-    case 304: /* setstack  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_setstack: /* setstack  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3027 "parser.c"
+#line 3260 "parser.c"
         break;
 
-    case 305: /* settooltype  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_settooltype: /* settooltype  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3033 "parser.c"
+#line 3266 "parser.c"
         break;
 
-    case 306: /* source  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_source: /* source  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3039 "parser.c"
+#line 3272 "parser.c"
         break;
 
-    case 307: /* swapcolors  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_swapcolors: /* swapcolors  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3045 "parser.c"
+#line 3278 "parser.c"
         break;
 
-    case 308: /* optional  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_optional: /* optional  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3051 "parser.c"
+#line 3284 "parser.c"
         break;
 
-    case 309: /* resident  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_resident: /* resident  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3057 "parser.c"
+#line 3290 "parser.c"
         break;
 
-    case 310: /* override  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_override: /* override  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3063 "parser.c"
+#line 3296 "parser.c"
         break;
 
-    case 311: /* dynopt  */
-#line 75 "../src/parser.y"
+    case YYSYMBOL_dynopt: /* dynopt  */
+#line 78 "../src/parser.y"
             { kill(((*yyvaluep).e)); }
-#line 3069 "parser.c"
+#line 3302 "parser.c"
         break;
 
       default:
@@ -3077,6 +3310,8 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, yyscan_t scanner)
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -3084,7 +3319,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, yyscan_t scanner)
 int
 yyparse (yyscan_t scanner)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -3095,45 +3330,41 @@ YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
 YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
-
-    YYPTRDIFF_T yystacksize;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
   YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3141,16 +3372,10 @@ YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -3172,10 +3397,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -3203,7 +3429,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -3214,10 +3440,10 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -3236,6 +3462,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -3256,18 +3483,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3336,1479 +3574,1545 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 2:
-#line 87 "../src/parser.y"
-                                                 { (yyval.e) = init((yyvsp[0].e)); }
-#line 3343 "parser.c"
+  case 2: /* start: top  */
+#line 90 "../src/parser.y"
+                                                 { (yyval.e) = stream((yyvsp[0].e), NULL); }
+#line 3581 "parser.c"
     break;
 
-  case 6:
-#line 94 "../src/parser.y"
-                                                 { (yyval.e) = push(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[0].e)); }
-#line 3349 "parser.c"
+  case 3: /* top: top tps  */
+#line 91 "../src/parser.y"
+                                                 { (yyval.e) = stream((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3587 "parser.c"
     break;
 
-  case 7:
-#line 95 "../src/parser.y"
-                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
-#line 3355 "parser.c"
+  case 4: /* top: tps  */
+#line 92 "../src/parser.y"
+                                                 { (yyval.e) = stream(NULL, (yyvsp[0].e)); }
+#line 3593 "parser.c"
     break;
 
-  case 8:
-#line 96 "../src/parser.y"
+  case 5: /* tps: vp  */
+#line 93 "../src/parser.y"
                                                  { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
-#line 3361 "parser.c"
+#line 3599 "parser.c"
     break;
 
-  case 9:
-#line 97 "../src/parser.y"
-                                                 { (yyval.e) = merge((yyvsp[-1].e), (yyvsp[0].e)); }
-#line 3367 "parser.c"
+  case 6: /* tps: opt  */
+#line 94 "../src/parser.y"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3605 "parser.c"
     break;
 
-  case 12:
-#line 100 "../src/parser.y"
+  case 7: /* tps: '(' vps ')'  */
+#line 95 "../src/parser.y"
                                                  { (yyval.e) = (yyvsp[-1].e); }
-#line 3373 "parser.c"
-    break;
-
-  case 13:
-#line 101 "../src/parser.y"
-                                                 { (yyval.e) = merge((yyvsp[-1].e), (yyvsp[0].e)); }
-#line 3379 "parser.c"
+#line 3611 "parser.c"
     break;
 
-  case 14:
+  case 11: /* pp: p p  */
 #line 102 "../src/parser.y"
-                                                 { (yyval.e) = merge((yyvsp[-1].e), (yyvsp[0].e));  }
-#line 3385 "parser.c"
+                                                 { (yyval.e) = push(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[0].e)); }
+#line 3617 "parser.c"
     break;
 
-  case 15:
+  case 12: /* ps: ps p  */
 #line 103 "../src/parser.y"
-                                                 { (yyval.e) = merge((yyvsp[-1].e), (yyvsp[0].e));  }
-#line 3391 "parser.c"
+                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3623 "parser.c"
     break;
 
-  case 16:
+  case 13: /* ps: p  */
 #line 104 "../src/parser.y"
                                                  { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
-#line 3397 "parser.c"
+#line 3629 "parser.c"
     break;
 
-  case 17:
+  case 14: /* pps: pps p p  */
 #line 105 "../src/parser.y"
-                                                 { (yyval.e) = (yyvsp[-1].e); }
-#line 3403 "parser.c"
-    break;
-
-  case 18:
-#line 106 "../src/parser.y"
-                                                 { (yyval.e) = merge((yyvsp[-1].e), (yyvsp[0].e)); }
-#line 3409 "parser.c"
+                                                 { (yyval.e) = push(push((yyvsp[-2].e), (yyvsp[-1].e)), (yyvsp[0].e)); }
+#line 3635 "parser.c"
     break;
 
-  case 19:
-#line 107 "../src/parser.y"
-                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
-#line 3415 "parser.c"
-    break;
-
-  case 20:
+  case 17: /* vp: '(' vp ')'  */
 #line 108 "../src/parser.y"
                                                  { (yyval.e) = (yyvsp[-1].e); }
-#line 3421 "parser.c"
+#line 3641 "parser.c"
     break;
 
-  case 21:
+  case 18: /* vps: vps vp  */
 #line 109 "../src/parser.y"
-                                                 { (yyval.e) = (yyvsp[-1].e); }
-#line 3427 "parser.c"
+                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3647 "parser.c"
     break;
 
-  case 22:
+  case 19: /* vps: vps opt  */
 #line 110 "../src/parser.y"
-                                                 { (yyval.e) = push((yyvsp[-2].e), (yyvsp[-1].e)); }
-#line 3433 "parser.c"
+                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3653 "parser.c"
     break;
 
-  case 23:
+  case 20: /* vps: vps '(' vps ')'  */
 #line 111 "../src/parser.y"
-                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
-#line 3439 "parser.c"
+                                                 { (yyval.e) = merge((yyvsp[-3].e), (yyvsp[-1].e)); }
+#line 3659 "parser.c"
     break;
 
-  case 24:
+  case 21: /* vps: vps '(' opts ')'  */
 #line 112 "../src/parser.y"
-                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
-#line 3445 "parser.c"
+                                                 { (yyval.e) = merge((yyvsp[-3].e), (yyvsp[-1].e)); }
+#line 3665 "parser.c"
     break;
 
-  case 25:
+  case 22: /* vps: opts vp  */
 #line 113 "../src/parser.y"
                                                  { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
-#line 3451 "parser.c"
+#line 3671 "parser.c"
     break;
 
-  case 26:
+  case 23: /* vps: opts '(' vps ')'  */
 #line 114 "../src/parser.y"
-                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
-#line 3457 "parser.c"
+                                                 { (yyval.e) = merge((yyvsp[-3].e), (yyvsp[-1].e)); }
+#line 3677 "parser.c"
     break;
 
-  case 27:
+  case 24: /* vps: vp  */
 #line 115 "../src/parser.y"
-                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
-#line 3463 "parser.c"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3683 "parser.c"
     break;
 
-  case 28:
+  case 25: /* vps: '(' vps ')'  */
 #line 116 "../src/parser.y"
-                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
-#line 3469 "parser.c"
+                                                 { (yyval.e) = (yyvsp[-1].e); }
+#line 3689 "parser.c"
     break;
 
-  case 29:
+  case 26: /* opts: opts opt  */
 #line 117 "../src/parser.y"
-                                                 { (yyval.e) = new_string((yyvsp[0].s)); }
-#line 3475 "parser.c"
+                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3695 "parser.c"
     break;
 
-  case 30:
+  case 27: /* opts: opts '(' opts ')'  */
 #line 118 "../src/parser.y"
-                                                 { (yyval.e) = new_symref((yyvsp[0].s), LINE); }
-#line 3481 "parser.c"
+                                                 { (yyval.e) = merge((yyvsp[-3].e), (yyvsp[-1].e)); }
+#line 3701 "parser.c"
     break;
 
-  case 31:
+  case 28: /* opts: opt  */
 #line 119 "../src/parser.y"
-                                                 { (yyval.e) = NULL; YYFPRINTF(stderr, "Out of memory in line %d\n", LINE); YYABORT; }
-#line 3487 "parser.c"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3707 "parser.c"
     break;
 
-  case 32:
+  case 29: /* opts: '(' opts ')'  */
 #line 120 "../src/parser.y"
-                                                 { (yyval.e) = push(push((yyvsp[-2].e), new_symbol((yyvsp[-1].s))), (yyvsp[0].e)) ; }
-#line 3493 "parser.c"
+                                                 { (yyval.e) = (yyvsp[-1].e); }
+#line 3713 "parser.c"
     break;
 
-  case 33:
+  case 30: /* xopt: opt  */
 #line 121 "../src/parser.y"
-                                                 { (yyval.e) = push(push(new_contxt(), new_symbol((yyvsp[-1].s))), (yyvsp[0].e)); }
-#line 3499 "parser.c"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3719 "parser.c"
     break;
 
-  case 34:
+  case 31: /* xopt: '(' opts ')'  */
 #line 122 "../src/parser.y"
-                                                 { (yyval.e) = push((yyvsp[-1].e), new_symbol((yyvsp[0].s))); }
-#line 3505 "parser.c"
+                                                 { (yyval.e) = (yyvsp[-1].e); }
+#line 3725 "parser.c"
     break;
 
-  case 35:
+  case 32: /* xpb: '(' vps ')'  */
 #line 123 "../src/parser.y"
-                                                 { (yyval.e) = push(new_contxt(), new_symbol((yyvsp[0].s))); }
-#line 3511 "parser.c"
+                                                 { (yyval.e) = (yyvsp[-1].e); }
+#line 3731 "parser.c"
     break;
 
-  case 36:
+  case 33: /* xpb: '(' vps np ')'  */
 #line 124 "../src/parser.y"
-                                                 { (yyval.e) = push(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[0].e)); }
-#line 3517 "parser.c"
+                                                 { (yyval.e) = push((yyvsp[-2].e), (yyvsp[-1].e)); }
+#line 3737 "parser.c"
     break;
 
-  case 37:
+  case 34: /* xpb: p  */
 #line 125 "../src/parser.y"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3743 "parser.c"
+    break;
+
+  case 35: /* xpbs: xpb  */
+#line 126 "../src/parser.y"
+                                                 { (yyval.e) = push(new_contxt(), (yyvsp[0].e)); }
+#line 3749 "parser.c"
+    break;
+
+  case 36: /* xpbs: xpbs xpb  */
+#line 127 "../src/parser.y"
+                                                 { (yyval.e) = push((yyvsp[-1].e), (yyvsp[0].e)); }
+#line 3755 "parser.c"
+    break;
+
+  case 37: /* np: INT  */
+#line 128 "../src/parser.y"
+                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
+#line 3761 "parser.c"
+    break;
+
+  case 38: /* np: HEX  */
+#line 129 "../src/parser.y"
+                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
+#line 3767 "parser.c"
+    break;
+
+  case 39: /* np: BIN  */
+#line 130 "../src/parser.y"
+                                                 { (yyval.e) = new_number((yyvsp[0].n)); }
+#line 3773 "parser.c"
+    break;
+
+  case 40: /* np: STR  */
+#line 131 "../src/parser.y"
+                                                 { (yyval.e) = new_string((yyvsp[0].s)); }
+#line 3779 "parser.c"
+    break;
+
+  case 41: /* np: SYM  */
+#line 132 "../src/parser.y"
+                                                 { (yyval.e) = new_symref((yyvsp[0].s), LINE); }
+#line 3785 "parser.c"
+    break;
+
+  case 42: /* np: OOM  */
+#line 133 "../src/parser.y"
+                                                 { (yyval.e) = NULL; YYFPRINTF(stderr, "Out of memory in line %d\n", LINE); YYABORT; }
+#line 3791 "parser.c"
+    break;
+
+  case 43: /* sps: sps SYM xpb  */
+#line 134 "../src/parser.y"
+                                                 { (yyval.e) = push(push((yyvsp[-2].e), new_symbol((yyvsp[-1].s))), (yyvsp[0].e)) ; }
+#line 3797 "parser.c"
+    break;
+
+  case 44: /* sps: SYM xpb  */
+#line 135 "../src/parser.y"
+                                                 { (yyval.e) = push(push(new_contxt(), new_symbol((yyvsp[-1].s))), (yyvsp[0].e)); }
+#line 3803 "parser.c"
+    break;
+
+  case 45: /* par: par SYM  */
+#line 136 "../src/parser.y"
+                                                 { (yyval.e) = push((yyvsp[-1].e), new_symbol((yyvsp[0].s))); }
+#line 3809 "parser.c"
+    break;
+
+  case 46: /* par: SYM  */
+#line 137 "../src/parser.y"
+                                                 { (yyval.e) = push(new_contxt(), new_symbol((yyvsp[0].s))); }
+#line 3815 "parser.c"
+    break;
+
+  case 47: /* cv: p xpb  */
+#line 138 "../src/parser.y"
+                                                 { (yyval.e) = push(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[0].e)); }
+#line 3821 "parser.c"
+    break;
+
+  case 48: /* cvv: p xpb xpb  */
+#line 139 "../src/parser.y"
                                                  { (yyval.e) = push(push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), (yyvsp[0].e)); }
-#line 3523 "parser.c"
+#line 3827 "parser.c"
     break;
 
-  case 178:
-#line 275 "../src/parser.y"
+  case 189: /* add: '(' '+' ps ')'  */
+#line 289 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("+"), LINE, n_add, (yyvsp[-1].e), NUMBER); }
-#line 3529 "parser.c"
+#line 3833 "parser.c"
     break;
 
-  case 179:
-#line 276 "../src/parser.y"
+  case 190: /* div: '(' '/' pp ')'  */
+#line 290 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("/"), LINE, n_div, (yyvsp[-1].e), NUMBER); }
-#line 3535 "parser.c"
+#line 3839 "parser.c"
     break;
 
-  case 180:
-#line 277 "../src/parser.y"
+  case 191: /* mul: '(' '*' ps ')'  */
+#line 291 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("*"), LINE, n_mul, (yyvsp[-1].e), NUMBER); }
-#line 3541 "parser.c"
+#line 3845 "parser.c"
     break;
 
-  case 181:
-#line 278 "../src/parser.y"
+  case 192: /* sub: '(' '-' ps ')'  */
+#line 292 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("-"), LINE, n_sub, (yyvsp[-1].e), NUMBER); }
-#line 3547 "parser.c"
+#line 3851 "parser.c"
     break;
 
-  case 182:
-#line 282 "../src/parser.y"
+  case 193: /* eq: '(' '=' pp ')'  */
+#line 296 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("="), LINE, n_eq, (yyvsp[-1].e), NUMBER); }
-#line 3553 "parser.c"
+#line 3857 "parser.c"
     break;
 
-  case 183:
-#line 283 "../src/parser.y"
+  case 194: /* eq: '(' '=' p ')'  */
+#line 297 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("="), LINE, n_eq, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3559 "parser.c"
+#line 3863 "parser.c"
     break;
 
-  case 184:
-#line 284 "../src/parser.y"
+  case 195: /* gt: '(' '>' pp ')'  */
+#line 298 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup(">"), LINE, n_gt, (yyvsp[-1].e), NUMBER); }
-#line 3565 "parser.c"
+#line 3869 "parser.c"
     break;
 
-  case 185:
-#line 285 "../src/parser.y"
+  case 196: /* gt: '(' '>' p ')'  */
+#line 299 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup(">"), LINE, n_gt, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3571 "parser.c"
+#line 3875 "parser.c"
     break;
 
-  case 186:
-#line 286 "../src/parser.y"
+  case 197: /* gte: '(' GTE pp ')'  */
+#line 300 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup(">="), LINE, n_gte, (yyvsp[-1].e), NUMBER); }
-#line 3577 "parser.c"
+#line 3881 "parser.c"
     break;
 
-  case 187:
-#line 287 "../src/parser.y"
+  case 198: /* gte: '(' GTE p ')'  */
+#line 301 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup(">="), LINE, n_gte, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3583 "parser.c"
+#line 3887 "parser.c"
     break;
 
-  case 188:
-#line 288 "../src/parser.y"
+  case 199: /* lt: '(' '<' pp ')'  */
+#line 302 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<"), LINE, n_lt, (yyvsp[-1].e), NUMBER); }
-#line 3589 "parser.c"
+#line 3893 "parser.c"
     break;
 
-  case 189:
-#line 289 "../src/parser.y"
+  case 200: /* lt: '(' '<' p ')'  */
+#line 303 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<"), LINE, n_lt, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3595 "parser.c"
+#line 3899 "parser.c"
     break;
 
-  case 190:
-#line 290 "../src/parser.y"
+  case 201: /* lte: '(' LTE pp ')'  */
+#line 304 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<="), LINE, n_lte, (yyvsp[-1].e), NUMBER); }
-#line 3601 "parser.c"
+#line 3905 "parser.c"
     break;
 
-  case 191:
-#line 291 "../src/parser.y"
+  case 202: /* lte: '(' LTE p ')'  */
+#line 305 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<="), LINE, n_lte, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3607 "parser.c"
+#line 3911 "parser.c"
     break;
 
-  case 192:
-#line 292 "../src/parser.y"
+  case 203: /* neq: '(' NEQ pp ')'  */
+#line 306 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<>"), LINE, n_neq, (yyvsp[-1].e), NUMBER); }
-#line 3613 "parser.c"
+#line 3917 "parser.c"
     break;
 
-  case 193:
-#line 293 "../src/parser.y"
+  case 204: /* neq: '(' NEQ p ')'  */
+#line 307 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("<>"), LINE, n_neq, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3619 "parser.c"
+#line 3923 "parser.c"
     break;
 
-  case 194:
-#line 297 "../src/parser.y"
+  case 205: /* if: '(' IF cvv ')'  */
+#line 311 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("if"), LINE, n_if, (yyvsp[-1].e), NUMBER); }
-#line 3625 "parser.c"
+#line 3929 "parser.c"
     break;
 
-  case 195:
-#line 298 "../src/parser.y"
+  case 206: /* if: '(' IF cv ')'  */
+#line 312 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("if"), LINE, n_if, (yyvsp[-1].e), NUMBER); }
-#line 3631 "parser.c"
+#line 3935 "parser.c"
     break;
 
-  case 196:
-#line 299 "../src/parser.y"
+  case 207: /* if: '(' IF p ')'  */
+#line 313 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("if"), LINE, n_if, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3637 "parser.c"
+#line 3941 "parser.c"
     break;
 
-  case 197:
-#line 300 "../src/parser.y"
+  case 208: /* select: '(' SELECT p xpbs ')'  */
+#line 314 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("select"), LINE, n_select, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3643 "parser.c"
+#line 3947 "parser.c"
     break;
 
-  case 198:
-#line 301 "../src/parser.y"
+  case 209: /* until: '(' UNTIL p vps ')'  */
+#line 315 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("until"), LINE, n_until, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3649 "parser.c"
+#line 3953 "parser.c"
     break;
 
-  case 199:
-#line 302 "../src/parser.y"
+  case 210: /* while: '(' WHILE p vps ')'  */
+#line 316 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("while"), LINE, n_while, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3655 "parser.c"
+#line 3959 "parser.c"
     break;
 
-  case 200:
-#line 303 "../src/parser.y"
+  case 211: /* trace: '(' TRACE ')'  */
+#line 317 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("trace"), LINE, n_trace, NULL, NUMBER); }
-#line 3661 "parser.c"
+#line 3965 "parser.c"
     break;
 
-  case 201:
-#line 304 "../src/parser.y"
+  case 212: /* retrace: '(' RETRACE ')'  */
+#line 318 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("retrace"), LINE, n_retrace, NULL, NUMBER); }
-#line 3667 "parser.c"
+#line 3971 "parser.c"
     break;
 
-  case 202:
-#line 308 "../src/parser.y"
+  case 213: /* astraw: '(' ASTRAW ')'  */
+#line 322 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("___astraw"), LINE, n_astraw, NULL, NUMBER); }
-#line 3673 "parser.c"
+#line 3977 "parser.c"
     break;
 
-  case 203:
-#line 309 "../src/parser.y"
+  case 214: /* asbraw: '(' ASBRAW p ')'  */
+#line 323 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("___asbraw"), LINE, n_asbraw, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3679 "parser.c"
+#line 3983 "parser.c"
     break;
 
-  case 204:
-#line 310 "../src/parser.y"
+  case 215: /* asbeval: '(' ASBEVAL p ')'  */
+#line 324 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("___asbeval"), LINE, n_asbeval, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3685 "parser.c"
+#line 3989 "parser.c"
     break;
 
-  case 205:
-#line 311 "../src/parser.y"
+  case 216: /* eval: '(' EVAL p ')'  */
+#line 325 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("___eval"), LINE, n_eval, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3691 "parser.c"
+#line 3995 "parser.c"
     break;
 
-  case 206:
-#line 312 "../src/parser.y"
+  case 217: /* options: '(' OPTIONS ')'  */
+#line 326 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("___options"), LINE, n_options, NULL, NUMBER); }
-#line 3697 "parser.c"
+#line 4001 "parser.c"
     break;
 
-  case 207:
-#line 316 "../src/parser.y"
+  case 218: /* execute: '(' EXECUTE ps opts ')'  */
+#line 330 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("execute"), LINE, n_execute, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3703 "parser.c"
+#line 4007 "parser.c"
     break;
 
-  case 208:
-#line 317 "../src/parser.y"
+  case 219: /* execute: '(' EXECUTE opts ps ')'  */
+#line 331 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("execute"), LINE, n_execute, push((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 3709 "parser.c"
+#line 4013 "parser.c"
     break;
 
-  case 209:
-#line 318 "../src/parser.y"
+  case 220: /* execute: '(' EXECUTE opts ps opts ')'  */
+#line 332 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("execute"), LINE, n_execute, push((yyvsp[-2].e), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3715 "parser.c"
+#line 4019 "parser.c"
     break;
 
-  case 210:
-#line 319 "../src/parser.y"
+  case 221: /* execute: '(' EXECUTE ps ')'  */
+#line 333 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("execute"), LINE, n_execute, (yyvsp[-1].e), NUMBER); }
-#line 3721 "parser.c"
+#line 4025 "parser.c"
     break;
 
-  case 211:
-#line 320 "../src/parser.y"
+  case 222: /* rexx: '(' REXX ps opts ')'  */
+#line 334 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rexx"), LINE, n_rexx, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3727 "parser.c"
+#line 4031 "parser.c"
     break;
 
-  case 212:
-#line 321 "../src/parser.y"
+  case 223: /* rexx: '(' REXX opts ps ')'  */
+#line 335 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rexx"), LINE, n_rexx, push((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 3733 "parser.c"
+#line 4037 "parser.c"
     break;
 
-  case 213:
-#line 322 "../src/parser.y"
+  case 224: /* rexx: '(' REXX opts ps opts ')'  */
+#line 336 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rexx"), LINE, n_rexx, push((yyvsp[-2].e), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3739 "parser.c"
+#line 4043 "parser.c"
     break;
 
-  case 214:
-#line 323 "../src/parser.y"
+  case 225: /* rexx: '(' REXX ps ')'  */
+#line 337 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rexx"), LINE, n_rexx, (yyvsp[-1].e), NUMBER); }
-#line 3745 "parser.c"
+#line 4049 "parser.c"
     break;
 
-  case 215:
-#line 324 "../src/parser.y"
+  case 226: /* run: '(' RUN ps opts ')'  */
+#line 338 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("run"), LINE, n_run, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3751 "parser.c"
+#line 4055 "parser.c"
     break;
 
-  case 216:
-#line 325 "../src/parser.y"
+  case 227: /* run: '(' RUN opts ps ')'  */
+#line 339 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("run"), LINE, n_run, push((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 3757 "parser.c"
+#line 4061 "parser.c"
     break;
 
-  case 217:
-#line 326 "../src/parser.y"
+  case 228: /* run: '(' RUN opts ps opts ')'  */
+#line 340 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("run"), LINE, n_run, push((yyvsp[-2].e), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3763 "parser.c"
+#line 4067 "parser.c"
     break;
 
-  case 218:
-#line 327 "../src/parser.y"
+  case 229: /* run: '(' RUN ps ')'  */
+#line 341 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("run"), LINE, n_run, (yyvsp[-1].e), NUMBER); }
-#line 3769 "parser.c"
+#line 4073 "parser.c"
     break;
 
-  case 219:
-#line 331 "../src/parser.y"
+  case 230: /* abort: '(' ABORT ps ')'  */
+#line 345 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("abort"), LINE, n_abort, (yyvsp[-1].e), NUMBER); }
-#line 3775 "parser.c"
+#line 4079 "parser.c"
     break;
 
-  case 220:
-#line 332 "../src/parser.y"
+  case 231: /* exit: '(' EXIT ps quiet ')'  */
+#line 346 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exit"), LINE, n_exit, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3781 "parser.c"
+#line 4085 "parser.c"
     break;
 
-  case 221:
-#line 333 "../src/parser.y"
+  case 232: /* exit: '(' EXIT quiet ps ')'  */
+#line 347 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exit"), LINE, n_exit, push((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 3787 "parser.c"
+#line 4091 "parser.c"
     break;
 
-  case 222:
-#line 334 "../src/parser.y"
+  case 233: /* exit: '(' EXIT quiet ')'  */
+#line 348 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exit"), LINE, n_exit, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3793 "parser.c"
+#line 4097 "parser.c"
     break;
 
-  case 223:
-#line 335 "../src/parser.y"
+  case 234: /* exit: '(' EXIT ps ')'  */
+#line 349 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exit"), LINE, n_exit, (yyvsp[-1].e), NUMBER); }
-#line 3799 "parser.c"
+#line 4103 "parser.c"
     break;
 
-  case 224:
-#line 336 "../src/parser.y"
+  case 235: /* exit: '(' EXIT ')'  */
+#line 350 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exit"), LINE, n_exit, NULL, NUMBER); }
-#line 3805 "parser.c"
+#line 4109 "parser.c"
     break;
 
-  case 225:
-#line 337 "../src/parser.y"
+  case 236: /* onerror: '(' ONERROR vps ')'  */
+#line 351 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("onerror"), LINE, n_procedure, push(new_contxt(),
                                                         new_custom(strdup("@onerror"), LINE, NULL, (yyvsp[-1].e))), DANGLE); }
-#line 3812 "parser.c"
+#line 4116 "parser.c"
     break;
 
-  case 226:
-#line 339 "../src/parser.y"
+  case 237: /* reboot: '(' REBOOT ')'  */
+#line 353 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("reboot"), LINE, n_reboot, NULL, NUMBER); }
-#line 3818 "parser.c"
+#line 4122 "parser.c"
     break;
 
-  case 227:
-#line 340 "../src/parser.y"
+  case 238: /* trap: '(' TRAP p vps ')'  */
+#line 354 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("trap"), LINE, n_trap, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3824 "parser.c"
+#line 4128 "parser.c"
     break;
 
-  case 228:
-#line 344 "../src/parser.y"
+  case 239: /* copyfiles: '(' COPYFILES opts ')'  */
+#line 358 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("copyfiles"), LINE, n_copyfiles, (yyvsp[-1].e), STRING); }
-#line 3830 "parser.c"
+#line 4134 "parser.c"
     break;
 
-  case 229:
-#line 345 "../src/parser.y"
+  case 240: /* copylib: '(' COPYLIB opts ')'  */
+#line 359 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("copylib"), LINE, n_copylib, (yyvsp[-1].e), NUMBER); }
-#line 3836 "parser.c"
+#line 4140 "parser.c"
     break;
 
-  case 230:
-#line 346 "../src/parser.y"
+  case 241: /* delete: '(' DELETE ps opts ')'  */
+#line 360 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("delete"), LINE, n_delete, merge((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3842 "parser.c"
+#line 4146 "parser.c"
     break;
 
-  case 231:
-#line 347 "../src/parser.y"
+  case 242: /* delete: '(' DELETE opts ps ')'  */
+#line 361 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("delete"), LINE, n_delete, merge((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 3848 "parser.c"
+#line 4152 "parser.c"
     break;
 
-  case 232:
-#line 348 "../src/parser.y"
+  case 243: /* delete: '(' DELETE opts ps opts ')'  */
+#line 362 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("delete"), LINE, n_delete, merge((yyvsp[-2].e), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3854 "parser.c"
+#line 4158 "parser.c"
     break;
 
-  case 233:
-#line 349 "../src/parser.y"
+  case 244: /* delete: '(' DELETE ps ')'  */
+#line 363 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("delete"), LINE, n_delete, (yyvsp[-1].e), NUMBER); }
-#line 3860 "parser.c"
+#line 4164 "parser.c"
     break;
 
-  case 234:
-#line 350 "../src/parser.y"
+  case 245: /* exists: '(' EXISTS p ')'  */
+#line 364 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("exists"), LINE, n_exists, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3866 "parser.c"
+#line 4170 "parser.c"
     break;
 
-  case 235:
-#line 351 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("exists"), LINE, n_exists, merge(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3872 "parser.c"
+  case 246: /* exists: '(' EXISTS p opts ')'  */
+#line 365 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("exists"), LINE, n_exists, unshift((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
+#line 4176 "parser.c"
     break;
 
-  case 236:
-#line 352 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("exists"), LINE, n_exists, merge(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
-#line 3878 "parser.c"
+  case 247: /* exists: '(' EXISTS opts p ')'  */
+#line 366 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("exists"), LINE, n_exists, unshift((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
+#line 4182 "parser.c"
     break;
 
-  case 237:
-#line 353 "../src/parser.y"
+  case 248: /* fileonly: '(' FILEONLY p ')'  */
+#line 367 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("fileonly"), LINE, n_fileonly, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 3884 "parser.c"
+#line 4188 "parser.c"
     break;
 
-  case 238:
-#line 354 "../src/parser.y"
+  case 249: /* foreach: '(' FOREACH pp vps ')'  */
+#line 368 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("foreach"), LINE, n_foreach, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3890 "parser.c"
+#line 4194 "parser.c"
     break;
 
-  case 239:
-#line 355 "../src/parser.y"
+  case 250: /* makeassign: '(' MAKEASSIGN pp safe ')'  */
+#line 369 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("makeassign"), LINE, n_makeassign, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3896 "parser.c"
+#line 4200 "parser.c"
     break;
 
-  case 240:
-#line 356 "../src/parser.y"
+  case 251: /* makeassign: '(' MAKEASSIGN pp ')'  */
+#line 370 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("makeassign"), LINE, n_makeassign, (yyvsp[-1].e), NUMBER); }
-#line 3902 "parser.c"
+#line 4206 "parser.c"
     break;
 
-  case 241:
-#line 357 "../src/parser.y"
+  case 252: /* makeassign: '(' MAKEASSIGN p safe ')'  */
+#line 371 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("makeassign"), LINE, n_makeassign, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3908 "parser.c"
+#line 4212 "parser.c"
     break;
 
-  case 242:
-#line 358 "../src/parser.y"
+  case 253: /* makeassign: '(' MAKEASSIGN p ')'  */
+#line 372 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("makeassign"), LINE, n_makeassign, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3914 "parser.c"
+#line 4218 "parser.c"
     break;
 
-  case 243:
-#line 359 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3920 "parser.c"
+  case 254: /* makedir: '(' MAKEDIR p opts ')'  */
+#line 373 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, unshift((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
+#line 4224 "parser.c"
     break;
 
-  case 244:
-#line 360 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
-#line 3926 "parser.c"
+  case 255: /* makedir: '(' MAKEDIR opts p ')'  */
+#line 374 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, unshift((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
+#line 4230 "parser.c"
     break;
 
-  case 245:
-#line 361 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), (yyvsp[-2].e)), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3932 "parser.c"
+  case 256: /* makedir: '(' MAKEDIR opts p opts ')'  */
+#line 375 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, unshift(merge((yyvsp[-3].e), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
+#line 4236 "parser.c"
     break;
 
-  case 246:
-#line 362 "../src/parser.y"
+  case 257: /* makedir: '(' MAKEDIR p ')'  */
+#line 376 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("makedir"), LINE, n_makedir, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3938 "parser.c"
+#line 4242 "parser.c"
     break;
 
-  case 247:
-#line 363 "../src/parser.y"
+  case 258: /* protect: '(' PROTECT pp opts ')'  */
+#line 377 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("protect"), LINE, n_protect, merge((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 3944 "parser.c"
+#line 4248 "parser.c"
     break;
 
-  case 248:
-#line 364 "../src/parser.y"
+  case 259: /* protect: '(' PROTECT pp ')'  */
+#line 378 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("protect"), LINE, n_protect, (yyvsp[-1].e), NUMBER); }
-#line 3950 "parser.c"
+#line 4254 "parser.c"
     break;
 
-  case 249:
-#line 365 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("protect"), LINE, n_protect, merge(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3956 "parser.c"
+  case 260: /* protect: '(' PROTECT p opts ')'  */
+#line 379 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("protect"), LINE, n_protect, unshift((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
+#line 4260 "parser.c"
     break;
 
-  case 250:
-#line 366 "../src/parser.y"
+  case 261: /* protect: '(' PROTECT p ')'  */
+#line 380 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("protect"), LINE, n_protect, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 3962 "parser.c"
+#line 4266 "parser.c"
     break;
 
-  case 251:
-#line 367 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 3968 "parser.c"
+  case 262: /* startup: '(' STARTUP p opts ')'  */
+#line 381 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, unshift((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
+#line 4272 "parser.c"
     break;
 
-  case 252:
-#line 368 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
-#line 3974 "parser.c"
+  case 263: /* startup: '(' STARTUP opts p ')'  */
+#line 382 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, unshift((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
+#line 4278 "parser.c"
     break;
 
-  case 253:
-#line 369 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), (yyvsp[-2].e)), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 3980 "parser.c"
+  case 264: /* startup: '(' STARTUP opts p opts ')'  */
+#line 383 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, unshift(merge((yyvsp[-3].e), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
+#line 4284 "parser.c"
     break;
 
-  case 254:
-#line 370 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), new_symref(strdup("@app-name"), LINE)), (yyvsp[-1].e)), NUMBER); }
-#line 3986 "parser.c"
+  case 265: /* startup: '(' STARTUP opts ')'  */
+#line 384 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("startup"), LINE, n_startup, unshift((yyvsp[-1].e), new_symref(strdup("@app-name"), LINE)), NUMBER); }
+#line 4290 "parser.c"
     break;
 
-  case 255:
-#line 371 "../src/parser.y"
+  case 266: /* textfile: '(' TEXTFILE opts ')'  */
+#line 385 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("textfile"), LINE, n_textfile, (yyvsp[-1].e), NUMBER); }
-#line 3992 "parser.c"
+#line 4296 "parser.c"
     break;
 
-  case 256:
-#line 372 "../src/parser.y"
+  case 267: /* tooltype: '(' TOOLTYPE opts ')'  */
+#line 386 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("tooltype"), LINE, n_tooltype, (yyvsp[-1].e), NUMBER); }
-#line 3998 "parser.c"
+#line 4302 "parser.c"
     break;
 
-  case 257:
-#line 373 "../src/parser.y"
+  case 268: /* transcript: '(' TRANSCRIPT ps ')'  */
+#line 387 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("transcript"), LINE, n_transcript, (yyvsp[-1].e), NUMBER); }
-#line 4004 "parser.c"
+#line 4308 "parser.c"
     break;
 
-  case 258:
-#line 374 "../src/parser.y"
+  case 269: /* rename: '(' RENAME pp opts ')'  */
+#line 388 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rename"), LINE, n_rename, merge((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 4010 "parser.c"
+#line 4314 "parser.c"
     break;
 
-  case 259:
-#line 375 "../src/parser.y"
+  case 270: /* rename: '(' RENAME pp ')'  */
+#line 389 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("rename"), LINE, n_rename, (yyvsp[-1].e), NUMBER); }
-#line 4016 "parser.c"
+#line 4320 "parser.c"
     break;
 
-  case 260:
-#line 379 "../src/parser.y"
+  case 271: /* complete: '(' COMPLETE p ')'  */
+#line 393 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("complete"), LINE, n_complete, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4022 "parser.c"
+#line 4326 "parser.c"
     break;
 
-  case 261:
-#line 380 "../src/parser.y"
+  case 272: /* debug: '(' DEBUG ps ')'  */
+#line 394 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("debug"), LINE, n_debug, (yyvsp[-1].e), NUMBER); }
-#line 4028 "parser.c"
+#line 4332 "parser.c"
     break;
 
-  case 262:
-#line 381 "../src/parser.y"
+  case 273: /* debug: '(' DEBUG ')'  */
+#line 395 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("debug"), LINE, n_debug, NULL, NUMBER); }
-#line 4034 "parser.c"
+#line 4338 "parser.c"
     break;
 
-  case 263:
-#line 382 "../src/parser.y"
+  case 274: /* message: '(' MESSAGE ps opts ')'  */
+#line 396 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("message"), LINE, n_message, merge((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
-#line 4040 "parser.c"
+#line 4344 "parser.c"
     break;
 
-  case 264:
-#line 383 "../src/parser.y"
+  case 275: /* message: '(' MESSAGE opts ps ')'  */
+#line 397 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("message"), LINE, n_message, merge((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 4046 "parser.c"
+#line 4350 "parser.c"
     break;
 
-  case 265:
-#line 384 "../src/parser.y"
+  case 276: /* message: '(' MESSAGE opts ps opts ')'  */
+#line 398 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("message"), LINE, n_message, push(merge((yyvsp[-3].e), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
-#line 4052 "parser.c"
+#line 4356 "parser.c"
     break;
 
-  case 266:
-#line 385 "../src/parser.y"
+  case 277: /* message: '(' MESSAGE ps ')'  */
+#line 399 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("message"), LINE, n_message, (yyvsp[-1].e), NUMBER); }
-#line 4058 "parser.c"
+#line 4362 "parser.c"
     break;
 
-  case 267:
-#line 386 "../src/parser.y"
+  case 278: /* user: '(' USER p ')'  */
+#line 400 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("user"), LINE, n_user, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4064 "parser.c"
+#line 4368 "parser.c"
     break;
 
-  case 268:
-#line 387 "../src/parser.y"
+  case 279: /* welcome: '(' WELCOME ps ')'  */
+#line 401 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("welcome"), LINE, n_welcome, (yyvsp[-1].e), NUMBER); }
-#line 4070 "parser.c"
+#line 4374 "parser.c"
     break;
 
-  case 269:
-#line 388 "../src/parser.y"
+  case 280: /* welcome: '(' WELCOME ')'  */
+#line 402 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("welcome"), LINE, n_welcome, NULL, NUMBER); }
-#line 4076 "parser.c"
+#line 4380 "parser.c"
     break;
 
-  case 270:
-#line 389 "../src/parser.y"
+  case 281: /* working: '(' WORKING ps ')'  */
+#line 403 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("working"), LINE, n_working, (yyvsp[-1].e), NUMBER); }
-#line 4082 "parser.c"
+#line 4386 "parser.c"
     break;
 
-  case 271:
-#line 390 "../src/parser.y"
+  case 282: /* working: '(' WORKING ')'  */
+#line 404 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("working"), LINE, n_working, NULL, NUMBER); }
-#line 4088 "parser.c"
+#line 4392 "parser.c"
     break;
 
-  case 272:
-#line 394 "../src/parser.y"
+  case 283: /* and: '(' AND ps ')'  */
+#line 408 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("AND"), LINE, n_and, (yyvsp[-1].e), NUMBER); }
-#line 4094 "parser.c"
+#line 4398 "parser.c"
     break;
 
-  case 273:
-#line 395 "../src/parser.y"
+  case 284: /* bitand: '(' BITAND pp ')'  */
+#line 409 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("BITAND"), LINE, n_bitand, (yyvsp[-1].e), NUMBER); }
-#line 4100 "parser.c"
+#line 4404 "parser.c"
     break;
 
-  case 274:
-#line 396 "../src/parser.y"
+  case 285: /* bitnot: '(' BITNOT p ')'  */
+#line 410 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("BITNOT"), LINE, n_bitnot, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4106 "parser.c"
+#line 4410 "parser.c"
     break;
 
-  case 275:
-#line 397 "../src/parser.y"
+  case 286: /* bitor: '(' BITOR pp ')'  */
+#line 411 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("BITOR"), LINE, n_bitor, (yyvsp[-1].e), NUMBER); }
-#line 4112 "parser.c"
+#line 4416 "parser.c"
     break;
 
-  case 276:
-#line 398 "../src/parser.y"
+  case 287: /* bitxor: '(' BITXOR pp ')'  */
+#line 412 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("BITXOR"), LINE, n_bitxor, (yyvsp[-1].e), NUMBER); }
-#line 4118 "parser.c"
+#line 4422 "parser.c"
     break;
 
-  case 277:
-#line 399 "../src/parser.y"
+  case 288: /* not: '(' NOT p ')'  */
+#line 413 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("NOT"), LINE, n_not, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4124 "parser.c"
+#line 4428 "parser.c"
     break;
 
-  case 278:
-#line 400 "../src/parser.y"
+  case 289: /* in: '(' IN p ps ')'  */
+#line 414 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("IN"), LINE, n_in, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 4130 "parser.c"
+#line 4434 "parser.c"
     break;
 
-  case 279:
-#line 401 "../src/parser.y"
+  case 290: /* or: '(' OR ps ')'  */
+#line 415 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("OR"), LINE, n_or, (yyvsp[-1].e), NUMBER); }
-#line 4136 "parser.c"
+#line 4440 "parser.c"
     break;
 
-  case 280:
-#line 402 "../src/parser.y"
+  case 291: /* shiftleft: '(' SHIFTLEFT pp ')'  */
+#line 416 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("shiftleft"), LINE, n_shiftleft, (yyvsp[-1].e), NUMBER); }
-#line 4142 "parser.c"
+#line 4446 "parser.c"
     break;
 
-  case 281:
-#line 403 "../src/parser.y"
+  case 292: /* shiftright: '(' SHIFTRIGHT pp ')'  */
+#line 417 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("shiftright"), LINE, n_shiftright, (yyvsp[-1].e), NUMBER); }
-#line 4148 "parser.c"
+#line 4452 "parser.c"
     break;
 
-  case 282:
-#line 404 "../src/parser.y"
+  case 293: /* xor: '(' XOR pp ')'  */
+#line 418 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("XOR"), LINE, n_xor, (yyvsp[-1].e), NUMBER); }
-#line 4154 "parser.c"
+#line 4458 "parser.c"
     break;
 
-  case 283:
-#line 408 "../src/parser.y"
+  case 294: /* closemedia: '(' CLOSEMEDIA p ')'  */
+#line 422 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("closemedia"), LINE, n_closemedia, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4160 "parser.c"
+#line 4464 "parser.c"
     break;
 
-  case 284:
-#line 409 "../src/parser.y"
+  case 295: /* effect: '(' EFFECT pp pp ')'  */
+#line 423 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("effect"), LINE, n_effect, merge((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 4166 "parser.c"
+#line 4470 "parser.c"
     break;
 
-  case 285:
-#line 410 "../src/parser.y"
+  case 296: /* setmedia: '(' SETMEDIA pp ')'  */
+#line 424 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("setmedia"), LINE, n_setmedia, (yyvsp[-1].e), NUMBER); }
-#line 4172 "parser.c"
+#line 4476 "parser.c"
     break;
 
-  case 286:
-#line 411 "../src/parser.y"
+  case 297: /* setmedia: '(' SETMEDIA pp p ')'  */
+#line 425 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("setmedia"), LINE, n_setmedia, push((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
-#line 4178 "parser.c"
+#line 4482 "parser.c"
     break;
 
-  case 287:
-#line 412 "../src/parser.y"
+  case 298: /* showmedia: '(' SHOWMEDIA pp pp ps ')'  */
+#line 426 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("showmedia"), LINE, n_showmedia, merge(merge((yyvsp[-3].e), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 4184 "parser.c"
+#line 4488 "parser.c"
     break;
 
-  case 288:
-#line 416 "../src/parser.y"
+  case 299: /* database: '(' DATABASE p ')'  */
+#line 430 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("database"), LINE, n_database, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4190 "parser.c"
+#line 4494 "parser.c"
     break;
 
-  case 289:
-#line 417 "../src/parser.y"
+  case 300: /* database: '(' DATABASE pp ')'  */
+#line 431 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("database"), LINE, n_database, (yyvsp[-1].e), STRING); }
-#line 4196 "parser.c"
+#line 4500 "parser.c"
     break;
 
-  case 290:
-#line 418 "../src/parser.y"
+  case 301: /* earlier: '(' EARLIER pp ')'  */
+#line 432 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("earlier"), LINE, n_earlier, (yyvsp[-1].e), NUMBER); }
-#line 4202 "parser.c"
+#line 4506 "parser.c"
     break;
 
-  case 291:
-#line 419 "../src/parser.y"
+  case 302: /* getassign: '(' GETASSIGN p ')'  */
+#line 433 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getassign"), LINE, n_getassign, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4208 "parser.c"
+#line 4512 "parser.c"
     break;
 
-  case 292:
-#line 420 "../src/parser.y"
+  case 303: /* getassign: '(' GETASSIGN pp ')'  */
+#line 434 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getassign"), LINE, n_getassign, (yyvsp[-1].e), STRING); }
-#line 4214 "parser.c"
+#line 4518 "parser.c"
     break;
 
-  case 293:
-#line 421 "../src/parser.y"
+  case 304: /* getdevice: '(' GETDEVICE p ')'  */
+#line 435 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getdevice"), LINE, n_getdevice, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4220 "parser.c"
+#line 4524 "parser.c"
     break;
 
-  case 294:
-#line 422 "../src/parser.y"
+  case 305: /* getdiskspace: '(' GETDISKSPACE p ')'  */
+#line 436 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getdiskspace"), LINE, n_getdiskspace, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4226 "parser.c"
+#line 4530 "parser.c"
     break;
 
-  case 295:
-#line 423 "../src/parser.y"
+  case 306: /* getdiskspace: '(' GETDISKSPACE pp ')'  */
+#line 437 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getdiskspace"), LINE, n_getdiskspace, (yyvsp[-1].e), NUMBER); }
-#line 4232 "parser.c"
+#line 4536 "parser.c"
     break;
 
-  case 296:
-#line 424 "../src/parser.y"
+  case 307: /* getenv: '(' GETENV p ')'  */
+#line 438 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getenv"), LINE, n_getenv, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4238 "parser.c"
+#line 4542 "parser.c"
     break;
 
-  case 297:
-#line 425 "../src/parser.y"
+  case 308: /* getsize: '(' GETSIZE p ')'  */
+#line 439 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getsize"), LINE, n_getsize, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4244 "parser.c"
+#line 4548 "parser.c"
     break;
 
-  case 298:
-#line 426 "../src/parser.y"
+  case 309: /* getsum: '(' GETSUM p ')'  */
+#line 440 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getsum"), LINE, n_getsum, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4250 "parser.c"
+#line 4554 "parser.c"
     break;
 
-  case 299:
-#line 427 "../src/parser.y"
+  case 310: /* getversion: '(' GETVERSION ')'  */
+#line 441 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getversion"), LINE, n_getversion, NULL, NUMBER); }
-#line 4256 "parser.c"
+#line 4560 "parser.c"
     break;
 
-  case 300:
-#line 428 "../src/parser.y"
+  case 311: /* getversion: '(' GETVERSION p ')'  */
+#line 442 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getversion"), LINE, n_getversion, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4262 "parser.c"
+#line 4566 "parser.c"
     break;
 
-  case 301:
-#line 429 "../src/parser.y"
+  case 312: /* getversion: '(' GETVERSION p resident ')'  */
+#line 443 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("getversion"), LINE, n_getversion, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 4268 "parser.c"
+#line 4572 "parser.c"
     break;
 
-  case 302:
-#line 430 "../src/parser.y"
+  case 313: /* iconinfo: '(' ICONINFO opts ')'  */
+#line 444 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("iconinfo"), LINE, n_iconinfo, (yyvsp[-1].e), NUMBER); }
-#line 4274 "parser.c"
+#line 4578 "parser.c"
     break;
 
-  case 303:
-#line 431 "../src/parser.y"
+  case 314: /* querydisplay: '(' QUERYDISPLAY pp ')'  */
+#line 445 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("querydisplay"), LINE, n_querydisplay, (yyvsp[-1].e), NUMBER); }
-#line 4280 "parser.c"
+#line 4584 "parser.c"
     break;
 
-  case 304:
-#line 435 "../src/parser.y"
+  case 315: /* dcl: '(' DCL SYM par s ')'  */
+#line 449 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("procedure"), LINE, n_procedure, push(new_contxt(), new_custom((yyvsp[-3].s), LINE, (yyvsp[-2].e), (yyvsp[-1].e))), NUMBER); }
-#line 4286 "parser.c"
+#line 4590 "parser.c"
     break;
 
-  case 305:
-#line 436 "../src/parser.y"
+  case 316: /* dcl: '(' DCL SYM par ')'  */
+#line 450 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("procedure"), LINE, n_procedure, push(new_contxt(), new_custom((yyvsp[-2].s), LINE, (yyvsp[-1].e), NULL)), NUMBER); }
-#line 4292 "parser.c"
+#line 4596 "parser.c"
     break;
 
-  case 306:
-#line 437 "../src/parser.y"
+  case 317: /* dcl: '(' DCL SYM s ')'  */
+#line 451 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("procedure"), LINE, n_procedure, push(new_contxt(), new_custom((yyvsp[-2].s), LINE, NULL, (yyvsp[-1].e))), NUMBER); }
-#line 4298 "parser.c"
+#line 4602 "parser.c"
     break;
 
-  case 307:
-#line 438 "../src/parser.y"
+  case 318: /* dcl: '(' DCL SYM ')'  */
+#line 452 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("procedure"), LINE, n_procedure, push(new_contxt(), new_custom((yyvsp[-1].s), LINE, NULL, NULL)), NUMBER); }
-#line 4304 "parser.c"
+#line 4608 "parser.c"
     break;
 
-  case 308:
-#line 439 "../src/parser.y"
+  case 319: /* cus: '(' SYM ps ')'  */
+#line 453 "../src/parser.y"
                                                  { (yyval.e) = new_cusref((yyvsp[-2].s), LINE, (yyvsp[-1].e)); }
-#line 4310 "parser.c"
+#line 4614 "parser.c"
     break;
 
-  case 309:
-#line 440 "../src/parser.y"
+  case 320: /* cus: '(' SYM ')'  */
+#line 454 "../src/parser.y"
                                                  { (yyval.e) = new_cusref((yyvsp[-1].s), LINE, NULL); }
-#line 4316 "parser.c"
+#line 4620 "parser.c"
     break;
 
-  case 310:
-#line 444 "../src/parser.y"
+  case 321: /* askbool: '(' ASKBOOL ')'  */
+#line 458 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askbool"), LINE, n_askbool, NULL, NUMBER); }
-#line 4322 "parser.c"
+#line 4626 "parser.c"
     break;
 
-  case 311:
-#line 445 "../src/parser.y"
+  case 322: /* askbool: '(' ASKBOOL opts ')'  */
+#line 459 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askbool"), LINE, n_askbool, (yyvsp[-1].e), NUMBER); }
-#line 4328 "parser.c"
+#line 4632 "parser.c"
     break;
 
-  case 312:
-#line 446 "../src/parser.y"
+  case 323: /* askchoice: '(' ASKCHOICE opts ')'  */
+#line 460 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askchoice"), LINE, n_askchoice, (yyvsp[-1].e), NUMBER); }
-#line 4334 "parser.c"
+#line 4638 "parser.c"
     break;
 
-  case 313:
-#line 447 "../src/parser.y"
+  case 324: /* askdir: '(' ASKDIR ')'  */
+#line 461 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askdir"), LINE, n_askdir, NULL, STRING); }
-#line 4340 "parser.c"
+#line 4644 "parser.c"
     break;
 
-  case 314:
-#line 448 "../src/parser.y"
+  case 325: /* askdir: '(' ASKDIR opts ')'  */
+#line 462 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askdir"), LINE, n_askdir, (yyvsp[-1].e), STRING); }
-#line 4346 "parser.c"
+#line 4650 "parser.c"
     break;
 
-  case 315:
-#line 449 "../src/parser.y"
+  case 326: /* askdisk: '(' ASKDISK opts ')'  */
+#line 463 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askdisk"), LINE, n_askdisk, (yyvsp[-1].e), NUMBER); }
-#line 4352 "parser.c"
+#line 4656 "parser.c"
     break;
 
-  case 316:
-#line 450 "../src/parser.y"
+  case 327: /* askfile: '(' ASKFILE ')'  */
+#line 464 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askfile"), LINE, n_askfile, NULL, STRING); }
-#line 4358 "parser.c"
+#line 4662 "parser.c"
     break;
 
-  case 317:
-#line 451 "../src/parser.y"
+  case 328: /* askfile: '(' ASKFILE opts ')'  */
+#line 465 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askfile"), LINE, n_askfile, (yyvsp[-1].e), STRING); }
-#line 4364 "parser.c"
+#line 4668 "parser.c"
     break;
 
-  case 318:
-#line 452 "../src/parser.y"
+  case 329: /* asknumber: '(' ASKNUMBER ')'  */
+#line 466 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("asknumber"), LINE, n_asknumber, NULL, NUMBER); }
-#line 4370 "parser.c"
+#line 4674 "parser.c"
     break;
 
-  case 319:
-#line 453 "../src/parser.y"
+  case 330: /* asknumber: '(' ASKNUMBER opts ')'  */
+#line 467 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("asknumber"), LINE, n_asknumber, (yyvsp[-1].e), NUMBER); }
-#line 4376 "parser.c"
+#line 4680 "parser.c"
     break;
 
-  case 320:
-#line 454 "../src/parser.y"
+  case 331: /* askoptions: '(' ASKOPTIONS opts ')'  */
+#line 468 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askoptions"), LINE, n_askoptions, (yyvsp[-1].e), NUMBER); }
-#line 4382 "parser.c"
+#line 4686 "parser.c"
     break;
 
-  case 321:
-#line 455 "../src/parser.y"
+  case 332: /* askstring: '(' ASKSTRING ')'  */
+#line 469 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askstring"), LINE, n_askstring, NULL, STRING); }
-#line 4388 "parser.c"
+#line 4692 "parser.c"
     break;
 
-  case 322:
-#line 456 "../src/parser.y"
+  case 333: /* askstring: '(' ASKSTRING opts ')'  */
+#line 470 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("askstring"), LINE, n_askstring, (yyvsp[-1].e), STRING); }
-#line 4394 "parser.c"
+#line 4698 "parser.c"
     break;
 
-  case 323:
-#line 460 "../src/parser.y"
+  case 334: /* cat: '(' CAT ps ')'  */
+#line 474 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("cat"), LINE, n_cat, (yyvsp[-1].e), STRING); }
-#line 4400 "parser.c"
+#line 4704 "parser.c"
     break;
 
-  case 324:
-#line 461 "../src/parser.y"
+  case 335: /* expandpath: '(' EXPANDPATH p ')'  */
+#line 475 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("expandpath"), LINE, n_expandpath, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4406 "parser.c"
+#line 4710 "parser.c"
     break;
 
-  case 325:
-#line 462 "../src/parser.y"
+  case 336: /* fmt: '(' STR ps ')'  */
+#line 476 "../src/parser.y"
                                                  { (yyval.e) = new_native((yyvsp[-2].s), LINE, n_fmt, (yyvsp[-1].e), STRING); }
-#line 4412 "parser.c"
+#line 4716 "parser.c"
     break;
 
-  case 326:
-#line 463 "../src/parser.y"
+  case 337: /* fmt: '(' STR ')'  */
+#line 477 "../src/parser.y"
                                                  { (yyval.e) = new_native((yyvsp[-1].s), LINE, n_fmt, NULL, STRING); }
-#line 4418 "parser.c"
+#line 4722 "parser.c"
     break;
 
-  case 327:
-#line 464 "../src/parser.y"
+  case 338: /* pathonly: '(' PATHONLY p ')'  */
+#line 478 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("pathonly"), LINE, n_pathonly, push(new_contxt(), (yyvsp[-1].e)), STRING); }
-#line 4424 "parser.c"
+#line 4728 "parser.c"
     break;
 
-  case 328:
-#line 465 "../src/parser.y"
+  case 339: /* patmatch: '(' PATMATCH pp ')'  */
+#line 479 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("patmatch"), LINE, n_patmatch, (yyvsp[-1].e), NUMBER); }
-#line 4430 "parser.c"
+#line 4734 "parser.c"
     break;
 
-  case 329:
-#line 466 "../src/parser.y"
+  case 340: /* strlen: '(' STRLEN p ')'  */
+#line 480 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("strlen"), LINE, n_strlen, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4436 "parser.c"
+#line 4740 "parser.c"
     break;
 
-  case 330:
-#line 467 "../src/parser.y"
+  case 341: /* substr: '(' SUBSTR pp ')'  */
+#line 481 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("substr"), LINE, n_substr, (yyvsp[-1].e), STRING); }
-#line 4442 "parser.c"
+#line 4746 "parser.c"
     break;
 
-  case 331:
-#line 468 "../src/parser.y"
+  case 342: /* substr: '(' SUBSTR pp p ')'  */
+#line 482 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("substr"), LINE, n_substr, push((yyvsp[-2].e), (yyvsp[-1].e)), STRING); }
-#line 4448 "parser.c"
+#line 4752 "parser.c"
     break;
 
-  case 332:
-#line 469 "../src/parser.y"
+  case 343: /* tackon: '(' TACKON pp ')'  */
+#line 483 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("tackon"), LINE, n_tackon, (yyvsp[-1].e), STRING); }
-#line 4454 "parser.c"
+#line 4758 "parser.c"
     break;
 
-  case 333:
-#line 473 "../src/parser.y"
+  case 344: /* set: '(' SET sps ')'  */
+#line 487 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("set"), LINE, n_set, (yyvsp[-1].e), DANGLE); }
-#line 4460 "parser.c"
+#line 4764 "parser.c"
     break;
 
-  case 334:
-#line 474 "../src/parser.y"
+  case 345: /* symbolset: '(' SYMBOLSET pps ')'  */
+#line 488 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("symbolset"), LINE, n_symbolset, (yyvsp[-1].e), DANGLE); }
-#line 4466 "parser.c"
+#line 4770 "parser.c"
     break;
 
-  case 335:
-#line 475 "../src/parser.y"
+  case 346: /* symbolval: '(' SYMBOLVAL p ')'  */
+#line 489 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("symbolval"), LINE, n_symbolval, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4472 "parser.c"
+#line 4776 "parser.c"
     break;
 
-  case 336:
-#line 479 "../src/parser.y"
+  case 347: /* openwbobject: '(' OPENWBOBJECT p ')'  */
+#line 493 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4478 "parser.c"
+#line 4782 "parser.c"
     break;
 
-  case 337:
-#line 480 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e)), NUMBER); }
-#line 4484 "parser.c"
+  case 348: /* openwbobject: '(' OPENWBOBJECT p opts ')'  */
+#line 494 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift((yyvsp[-1].e), (yyvsp[-2].e)), NUMBER); }
+#line 4788 "parser.c"
     break;
 
-  case 338:
-#line 481 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
-#line 4490 "parser.c"
+  case 349: /* openwbobject: '(' OPENWBOBJECT opts p ')'  */
+#line 495 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift((yyvsp[-2].e), (yyvsp[-1].e)), NUMBER); }
+#line 4794 "parser.c"
     break;
 
-  case 339:
-#line 482 "../src/parser.y"
-                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), (yyvsp[-2].e)), merge((yyvsp[-3].e), (yyvsp[-1].e))), NUMBER); }
-#line 4496 "parser.c"
+  case 350: /* openwbobject: '(' OPENWBOBJECT opts p opts ')'  */
+#line 496 "../src/parser.y"
+                                                 { (yyval.e) = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift(merge((yyvsp[-3].e), (yyvsp[-1].e)), (yyvsp[-2].e)), NUMBER); }
+#line 4800 "parser.c"
     break;
 
-  case 340:
-#line 483 "../src/parser.y"
+  case 351: /* showwbobject: '(' SHOWWBOBJECT p ')'  */
+#line 497 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("showwbobject"), LINE, n_showwbobject, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4502 "parser.c"
+#line 4806 "parser.c"
     break;
 
-  case 341:
-#line 484 "../src/parser.y"
+  case 352: /* closewbobject: '(' CLOSEWBOBJECT p ')'  */
+#line 498 "../src/parser.y"
                                                  { (yyval.e) = new_native(strdup("closewbobject"), LINE, n_closewbobject, push(new_contxt(), (yyvsp[-1].e)), NUMBER); }
-#line 4508 "parser.c"
+#line 4812 "parser.c"
     break;
 
-  case 342:
-#line 488 "../src/parser.y"
+  case 353: /* all: '(' ALL ')'  */
+#line 502 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("all"), OPT_ALL, NULL); }
-#line 4514 "parser.c"
+#line 4818 "parser.c"
     break;
 
-  case 343:
-#line 489 "../src/parser.y"
+  case 354: /* append: '(' APPEND ps ')'  */
+#line 503 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("append"), OPT_APPEND, (yyvsp[-1].e)); }
-#line 4520 "parser.c"
+#line 4824 "parser.c"
     break;
 
-  case 344:
-#line 490 "../src/parser.y"
+  case 355: /* assigns: '(' ASSIGNS ')'  */
+#line 504 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("assigns"), OPT_ASSIGNS, NULL); }
-#line 4526 "parser.c"
+#line 4830 "parser.c"
     break;
 
-  case 345:
-#line 491 "../src/parser.y"
+  case 356: /* back: '(' BACK vps ')'  */
+#line 505 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("back"), OPT_BACK, (yyvsp[-1].e)); }
-#line 4532 "parser.c"
+#line 4836 "parser.c"
     break;
 
-  case 346:
-#line 492 "../src/parser.y"
+  case 357: /* choices: '(' CHOICES ps ')'  */
+#line 506 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("choices"), OPT_CHOICES, (yyvsp[-1].e)); }
-#line 4538 "parser.c"
+#line 4842 "parser.c"
     break;
 
-  case 347:
-#line 493 "../src/parser.y"
+  case 358: /* command: '(' COMMAND ps ')'  */
+#line 507 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("command"), OPT_COMMAND, (yyvsp[-1].e)); }
-#line 4544 "parser.c"
+#line 4848 "parser.c"
     break;
 
-  case 348:
-#line 494 "../src/parser.y"
+  case 359: /* compression: '(' COMPRESSION ')'  */
+#line 508 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("compression"), OPT_COMPRESSION, NULL); }
-#line 4550 "parser.c"
+#line 4854 "parser.c"
     break;
 
-  case 349:
-#line 495 "../src/parser.y"
+  case 360: /* confirm: '(' CONFIRM ps ')'  */
+#line 509 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("confirm"), OPT_CONFIRM, (yyvsp[-1].e)); }
-#line 4556 "parser.c"
+#line 4860 "parser.c"
     break;
 
-  case 350:
-#line 496 "../src/parser.y"
+  case 361: /* confirm: '(' CONFIRM ')'  */
+#line 510 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("confirm"), OPT_CONFIRM, NULL); }
-#line 4562 "parser.c"
+#line 4866 "parser.c"
     break;
 
-  case 351:
-#line 497 "../src/parser.y"
+  case 362: /* default: '(' DEFAULT p ')'  */
+#line 511 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("default"), OPT_DEFAULT, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4568 "parser.c"
+#line 4872 "parser.c"
     break;
 
-  case 352:
-#line 498 "../src/parser.y"
+  case 363: /* delopts: '(' DELOPTS ps ')'  */
+#line 512 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("delopts"), OPT_DELOPTS, (yyvsp[-1].e)); }
-#line 4574 "parser.c"
+#line 4878 "parser.c"
     break;
 
-  case 353:
-#line 499 "../src/parser.y"
+  case 364: /* delopts: '(' DELOPTS ')'  */
+#line 513 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("delopts"), OPT_DELOPTS, push(new_contxt(), new_symref(strdup("@null"), LINE))); }
-#line 4580 "parser.c"
+#line 4884 "parser.c"
     break;
 
-  case 354:
-#line 500 "../src/parser.y"
+  case 365: /* dest: '(' DEST p ')'  */
+#line 514 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("dest"), OPT_DEST, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4586 "parser.c"
+#line 4890 "parser.c"
     break;
 
-  case 355:
-#line 501 "../src/parser.y"
+  case 366: /* disk: '(' DISK ')'  */
+#line 515 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("disk"), OPT_DISK, NULL); }
-#line 4592 "parser.c"
+#line 4896 "parser.c"
     break;
 
-  case 356:
-#line 502 "../src/parser.y"
+  case 367: /* files: '(' FILES ')'  */
+#line 516 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("files"), OPT_FILES, NULL); }
-#line 4598 "parser.c"
+#line 4902 "parser.c"
     break;
 
-  case 357:
-#line 503 "../src/parser.y"
+  case 368: /* fonts: '(' FONTS ')'  */
+#line 517 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("fonts"), OPT_FONTS, NULL); }
-#line 4604 "parser.c"
+#line 4908 "parser.c"
     break;
 
-  case 358:
-#line 504 "../src/parser.y"
+  case 369: /* getdefaulttool: '(' GETDEFAULTTOOL p ')'  */
+#line 518 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("getdefaulttool"), OPT_GETDEFAULTTOOL, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4610 "parser.c"
+#line 4914 "parser.c"
     break;
 
-  case 359:
-#line 505 "../src/parser.y"
+  case 370: /* getposition: '(' GETPOSITION pp ')'  */
+#line 519 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("getposition"), OPT_GETPOSITION, (yyvsp[-1].e)); }
-#line 4616 "parser.c"
+#line 4920 "parser.c"
     break;
 
-  case 360:
-#line 506 "../src/parser.y"
+  case 371: /* getstack: '(' GETSTACK p ')'  */
+#line 520 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("getstack"), OPT_GETSTACK, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4622 "parser.c"
+#line 4926 "parser.c"
     break;
 
-  case 361:
-#line 507 "../src/parser.y"
+  case 372: /* gettooltype: '(' GETTOOLTYPE pp ')'  */
+#line 521 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("gettooltype"), OPT_GETTOOLTYPE, (yyvsp[-1].e)); }
-#line 4628 "parser.c"
+#line 4932 "parser.c"
     break;
 
-  case 362:
-#line 508 "../src/parser.y"
+  case 373: /* help: '(' HELP ps ')'  */
+#line 522 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("help"), OPT_HELP, (yyvsp[-1].e)); }
-#line 4634 "parser.c"
+#line 4938 "parser.c"
     break;
 
-  case 363:
-#line 509 "../src/parser.y"
+  case 374: /* help: '(' HELP ')'  */
+#line 523 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("help"), OPT_HELP, push(new_contxt(), new_symref(strdup("@null"), LINE))); }
-#line 4640 "parser.c"
+#line 4944 "parser.c"
     break;
 
-  case 364:
-#line 510 "../src/parser.y"
+  case 375: /* infos: '(' INFOS ')'  */
+#line 524 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("infos"), OPT_INFOS, NULL); }
-#line 4646 "parser.c"
+#line 4950 "parser.c"
     break;
 
-  case 365:
-#line 511 "../src/parser.y"
+  case 376: /* include: '(' INCLUDE p ')'  */
+#line 525 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("include"), OPT_INCLUDE, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4652 "parser.c"
+#line 4956 "parser.c"
     break;
 
-  case 366:
-#line 512 "../src/parser.y"
+  case 377: /* newname: '(' NEWNAME p ')'  */
+#line 526 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("newname"), OPT_NEWNAME, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4658 "parser.c"
+#line 4962 "parser.c"
     break;
 
-  case 367:
-#line 513 "../src/parser.y"
+  case 378: /* newpath: '(' NEWPATH ')'  */
+#line 527 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("newpath"), OPT_NEWPATH, NULL); }
-#line 4664 "parser.c"
+#line 4968 "parser.c"
     break;
 
-  case 368:
-#line 514 "../src/parser.y"
+  case 379: /* newpath: '(' NEWPATH p ')'  */
+#line 528 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("newpath"), OPT_NEWPATH, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4670 "parser.c"
+#line 4974 "parser.c"
     break;
 
-  case 369:
-#line 515 "../src/parser.y"
+  case 380: /* nogauge: '(' NOGAUGE ')'  */
+#line 529 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("nogauge"), OPT_NOGAUGE, NULL); }
-#line 4676 "parser.c"
+#line 4980 "parser.c"
     break;
 
-  case 370:
-#line 516 "../src/parser.y"
+  case 381: /* noposition: '(' NOPOSITION ')'  */
+#line 530 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("noposition"), OPT_NOPOSITION, NULL); }
-#line 4682 "parser.c"
+#line 4986 "parser.c"
     break;
 
-  case 371:
-#line 517 "../src/parser.y"
+  case 382: /* noreq: '(' NOREQ ')'  */
+#line 531 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("noreq"), OPT_NOREQ, NULL); }
-#line 4688 "parser.c"
+#line 4992 "parser.c"
     break;
 
-  case 372:
-#line 518 "../src/parser.y"
+  case 383: /* pattern: '(' PATTERN p ')'  */
+#line 532 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("pattern"), OPT_PATTERN, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4694 "parser.c"
+#line 4998 "parser.c"
     break;
 
-  case 373:
-#line 519 "../src/parser.y"
+  case 384: /* prompt: '(' PROMPT ps ')'  */
+#line 533 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("prompt"), OPT_PROMPT, (yyvsp[-1].e)); }
-#line 4700 "parser.c"
+#line 5004 "parser.c"
     break;
 
-  case 374:
-#line 520 "../src/parser.y"
+  case 385: /* prompt: '(' PROMPT ')'  */
+#line 534 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("prompt"), OPT_PROMPT, push(new_contxt(), new_symref(strdup("@null"), LINE))); }
-#line 4706 "parser.c"
+#line 5010 "parser.c"
     break;
 
-  case 375:
-#line 521 "../src/parser.y"
+  case 386: /* quiet: '(' QUIET ')'  */
+#line 535 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("quiet"), OPT_QUIET, NULL); }
-#line 4712 "parser.c"
+#line 5016 "parser.c"
     break;
 
-  case 376:
-#line 522 "../src/parser.y"
+  case 387: /* range: '(' RANGE pp ')'  */
+#line 536 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("range"), OPT_RANGE, (yyvsp[-1].e)); }
-#line 4718 "parser.c"
+#line 5022 "parser.c"
     break;
 
-  case 377:
-#line 523 "../src/parser.y"
+  case 388: /* safe: '(' SAFE ')'  */
+#line 537 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("safe"), OPT_SAFE, NULL); }
-#line 4724 "parser.c"
+#line 5028 "parser.c"
     break;
 
-  case 378:
-#line 524 "../src/parser.y"
+  case 389: /* setdefaulttool: '(' SETDEFAULTTOOL p ')'  */
+#line 538 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("setdefaulttool"), OPT_SETDEFAULTTOOL, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4730 "parser.c"
+#line 5034 "parser.c"
     break;
 
-  case 379:
-#line 525 "../src/parser.y"
+  case 390: /* setposition: '(' SETPOSITION pp ')'  */
+#line 539 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("setposition"), OPT_SETPOSITION, (yyvsp[-1].e)); }
-#line 4736 "parser.c"
+#line 5040 "parser.c"
     break;
 
-  case 380:
-#line 526 "../src/parser.y"
+  case 391: /* setstack: '(' SETSTACK p ')'  */
+#line 540 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("setstack"), OPT_SETSTACK, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4742 "parser.c"
+#line 5046 "parser.c"
     break;
 
-  case 381:
-#line 527 "../src/parser.y"
+  case 392: /* settooltype: '(' SETTOOLTYPE pp ')'  */
+#line 541 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("settooltype"), OPT_SETTOOLTYPE, (yyvsp[-1].e)); }
-#line 4748 "parser.c"
+#line 5052 "parser.c"
     break;
 
-  case 382:
-#line 528 "../src/parser.y"
+  case 393: /* settooltype: '(' SETTOOLTYPE p ')'  */
+#line 542 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("settooltype"), OPT_SETTOOLTYPE, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4754 "parser.c"
+#line 5058 "parser.c"
     break;
 
-  case 383:
-#line 529 "../src/parser.y"
+  case 394: /* source: '(' SOURCE p ')'  */
+#line 543 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("source"), OPT_SOURCE, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4760 "parser.c"
+#line 5064 "parser.c"
     break;
 
-  case 384:
-#line 530 "../src/parser.y"
+  case 395: /* source: '(' SOURCE p all ')'  */
+#line 544 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("source"), OPT_SOURCE, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e))); }
-#line 4766 "parser.c"
+#line 5070 "parser.c"
     break;
 
-  case 385:
-#line 531 "../src/parser.y"
+  case 396: /* swapcolors: '(' SWAPCOLORS ')'  */
+#line 545 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("swapcolors"), OPT_SWAPCOLORS, NULL); }
-#line 4772 "parser.c"
+#line 5076 "parser.c"
     break;
 
-  case 386:
-#line 532 "../src/parser.y"
+  case 397: /* optional: '(' OPTIONAL ps ')'  */
+#line 546 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("optional"), OPT_OPTIONAL, (yyvsp[-1].e)); }
-#line 4778 "parser.c"
+#line 5082 "parser.c"
     break;
 
-  case 387:
-#line 533 "../src/parser.y"
+  case 398: /* optional: '(' OPTIONAL ')'  */
+#line 547 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("optional"), OPT_OPTIONAL, push(new_contxt(), new_symref(strdup("@null"), LINE))); }
-#line 4784 "parser.c"
+#line 5088 "parser.c"
     break;
 
-  case 388:
-#line 534 "../src/parser.y"
+  case 399: /* resident: '(' RESIDENT ')'  */
+#line 548 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("resident"), OPT_RESIDENT, NULL); }
-#line 4790 "parser.c"
+#line 5094 "parser.c"
     break;
 
-  case 389:
-#line 535 "../src/parser.y"
+  case 400: /* override: '(' OVERRIDE p ')'  */
+#line 549 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("override"), OPT_OVERRIDE, push(new_contxt(), (yyvsp[-1].e))); }
-#line 4796 "parser.c"
+#line 5100 "parser.c"
     break;
 
-  case 390:
-#line 536 "../src/parser.y"
+  case 401: /* dynopt: '(' IF p xopt ')'  */
+#line 550 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(new_contxt(), (yyvsp[-2].e)), (yyvsp[-1].e))); }
-#line 4802 "parser.c"
+#line 5106 "parser.c"
     break;
 
-  case 391:
-#line 537 "../src/parser.y"
+  case 402: /* dynopt: '(' IF p xopt opts ')'  */
+#line 551 "../src/parser.y"
                                                  { (yyval.e) = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(push(new_contxt(), (yyvsp[-3].e)), (yyvsp[-2].e)), (yyvsp[-1].e))); }
-#line 4808 "parser.c"
+#line 5112 "parser.c"
     break;
 
 
-#line 4812 "parser.c"
+#line 5116 "parser.c"
 
       default: break;
     }
@@ -4823,11 +5127,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
@@ -4851,50 +5154,44 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (scanner, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (scanner, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -4927,6 +5224,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -4943,13 +5241,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4963,7 +5262,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, scanner);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4975,7 +5274,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4986,7 +5285,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -4994,24 +5293,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (scanner, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -5027,18 +5324,17 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, scanner);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 539 "../src/parser.y"
+
+#line 553 "../src/parser.y"
 
@@ -257,43 +257,25 @@ entry_p new_symref(char *name, int32_t line)
 }
 
 //------------------------------------------------------------------------------
-// Name:        move_contxt
-// Description: Move children and symbols from one context to another. The empty
-//              source context will be freed afterwards.
-// Input:       entry_p dst:    The destination context.
-//              entry_p src:    The source context.
-// Return:      -
-//------------------------------------------------------------------------------
-static void move_contxt(entry_p dst, entry_p src)
+// Name:        adopt_contxt
+// Description: Get an entry to be used by the NATIVE, OPTION and CUSREF
+//              allocators. If the input is a CONTXT, it's reused as is, the
+//              children and symbols stay where they are and so does parenting.
+//              Otherwise a new, empty entry is allocated.
+// Input:       entry_p chl:    A CONTXT or NULL.
+// Return:      entry_p:        The CONTXT, a new entry or NULL if we're out of
+//                              memory.
+//------------------------------------------------------------------------------
+static entry_p adopt_contxt(entry_p chl)
 {
-    // Sanity check.
-    if(!dst || !src)
+    // Only unresolved contexts can be reused, these come from the parser.
+    if(chl && chl->type == CONTXT && !chl->resolved && !chl->name)
     {
-        (void) PANIC(NULL);
-        return;
+        return chl;
     }
 
-    entry_p *sym = dst->symbols = src->symbols,
-            *chl = dst->children = src->children;
-
-    // Reparent children.
-    while(exists(*chl))
-    {
-        (*chl)->parent = dst;
-        chl++;
-    }
-
-    // Reparent symbols.
-    while(exists(*sym))
-    {
-        (*sym)->parent = dst;
-        sym++;
-    }
-
-    // Free the source.
-    src->children = NULL;
-    src->symbols = NULL;
-    kill(src);
+    // We rely on everything being set to '0'
+    return DBG_ALLOC(calloc(1, sizeof(entry_t)));
 }
 
 //------------------------------------------------------------------------------
@@ -312,8 +294,8 @@ static void move_contxt(entry_p dst, entry_p src)
 //------------------------------------------------------------------------------
 entry_p new_native(char *name, int32_t line, call_t call, entry_p chl, type_t type)
 {
-    // We rely on everything being set to '0'
-    entry_p entry = DBG_ALLOC(calloc(1, sizeof (entry_t)));
+    // Take over the context, if any, children and symbols included.
+    entry_p entry = adopt_contxt(chl);
 
     // We require a name and a line number.
     if(entry && call && name && (line > 0))
@@ -331,12 +313,6 @@ entry_p new_native(char *name, int32_t line, call_t call, entry_p chl, type_t ty
             entry->call = call;
             entry->id = line;
 
-            // Adopt children and symbols if any.
-            if(chl && chl->type == CONTXT)
-            {
-                move_contxt(entry, chl);
-            }
-
             // Set parent of return value.
             entry->resolved->parent = entry;
             return entry;
@@ -344,7 +320,11 @@ entry_p new_native(char *name, int32_t line, call_t call, entry_p chl, type_t ty
     }
 
     // We need to free 'name' and 'chl' also, since we own them.
-    free(entry);
+    if(entry != chl)
+    {
+        free(entry);
+    }
+
     free(name);
     kill(chl);
 
@@ -367,8 +347,9 @@ entry_p new_native(char *name, int32_t line, call_t call, entry_p chl, type_t ty
 //------------------------------------------------------------------------------
 entry_p new_option(char *name, opt_t type, entry_p chl)
 {
-    // We rely on everything being set to '0'
-    entry_p entry = DBG_ALLOC(calloc(1, sizeof (entry_t)));
+    // Take over the context, if any. This is for options that contain more
+    // info than just 1 / 0, e.g (delopts) and (command).
+    entry_p entry = adopt_contxt(chl);
 
     // We required a name of the option for debugging purposes.
     if(name && entry)
@@ -386,14 +367,6 @@ entry_p new_option(char *name, opt_t type, entry_p chl)
             entry->type = OPTION;
             entry->name = name;
 
-            // Adopt contents of CONTXT, if there is any.
-            if(chl && chl->type == CONTXT)
-            {
-                // This is for options that contain more info than just 1 / 0,
-                // e.g (delopts) and (command).
-                move_contxt(entry, chl);
-            }
-
             // Dynamic options must be resolved.
             if(type == OPT_DYNOPT)
             {
@@ -406,9 +379,13 @@ entry_p new_option(char *name, opt_t type, entry_p chl)
     }
 
     // We need to free 'name' and 'chl' also, since we own them.
+    if(entry != chl)
+    {
+        free(entry);
+    }
+
     kill(chl);
     free(name);
-    free(entry);
 
     // Bad input or out of memory.
     (void) PANIC(NULL);
@@ -428,8 +405,8 @@ entry_p new_option(char *name, opt_t type, entry_p chl)
 //------------------------------------------------------------------------------
 entry_p new_cusref(char *name, int32_t line, entry_p arg)
 {
-    // We rely on everything being set to '0'
-    entry_p entry = DBG_ALLOC(calloc(1, sizeof (entry_t)));
+    // Take over the function arguments, if any.
+    entry_p entry = adopt_contxt(arg);
 
     // A line number is required to produce meaningful error messages.
     if(entry && name && (line > 0))
@@ -439,18 +416,15 @@ entry_p new_cusref(char *name, int32_t line, entry_p arg)
         entry->name = name;
         entry->type = CUSREF;
         entry->call = n_gosub;
-
-        // Adopt function arguments if any.
-        if(arg && arg->type == CONTXT)
-        {
-            move_contxt(entry, arg);
-        }
-
         return entry;
     }
 
     // We need to free 'name' and 'arg' also, since we own them.
-    free(entry);
+    if(entry != arg)
+    {
+        free(entry);
+    }
+
     free(name);
     kill(arg);
 
@@ -528,39 +502,46 @@ entry_p merge(entry_p dst, entry_p src)
     // Sanity check.
     if(dst && dst->children && src && src->children)
     {
-        // Total number of children.
-        size_t num = num_children(src->children) + num_children(dst->children);
+        // Number of children in the destination and in the source.
+        size_t num = num_children(dst->children),
+               add = num_children(src->children),
+               cap = num;
 
-        // Make the new array big enough to hold both source and destination.
-        entry_p *new = DBG_ALLOC(calloc(num + 1, sizeof(entry_p)));
+        // The sentinel marks the end of the destination array.
+        while(!dst->children[cap])
+        {
+            cap++;
+        }
 
-        if(new)
+        // Grow the destination if the source doesn't fit. Double the size at
+        // least, lists are built by merging over and over again.
+        if(num + add > cap)
         {
-            // Start all over.
-            num = 0;
+            cap = num + add > (cap << 1) ? num + add : (cap << 1);
 
-            // Copy current destination children.
-            for(size_t i = 0; exists(dst->children[i]); i++)
-            {
-                new[num] = dst->children[i];
-                new[num++]->parent = dst;
-            }
+            // Everything must be set to '0'.
+            entry_p *new = DBG_ALLOC(calloc(cap + 1, sizeof(entry_p)));
 
-            // Append children of the source.
-            for(size_t i = 0; exists(src->children[i]); i++)
+            if(!new)
             {
-                new[num] = src->children[i];
-                new[num++]->parent = dst;
+                // We own 'src' and need to free it.
+                (void) PANIC(NULL);
+                kill(src);
+                return dst;
             }
 
-            // Replace the old with the new and add array sentinel.
+            // Move everything to the new array and add array sentinel.
+            memcpy(new, dst->children, num * sizeof(entry_p));
             free(dst->children);
             dst->children = new;
-            new[num] = end();
+            new[cap] = end();
         }
-        else
+
+        // Append children of the source.
+        for(size_t i = 0; i < add; i++)
         {
-            (void) PANIC(NULL);
+            dst->children[num] = src->children[i];
+            dst->children[num++]->parent = dst;
         }
     }
     else
@@ -574,6 +555,27 @@ entry_p merge(entry_p dst, entry_p src)
     return dst;
 }
 
+//------------------------------------------------------------------------------
+// Name:        unshift
+// Description: Push entry to the head of the children of a context. Parsing
+//              '(native p opts)' this way we don't need a context of its own
+//              for the 'p', which would be merged into the options afterwards.
+// Input:       entry_p dst:    The destination context.
+//              entry_p src:    The source entry.
+// Return:      entry_p:        The destination context.
+//------------------------------------------------------------------------------
+entry_p unshift(entry_p dst, entry_p src)
+{
+    // Append and let the last be the first. We own 'src', push() will take
+    // care of it if something goes wrong.
+    if(push(dst, src))
+    {
+        ror(dst->children);
+    }
+
+    return dst;
+}
+
 //------------------------------------------------------------------------------
 // Name:        push_symbol
 // Description: Test whether a symbol is to be pushed or not.
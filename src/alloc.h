@@ -32,6 +32,7 @@ void kill(entry_p entry);
 entry_p append(entry_p **dst, entry_p ent);
 entry_p merge(entry_p dst, entry_p src);
 entry_p push(entry_p dst, entry_p src);
+entry_p unshift(entry_p dst, entry_p src);
 entry_p end(void);
 
 #endif
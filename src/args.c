@@ -29,6 +29,21 @@ typedef LONG IPTR;
 #endif
 
 static char *args[ARG_NUMBER_OF];
+static char **batch;
+
+//------------------------------------------------------------------------------
+// Name:        arg_switch
+// Description: Test whether an argument is a switch or not. Switches are
+//              interpreted as booleans, they aren't copied nor free:d.
+// Input:       size_t arg:     Argument index.
+// Return:      'true' if the argument is a switch, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool arg_switch(size_t arg)
+{
+    return arg == ARG_NOLOG || arg == ARG_NOPRETEND || arg == ARG_COMPILE ||
+           arg == ARG_STREAM || arg == ARG_CHECK || arg == ARG_URING ||
+           arg == ARG_PIPE;
+}
 
 //------------------------------------------------------------------------------
 // Name:        arg_post
@@ -70,11 +85,11 @@ static bool arg_post(void)
         }
     }
 
-    // Copy string arguments. Note that we skip NOLOG and NOPRETEND, these are
-    // interpreted as booleans.
+    // Copy string arguments. Note that we skip switches, these are interpreted
+    // as booleans.
     for(size_t arg = ARG_APPNAME; arg < ARG_OLDDIR; arg++)
     {
-        if(args[arg] && arg != ARG_NOLOG && arg != ARG_NOPRETEND)
+        if(args[arg] && !arg_switch(arg))
         {
             args[arg] = DBG_ALLOC(strdup(args[arg]));
         }
@@ -118,7 +133,9 @@ static bool arg_cli(int argc, char **argv)
     // Return the result of arg_post().
     return ret;
     #else
-    // On non-AMIGA systems, or in test mode, only the script name is supported.
+    // On non-AMIGA systems, or in test mode, only the script name, the
+    // compile, stream, check, uring and pipe switches and the number of jobs
+    // are supported.
     if(argc < 2)
     {
         // Missing argument(s)
@@ -126,7 +143,51 @@ static bool arg_cli(int argc, char **argv)
         return false;
     }
 
-    // This is the only argument we can handle on non-Amigas.
+    // Switches go before the script, '-compile SCRIPT' to compile instead of
+    // execute, '-stream SCRIPT' to execute while parsing.
+    for(; argc > 2; argc--, argv++)
+    {
+        // Any non-NULL value will do.
+        if(!strcmp(argv[1], "-compile"))
+        {
+            args[ARG_COMPILE] = argv[1];
+        }
+        else if(!strcmp(argv[1], "-stream"))
+        {
+            args[ARG_STREAM] = argv[1];
+        }
+        else if(!strcmp(argv[1], "-uring"))
+        {
+            // '-uring SCRIPT' to let io_uring copy files.
+            args[ARG_URING] = argv[1];
+        }
+        else if(!strcmp(argv[1], "-pipe"))
+        {
+            // '-pipe SCRIPT' to copy files while the source is being read.
+            args[ARG_PIPE] = argv[1];
+        }
+        else if(!strcmp(argv[1], "-jobs") && argc > 3)
+        {
+            // '-jobs N SCRIPT' to let N workers copy and delete files.
+            args[ARG_JOBS] = argv[2];
+            argc--;
+            argv++;
+        }
+        else if(!strcmp(argv[1], "-check"))
+        {
+            // '-check SCRIPT|DIR ...' to check the syntax of any number of
+            // scripts. The list is NULL terminated like argv itself.
+            args[ARG_CHECK] = argv[1];
+            batch = ++argv + 1;
+            break;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // The script name is the last argument, or the first one to be checked.
     args[ARG_SCRIPT] = argv[1];
 
     // Copy and return.
@@ -157,6 +218,7 @@ static void arg_find_tts(STRPTR *tts)
     args[ARG_LOGFILE] = (char *) FindToolType((STRPTR *) tts, "LOGFILE");
     args[ARG_NOLOG] = (char *) FindToolType((STRPTR *) tts, "NOLOG");
     args[ARG_NOPRETEND] = (char *) FindToolType((STRPTR *) tts, "NOPRETEND");
+    args[ARG_STREAM] = (char *) FindToolType((STRPTR *) tts, "STREAM");
 }
 #endif
 
@@ -252,11 +314,12 @@ bool arg_init(int argc, char **argv)
     // Invoked from CLI or WB.
     bool init = argc ? arg_cli(argc, argv) : arg_wb(argv);
 
-    // Go to script working directory and return. Temp AxRT workaround until
-    // argument handling in AxRT is implemented.
+    // Go to script working directory and return. Scripts to be checked are
+    // relative to the current directory. Temp AxRT workaround until argument
+    // handling in AxRT is implemented.
     return init && args[ARG_HOMEDIR]
     #ifndef __AXRT__
-        && !chdir(args[ARG_HOMEDIR])
+        && (args[ARG_CHECK] || !chdir(args[ARG_HOMEDIR]))
     #endif
     ;
 }
@@ -275,6 +338,18 @@ char *arg_get(int ndx)
     return ndx >= 0 && ndx < ARG_NUMBER_OF ? args[ndx] : NULL;
 }
 
+//------------------------------------------------------------------------------
+// Name:        arg_batch
+// Description: Get the scripts / directories to be checked, refer to '-check'.
+// Input:       -
+// Return:      char **:    NULL terminated array of paths in check mode, NULL
+//                          otherwise.
+//------------------------------------------------------------------------------
+char **arg_batch(void)
+{
+    return batch;
+}
+
 //------------------------------------------------------------------------------
 // Name:        arg_argc
 // Description: Get / set argument count.
@@ -313,11 +388,11 @@ void arg_done(void)
         chdir(args[ARG_OLDDIR]);
     }
 
-    // Free what we have allocated. Note that we skip NOLOG and NOPRETEND, these
-    // are non-valid pointers interpreted as booleans.
+    // Free what we have allocated. Note that we skip switches, these are
+    // non-valid pointers interpreted as booleans.
     for(size_t arg = ARG_SCRIPT; arg < ARG_NUMBER_OF; arg++)
     {
-        if(arg != ARG_NOLOG && arg != ARG_NOPRETEND)
+        if(!arg_switch(arg))
         {
             free(args[arg]);
         }
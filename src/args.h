@@ -27,6 +27,12 @@ enum
     ARG_LOGFILE,
     ARG_NOLOG,
     ARG_NOPRETEND,
+    ARG_COMPILE,
+    ARG_STREAM,
+    ARG_CHECK,
+    ARG_JOBS,
+    ARG_URING,
+    ARG_PIPE,
     ARG_OLDDIR,
     ARG_HOMEDIR,
     ARG_ICON,
@@ -35,6 +41,7 @@ enum
 
 bool arg_init(int argc, char **argv);
 char *arg_get(int ndx);
+char **arg_batch(void);
 int arg_argc(int argc);
 void arg_done(void);
 
@@ -0,0 +1,276 @@
+//------------------------------------------------------------------------------
+// check.c:
+//
+// Syntax checking of scripts in batch. Nothing is executed, scripts are parsed
+// and then thrown away. Errors are written to stdout, one line per error, on
+// the form 'script:line: error'.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "check.h"
+#include "file.h"
+#include "lexer.h"
+#include "strop.h"
+#include "util.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Scripts to be checked.
+static char **chk_lst;
+static size_t chk_num, chk_cap;
+
+//------------------------------------------------------------------------------
+// Name:        h_chk_add
+// Description: Add script to the list of scripts to be checked.
+// Input:       char *path:     Path to script. The list takes ownership.
+// Return:      bool:           'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_chk_add(char *path)
+{
+    if(!path)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    // No free slot available, make the list twice as big.
+    if(chk_num == chk_cap)
+    {
+        size_t cap = chk_cap ? chk_cap << 1 : LG_VECLEN;
+        char **lst = DBG_ALLOC(calloc(cap, sizeof(char *)));
+
+        if(!lst)
+        {
+            free(path);
+            return false;
+        }
+
+        if(chk_lst)
+        {
+            memcpy(lst, chk_lst, chk_num * sizeof(char *));
+            free(chk_lst);
+        }
+
+        chk_lst = lst;
+        chk_cap = cap;
+    }
+
+    chk_lst[chk_num++] = path;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_chk_skip
+// Description: Test whether a directory entry should be skipped or not. Hidden
+//              files, icons and precompiled images aren't scripts.
+// Input:       const char *name:   Name of directory entry.
+// Return:      bool:               'true' if the entry is to be skipped,
+//                                  'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_chk_skip(const char *name)
+{
+    size_t len = strlen(name);
+
+    return *name == '.' ||
+           (len > 5 && !strcasecmp(name + len - 5, ".info")) ||
+           (len > 4 && !strcasecmp(name + len - 4, ".lgc"));
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_chk_dir
+// Description: Add all scripts in a directory, and its subdirectories, to the
+//              list of scripts to be checked.
+// Input:       const char *name:   Directory name.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_chk_dir(const char *name)
+{
+    DIR *dir = opendir(name);
+
+    if(!dir)
+    {
+        // Report and move on.
+        printf("%s:0: %s\n", name, "can't open directory");
+        return false;
+    }
+
+    bool ret = true;
+
+    for(struct dirent *ent = readdir(dir); ent; ent = readdir(dir))
+    {
+        if(h_chk_skip(ent->d_name))
+        {
+            continue;
+        }
+
+        char *path = h_tackon(NULL, name, ent->d_name);
+
+        // Recurse if we find a directory, keep going even if we fail to read
+        // it. Anything else will be parsed.
+        if(h_exists(path) == LG_DIR)
+        {
+            ret = h_chk_dir(path) && ret;
+            free(path);
+        }
+        else if(!h_chk_add(path))
+        {
+            // Out of memory.
+            ret = false;
+            break;
+        }
+    }
+
+    closedir(dir);
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_chk_some
+// Description: Check every 'step' script in the list starting with 'first'.
+// Input:       size_t first:   Index of the first script.
+//              size_t step:    Distance between scripts.
+// Return:      int:            0 if all scripts are OK, 1 otherwise.
+//------------------------------------------------------------------------------
+static int h_chk_some(size_t first, size_t step)
+{
+    int ret = 0;
+
+    for(size_t cur = first; cur < chk_num; cur += step)
+    {
+        // Syntax errors are reported by yyerror().
+        int res = parse(chk_lst[cur]);
+
+        if(res < 0)
+        {
+            printf("%s:0: %s\n", chk_lst[cur], "can't open file");
+        }
+
+        ret |= res ? 1 : 0;
+    }
+
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_chk_all
+// Description: Check all scripts in the list. On systems with fork() the work
+//              is split between one worker process per CPU. The parser isn't
+//              thread safe, the error state, buffers and so on are global, so
+//              processes is what we use. On other systems, or if we fail to
+//              fork, we do the work ourselves.
+// Input:       -
+// Return:      int:            0 if all scripts are OK, 1 otherwise.
+//------------------------------------------------------------------------------
+static int h_chk_all(void)
+{
+    #if defined(AMIGA) || defined(__MINGW32__)
+    return h_chk_some(0, 1);
+    #else
+    long cpu = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max = cpu > 1 ? (size_t) cpu : 1;
+
+    // No more workers than scripts.
+    max = max < chk_num ? max : chk_num;
+
+    if(max < 2)
+    {
+        return h_chk_some(0, 1);
+    }
+
+    // Flush what we have before forking, or it will be written by the workers
+    // as well.
+    fflush(stdout);
+
+    int ret = 0;
+    size_t run = 0;
+
+    for(size_t cur = 0; cur < max; cur++)
+    {
+        pid_t pid = fork();
+
+        if(!pid)
+        {
+            // Worker, check our share and leave without cleaning up, we're a
+            // copy of the parent.
+            int res = h_chk_some(cur, max);
+            fflush(stdout);
+            _exit(res);
+        }
+
+        if(pid < 0)
+        {
+            // Out of processes, do what's left ourselves.
+            for(; cur < max; cur++)
+            {
+                ret |= h_chk_some(cur, max);
+            }
+
+            break;
+        }
+
+        run++;
+    }
+
+    // Wait for all workers to finish.
+    for(; run; run--)
+    {
+        int sts;
+
+        if(wait(&sts) < 0 || !WIFEXITED(sts) || WEXITSTATUS(sts))
+        {
+            ret = 1;
+        }
+    }
+
+    return ret;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        chk_run
+// Description: Check the syntax of scripts without executing them.
+// Input:       char **paths:   NULL terminated array of scripts and / or
+//                              directories. Directories are searched
+//                              recursively.
+// Return:      int:            0 if all scripts are OK, 1 otherwise.
+//------------------------------------------------------------------------------
+int chk_run(char **paths)
+{
+    int ret = 0;
+
+    // One line at a time, lines from different workers must not be mixed up.
+    setvbuf(stdout, NULL, _IOLBF, BUFSIZ);
+
+    // Get the complete list of scripts first.
+    for(char **cur = paths; cur && *cur; cur++)
+    {
+        if(!(h_exists(*cur) == LG_DIR ? h_chk_dir(*cur) :
+             h_chk_add(DBG_ALLOC(strdup(*cur)))))
+        {
+            ret = 1;
+        }
+    }
+
+    ret |= h_chk_all();
+
+    // Free the list.
+    for(size_t cur = 0; cur < chk_num; cur++)
+    {
+        free(chk_lst[cur]);
+    }
+
+    free(chk_lst);
+    chk_lst = NULL;
+    chk_num = chk_cap = 0;
+    return ret;
+}
@@ -0,0 +1,15 @@
+//------------------------------------------------------------------------------
+// check.h:
+//
+// Syntax checking of scripts in batch.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef CHECK_H_
+#define CHECK_H_
+
+int chk_run(char **paths);
+
+#endif
@@ -343,7 +343,7 @@ inp_t gui_askfile(const char *msg, const char *hlp, bool pth, bool dsk,
     return G_TRUE;
 }
 
-inp_t gui_copyfiles_start(const char *msg, const char *hlp, pnode_p lst, bool cnf, bool bck)
+inp_t gui_copyfiles_start(const char *msg, const char *hlp, plan_p lst, bool cnf, bool bck)
 {
     (void)hlp;
     (void)lst;
@@ -369,6 +369,22 @@ inp_t gui_copyfiles_setcur(const char *cur, bool nga, bool bck)
     return G_TRUE;
 }
 
+inp_t gui_copyfiles_progress(const struct cprog_t *prg, bool nga, bool bck)
+{
+    static int pct = -1;
+    int cur = prg->max ? (int) (prg->cur * 100 / prg->max) : 100;
+
+    (void)bck;
+
+    if(!nga && cur != pct) {
+        pct = cur;
+        printf("Copying files %d%%, %lu KB/s, %ld s left.\n", cur,
+               (unsigned long) (prg->rat >> 10), (long) prg->eta);
+    }
+
+    return G_TRUE;
+}
+
 void gui_copyfiles_end(void)
 {
     printf("Finished copying files.\n");
@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "error.h"
+#include "file.h"
 #include "gui.h"
 #include "util.h"
 
@@ -88,6 +89,12 @@ err_t error(entry_p contxt, int32_t line, err_t type, const char *info)
     // Clear state or proper error?
     last = (type == ERR_RESET) ? ERR_NONE : type;
 
+    // Make sure that the log is complete if we're about to stop.
+    if(type != ERR_RESET)
+    {
+        h_log_flush();
+    }
+
     // RESET, ABORT or HALT.
     if(type <= ERR_RESET)
     {
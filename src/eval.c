@@ -9,11 +9,17 @@
 
 #include "alloc.h"
 #include "args.h"
+#include "control.h"
 #include "error.h"
 #include "eval.h"
 #include "exit.h"
+#include "file.h"
 #include "gui.h"
+#include "image.h"
+#include "init.h"
 #include "media.h"
+#include "meta.h"
+#include "probe.h"
 #include "resource.h"
 #include "util.h"
 #include <stdio.h>
@@ -438,13 +444,29 @@ entry_p invoke(entry_p entry)
     return ret;
 }
 
+// Streaming state, refer to stream().
+static struct
+{
+    entry_p status;   // The last resolved value.
+    size_t done;      // The number of executed statements in the root.
+    bool gui;         // GUI up and running.
+    bool go;          // GUI and (effect) OK, execute statements.
+    bool on;          // Streaming started.
+    bool keep;        // A (trace) in the root, nothing may be freed.
+    size_t sweep;     // Look for unused statements at this number.
+} stm;
+
 //------------------------------------------------------------------------------
-// Name:        run
-// Description: Run script. Setup and teardown of everything, GUI included.
-// Input:       entry_p entry:  The start symbol, refer to the parser.
-// Return:      -
+// Name:        h_run_init
+// Description: Run helper. i18n and GUI setup. If 'entry' contains an (effect)
+//              statement, a custom screen is used and (effect) is executed
+//              before anything else.
+// Input:       entry_p entry:  The start symbol, or the first statements when
+//                              streaming.
+// Return:      entry_p:        The (effect) return value, end() if there's no
+//                              (effect) and NULL if the GUI init failed.
 //------------------------------------------------------------------------------
-void run(entry_p entry)
+static entry_p h_run_init(entry_p entry)
 {
     // Is there an 'effect' statement in there?
     entry_p status = native_exists(entry, n_effect);
@@ -453,27 +475,32 @@ void run(entry_p entry)
     locale_init();
 
     // Initialize GUI. Use a custom screen if (effect) statement exists.
-    if(gui_init(status != false))
+    if(!gui_init(status != NULL))
     {
-        // If an 'effect' statement exists, execute this first of all.
-        if(status)
-        {
-            // Resolve 'effect' like a symbol.
-            status = resolve(status);
-        }
+        return NULL;
+    }
 
-        // Execute the script unless 'effect' failed or halted.
-        if(NOT_ERR && NOT_HALT)
-        {
-            status = invoke(entry);
+    // If an 'effect' statement exists, execute this first of all. Resolve
+    // 'effect' like a symbol.
+    return status ? resolve(status) : end();
+}
 
-            // Execute (onerror) on failure.
-            if(DID_ERR && NOT_HALT)
-            {
-                status = n_onerror(entry);
-            }
-        }
+//------------------------------------------------------------------------------
+// Name:        h_run_exit
+// Description: Run helper. Write (startup) edits, show the result, GUI, i18n
+//              and AST teardown.
+// Input:       entry_p entry:  The start symbol.
+//              entry_p status: The last resolved value, NULL if the GUI init
+//                              failed.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_run_exit(entry_p entry, entry_p status)
+{
+    // Write what's left of the (startup) edits.
+    h_startup_flush(entry);
 
+    if(status)
+    {
         // Output what we have unless we're running from WB.
         if(arg_argc(-1))
         {
@@ -484,7 +511,322 @@ void run(entry_p entry)
         gui_exit();
     }
 
+    // Write what's left to the log file.
+    h_log_close();
+    h_probe_free();
+    mc_free();
+
     // i18n and AST teardown.
     locale_exit();
     kill(entry);
 }
+
+//------------------------------------------------------------------------------
+// Name:        h_stream_owns
+// Description: Stream helper. Find out if an entry belongs to a statement.
+// Input:       entry_p entry:  The statement.
+//              entry_p item:   The entry.
+// Return:      bool:           'true' if 'item' belongs to 'entry', 'false'
+//                              otherwise.
+//------------------------------------------------------------------------------
+static bool h_stream_owns(entry_p entry, entry_p item)
+{
+    // Climb all the way to the root.
+    for(; item; item = item->parent)
+    {
+        if(item == entry)
+        {
+            return true;
+        }
+    }
+
+    // Not ours.
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_stream_used
+// Description: Stream helper. Find out if a statement is still needed, that is
+//              if it defines a procedure, owns any of the global symbols or the
+//              last resolved value.
+// Input:       entry_p contxt: The root context.
+//              entry_p entry:  The statement.
+// Return:      bool:           'true' if needed, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_stream_used(entry_p contxt, entry_p entry)
+{
+    // Everything after a (trace) might be executed again by (retrace).
+    if(stm.keep || h_stream_owns(entry, stm.status))
+    {
+        return true;
+    }
+
+    // Follow all symbols back to their owners.
+    for(entry_p *sym = contxt->symbols; exists(*sym); sym++)
+    {
+        if(h_stream_owns(entry, *sym))
+        {
+            return true;
+        }
+    }
+
+    // Not referenced.
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_stream_sweep
+// Description: Stream helper. Free executed statements that have lost their
+//              last reference since they were executed, typically (set) with
+//              variables that have been set again.
+// Input:       entry_p contxt: The root context.
+//              size_t num:     The number of executed statements.
+// Return:      size_t:         The number of statements left.
+//------------------------------------------------------------------------------
+static size_t h_stream_sweep(entry_p contxt, size_t num)
+{
+    entry_p *chl = contxt->children;
+    size_t dst = 0;
+
+    for(size_t src = 0; src < num; src++)
+    {
+        if(h_stream_used(contxt, chl[src]))
+        {
+            chl[dst++] = chl[src];
+            continue;
+        }
+
+        // The option cache might refer to this one.
+        opt_forget();
+        kill(chl[src]);
+    }
+
+    // Free slots must be NULL.
+    for(size_t src = dst; src < num; src++)
+    {
+        chl[src] = NULL;
+    }
+
+    return dst;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_stream_exec
+// Description: Stream helper. Execute the statements in the root that haven't
+//              been executed yet and free those that aren't needed anymore.
+// Input:       entry_p contxt: The root context.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_stream_exec(entry_p contxt)
+{
+    entry_p *chl = contxt->children;
+    size_t dst = stm.done, src = stm.done;
+
+    for(; exists(chl[src]); src++)
+    {
+        entry_p cur = chl[src];
+
+        // Nothing is executed after errors or (exit) / (abort).
+        if(stm.go && NOT_ERR)
+        {
+            stm.status = resolve(cur);
+            stm.keep = stm.keep || cur->call == n_trace;
+        }
+
+        if(h_stream_used(contxt, cur))
+        {
+            chl[dst++] = cur;
+            continue;
+        }
+
+        // The option cache might refer to this one.
+        opt_forget();
+        kill(cur);
+    }
+
+    // Free slots must be NULL.
+    while(src > dst)
+    {
+        chl[--src] = NULL;
+    }
+
+    // Look for statements that aren't needed anymore when the number of kept
+    // ones has doubled since the last time.
+    if(dst > stm.sweep)
+    {
+        dst = h_stream_sweep(contxt, dst);
+        stm.sweep = dst << 1;
+    }
+
+    stm.done = dst;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_stream_add
+// Description: Stream helper. Move statements to the root. Unlike merge(), the
+//              root is grown in place, most of the time there's room already.
+// Input:       entry_p contxt: The root context.
+//              entry_p stmts:  A CONTXT with the new statements.
+// Return:      entry_p:        The root context.
+//------------------------------------------------------------------------------
+static entry_p h_stream_add(entry_p contxt, entry_p stmts)
+{
+    if(!contxt || !contxt->children || !stmts || !stmts->children)
+    {
+        // Bad input.
+        kill(stmts);
+        PANIC(contxt);
+        return contxt;
+    }
+
+    // Adopt all statements.
+    for(entry_p *cur = stmts->children; exists(*cur); cur++)
+    {
+        if(append(&contxt->children, *cur))
+        {
+            (*cur)->parent = contxt;
+            *cur = NULL;
+        }
+    }
+
+    // Free the empty shell.
+    kill(stmts);
+    return contxt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        stream
+// Description: Parser callback for top level statements. Unless streaming is
+//              enabled, the statements are merged into the root and nothing
+//              else happens. When streaming, statements are executed as soon
+//              as they've been parsed. Refer to run().
+// Input:       entry_p contxt: The root context, NULL before the first
+//                              statements have been parsed.
+//              entry_p stmts:  A CONTXT with the new statements, NULL at the
+//                              end of the script.
+// Return:      entry_p:        The root context.
+//------------------------------------------------------------------------------
+entry_p stream(entry_p contxt, entry_p stmts)
+{
+    // Build the complete tree if we're not streaming. Compile and check mode
+    // win.
+    if(!arg_get(ARG_STREAM) || arg_get(ARG_COMPILE) || arg_get(ARG_CHECK))
+    {
+        return !stmts ? init(contxt) :
+               (contxt ? h_stream_add(contxt, stmts) : stmts);
+    }
+
+    // Append the shutdown code at the end of the script. It's executed by
+    // run() since it doesn't belong to any statement.
+    if(!stmts)
+    {
+        return init_stream(contxt, true);
+    }
+
+    if(!contxt)
+    {
+        // The first statements are the root. Startup code and GUI goes first.
+        contxt = init_stream(stmts, false);
+        stm.status = h_run_init(contxt);
+        stm.gui = stm.status != NULL;
+        stm.on = true;
+
+        // Don't execute anything if (effect) failed or halted.
+        stm.go = stm.gui && NOT_ERR;
+    }
+    else
+    {
+        contxt = h_stream_add(contxt, stmts);
+    }
+
+    // Execute what we have so far.
+    h_stream_exec(contxt);
+    return contxt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        stop
+// Description: Free what's left after a syntax error. If we've been streaming,
+//              statements might have been executed already, and the GUI must
+//              be torn down as well.
+// Input:       entry_p entry:  The root context.
+// Return:      -
+//------------------------------------------------------------------------------
+void stop(entry_p entry)
+{
+    if(stm.on)
+    {
+        // Finish what we started.
+        run(entry);
+        return;
+    }
+
+    // Nothing executed, nothing to tear down.
+    kill(entry);
+}
+
+//------------------------------------------------------------------------------
+// Name:        run
+// Description: Run script. Setup and teardown of everything, GUI included.
+// Input:       entry_p entry:  The start symbol, refer to the parser.
+// Return:      -
+//------------------------------------------------------------------------------
+void run(entry_p entry)
+{
+    // Nothing to execute or save if we're checking the syntax only.
+    if(arg_get(ARG_CHECK))
+    {
+        kill(entry);
+        return;
+    }
+
+    // Save the script as an image instead of executing it in compile mode.
+    if(arg_get(ARG_COMPILE))
+    {
+        if(!img_save(entry, arg_get(ARG_SCRIPT)))
+        {
+            // Typically a write protected directory.
+            fprintf(stderr, tr(S_CNOF), arg_get(ARG_SCRIPT));
+        }
+
+        // Nothing more to do.
+        kill(entry);
+        return;
+    }
+
+    // When streaming, all statements but the shutdown code have been executed
+    // by now. Refer to stream().
+    if(stm.on)
+    {
+        // Execute the shutdown code, if any.
+        h_stream_exec(entry);
+
+        // Execute (onerror) on failure.
+        if(stm.go && DID_ERR && NOT_HALT)
+        {
+            stm.status = n_onerror(entry);
+        }
+
+        h_run_exit(entry, stm.gui ? stm.status : NULL);
+        stm.on = false;
+        return;
+    }
+
+    // Setup and (effect).
+    entry_p status = h_run_init(entry);
+
+    // Execute the script unless 'effect' failed or halted.
+    if(status && NOT_ERR && NOT_HALT)
+    {
+        status = invoke(entry);
+
+        // Execute (onerror) on failure.
+        if(DID_ERR && NOT_HALT)
+        {
+            status = n_onerror(entry);
+        }
+    }
+
+    // Teardown.
+    h_run_exit(entry, status);
+}
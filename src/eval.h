@@ -16,9 +16,11 @@
 int32_t num(entry_p entry);
 bool tru(entry_p entry);
 void run(entry_p entry);
+void stop(entry_p entry);
 char *str(entry_p entry);
 entry_p invoke(entry_p entry);
 entry_p resolve(entry_p entry);
 entry_p find_symbol(entry_p entry);
+entry_p stream(entry_p contxt, entry_p stmts);
 
 #endif
@@ -13,6 +13,7 @@
 #include "external.h"
 #include "file.h"
 #include "gui.h"
+#include "meta.h"
 #include "resource.h"
 #include "util.h"
 #include <stdio.h>
@@ -175,6 +176,9 @@ static entry_p h_run(entry_p contxt, const char *pre, const char *dir)
         printf("%s%s", cmd, dir ? dir : "");
         #endif
 
+        // We don't know what the command did to the file system.
+        mc_clear();
+
         // Go back to where we started if we've changed directory.
         if(cwd && chdir(cwd))
         {
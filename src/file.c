@@ -8,21 +8,28 @@
 //------------------------------------------------------------------------------
 
 #include "alloc.h"
+#include "args.h"
 #include "debug.h"
 #include "error.h"
 #include "eval.h"
 #include "file.h"
 #include "gui.h"
+#include "match.h"
+#include "meta.h"
+#include "plan.h"
 #include "probe.h"
 #include "resource.h"
 #include "strop.h"
+#include "uring.h"
 #include "util.h"
 #include <ctype.h>
 #include <dirent.h>
 #include <limits.h>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 #include <errno.h>
 
@@ -30,6 +37,21 @@
 #define mkdir(a, b) mkdir(a)
 #endif
 
+#if !defined(AMIGA) && !defined(__MINGW32__)
+#include <fcntl.h>
+#include <pthread.h>
+#endif
+
+#if !defined(AMIGA)
+#include <utime.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif
+
 #ifdef AMIGA
 #include <dos/dos.h>
 #include <dos/dosasl.h>
@@ -127,74 +149,58 @@ bool h_confirm(entry_p contxt, const char *hlp, const char *msg, ...)
     return (grc == G_TRUE) || ((grc == G_ABORT || grc == G_EXIT) && HALT);
 }
 
-#if defined(AMIGA)
 //------------------------------------------------------------------------------
-// Name:        h_exists_amiga_type
-// Description: h_exists amiga implementation.
+// Name:        h_exists_size
+// Description: Get file / dir info and the size of files.
 // Input:       const char *name:   Path to file / dir.
+//              uint64_t *siz:      Size of file, or NULL. Left as it is unless
+//                                  'name' is a file.
 // Return:      int32_t:            LG_NONE/LG_FILE/LG_DIR
 //------------------------------------------------------------------------------
-static int32_t h_exists_amiga_type(const char *name)
+static int32_t h_exists_size(const char *name, uint64_t *siz)
 {
-    struct FileInfoBlock *fib = (struct FileInfoBlock *)
-           AllocDosObject(DOS_FIB, NULL);
-
-    if(!fib && PANIC(NULL))
+    // NULL is a valid argument but this 'file' doesn't exist.
+    if(!name)
     {
         return LG_NONE;
     }
 
-    // Attempt to lock file or directory.
-    BPTR lock = (BPTR) Lock(name, ACCESS_READ);
-    int32_t type = LG_NONE;
-
-    // Get information from lock.
-    if(lock && Examine(lock, fib))
+    // Empty string = current dir.
+    if(!(*name))
     {
-        // ST_FILE (-3) ST_LINKFILE (-4)
-        if(fib->fib_DirEntryType < 0)
-        {
-            // It's a file.
-            type = LG_FILE;
-        }
-        // ST_ROOT (1) ST_USERDIR (2) ST_SOFTLINK (3) ST_LINKDIR (4)
-        else if(fib->fib_DirEntryType > 0)
-        {
-            // It's a directory.
-            type = LG_DIR;
-        }
+        return LG_DIR;
     }
 
-    // Release lock to file, directory or nothing.
-    UnLock(lock);
+    struct meta_t met;
+    mc_get(name, &met);
 
-    FreeDosObject(DOS_FIB, fib);
-    return type;
+    if(met.type == LG_FILE && siz)
+    {
+        *siz = met.size;
+    }
+
+    return met.type;
 }
-#else
+
 //------------------------------------------------------------------------------
-// Name:        h_exists_posix_type
-// Description: h_exists posix implementation.
+// Name:        h_exists_check
+// Description: Like h_exists(), but never trust the cache about missing files,
+//              refer to mc_check(). Used by (exists).
 // Input:       const char *name:   Path to file / dir.
 // Return:      int32_t:            LG_NONE/LG_FILE/LG_DIR
 //------------------------------------------------------------------------------
-static int32_t h_exists_posix_type(const char *name)
+static int32_t h_exists_check(const char *name)
 {
-    struct stat fst;
-
-    if(stat(name, &fst))
+    if(!name || !*name)
     {
-        // No such file or directory.
-        return LG_NONE;
+        // Refer to h_exists_size().
+        return name ? LG_DIR : LG_NONE;
     }
 
-    // A file, a directory or something else.
-    bool file = S_ISREG(fst.st_mode), dir = S_ISDIR(fst.st_mode);
-
-    // Translate to Installer return values.
-    return file ? LG_FILE : dir ? LG_DIR : LG_NONE;
+    struct meta_t met;
+    mc_check(name, &met);
+    return met.type;
 }
-#endif
 
 //------------------------------------------------------------------------------
 // Name:        h_exists
@@ -206,23 +212,7 @@ static int32_t h_exists_posix_type(const char *name)
 //------------------------------------------------------------------------------
 int32_t h_exists(const char *name)
 {
-    // NULL is a valid argument but this 'file' doesn't exist.
-    if(!name)
-    {
-        return LG_NONE;
-    }
-
-    // Empty string = current dir.
-    if(!(*name))
-    {
-        return LG_DIR;
-    }
-
-    #if defined(AMIGA)
-    return h_exists_amiga_type(name);
-    #else
-    return h_exists_posix_type(name);
-    #endif
+    return h_exists_size(name, NULL);
 }
 
 //------------------------------------------------------------------------------
@@ -312,171 +302,476 @@ static char *h_suffix(const char *stem, const char *suffix)
 
 //------------------------------------------------------------------------------
 // Name:        h_suffix_append
-// Description: Append file / directory suffix and append the result to a
-//              node list. If the resulting file / directory doesn't exist,
-//              nothing will be appended.
-// Input:       entry_p node:   List tail.
+// Description: Append file / directory suffix to the last entry of a plan and
+//              add the result to the plan. If the resulting file / directory
+//              doesn't exist, nothing will be added.
+// Input:       entry_p contxt: The execution context.
+//              plan_p pln:     Plan.
 //              char *suffix:   Suffix to append.
-// Return:      entry_p:        New tail.
+// Return:      -
 //------------------------------------------------------------------------------
-static pnode_p h_suffix_append(entry_p contxt, pnode_p node, char *suffix)
+static void h_suffix_append(entry_p contxt, plan_p pln, char *suffix)
 {
-    // Make sure that we have a node and that it's the tail of the list.
-    if(!node || node->next)
+    // Make sure that we have something to append to.
+    if(!pln->num)
+    {
+        return;
+    }
+
+    size_t lst = pln->num - 1;
+    char *name = DBG_ALLOC(strdup(h_suffix(pl_src(pln, lst), suffix)));
+
+    if(!name && PANIC(contxt))
     {
-        return node;
+        return;
     }
 
     // Save type of the result, it might not be the same as the non suffixed
     // entry (e.g mydir -> mydir.info).
-    int32_t type = h_exists(h_suffix(node->name, suffix));
+    uint64_t siz = 0;
+    int32_t type = h_exists_size(name, &siz);
+    const char *copy = h_suffix(pl_dst(pln, lst, NULL), suffix);
 
     // Make sure that the source file / directory exists and that both source
     // and destination file / directories are valid as prefixes. They must be
     // non empty strings and volume names aren't allowed (e.g Work:.info).
-    if(type == LG_NONE || !*h_suffix(node->copy, suffix) ||
-       !*h_suffix(node->name, suffix))
+    if(type != LG_NONE && *copy && *name)
     {
-        return node;
-    }
-
-    // New list tail.
-    pnode_p tail = node;
-
-    // It's not necessary to check the return value.
-    tail->next = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
+        if(!pl_add(pln, name, copy, "", type))
+        {
+            PANIC(contxt);
+        }
 
-    if(!tail->next && PANIC(contxt))
-    {
-        return tail;
+        pl_size(pln, siz);
     }
 
-    // New list tail.
-    tail = tail->next;
-    tail->name = DBG_ALLOC(strdup(h_suffix(node->name, suffix)));
-    tail->copy = DBG_ALLOC(strdup(h_suffix(node->copy, suffix)));
-    tail->type = type;
-
-    return tail;
+    free(name);
 }
 
 //------------------------------------------------------------------------------
 // Name:        h_filetree
 // Description: Decl. needed by h_choices(). See description further down.
 //------------------------------------------------------------------------------
-static pnode_p h_filetree(entry_p contxt, const char *srt, const char *src,
-                          const char *dst, entry_p files, entry_p fonts,
-                          entry_p choices, entry_p pattern, entry_p infos);
+static void h_filetree(entry_p contxt, plan_p pln, const char *srt,
+                       const char *src, const char *dst, entry_p files,
+                       entry_p fonts, entry_p choices, entry_p pattern,
+                       entry_p infos);
 
 //------------------------------------------------------------------------------
 // Name:        h_choices
 // Description: Helper for h_filetree handling (choices). Generating a complete
 //              file / directory tree with source and destination tuples.
 // Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Plan to add files and dirs to.
 //              entry_p choices:    * List of files.
 //              entry_p fonts:      * Include fonts.
 //              entry_p infos:      * Include icons.
 //                                  * Refer to the Installer.guide.
 //              const char *src:    Source directory.
 //              const char *dst:    Destination directory.
-// Return:      entry_p:            A linked list of file and dir pairs.
+// Return:      -
 //------------------------------------------------------------------------------
-static pnode_p h_choices(entry_p contxt, entry_p choices, entry_p fonts,
-                         entry_p infos, const char *src, const char *dst)
+static void h_choices(entry_p contxt, plan_p pln, entry_p choices,
+                      entry_p fonts, entry_p infos, const char *src,
+                      const char *dst)
 {
     if(!contxt || !choices || !choices->children || !src || !dst)
     {
         // Bad input.
         PANIC(contxt);
-        return NULL;
+        return;
     }
 
-    // Unless the parser is broken, we will have >= one child.
-    entry_p *chl = choices->children;
-
-    // Create head node.
-    pnode_p node = DBG_ALLOC(calloc(1, sizeof(struct pnode_t))), head = node;
-
-    if(!node && PANIC(contxt))
+    // We already know the type of the first element; it's a directory.
+    if(!pl_add(pln, src, dst, "", LG_DIR) && PANIC(contxt))
     {
-        return NULL;
+        return;
     }
 
-    // We already know the type of the first element; it's a directory.
-    node->name = DBG_ALLOC(strdup(src));
-    node->copy = DBG_ALLOC(strdup(dst));
-    node->type = LG_DIR;
-
-    // Not necessary to check the return value.
-    node->next = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
-    node = node->next;
-
-    // Iterate over all files / dirs.
-    while(node)
+    // Iterate over all files / dirs. Unless the parser is broken, we will
+    // have >= one child.
+    for(entry_p *chl = choices->children; exists(*chl); chl++)
     {
         // Resolve current file.
         char *f_nam = str(*chl);
 
         // Build source <-> dest pair.
-        node->name = DBG_ALLOC(h_tackon(contxt, src, f_nam));
-        node->copy = h_tackon(contxt, dst, h_fileonly(contxt, f_nam));
-        node->type = h_exists(node->name);
-
-        // Next file.
-        chl++;
+        char *name = DBG_ALLOC(h_tackon(contxt, src, f_nam)),
+             *copy = h_tackon(contxt, dst, h_fileonly(contxt, f_nam));
+        uint64_t siz = 0;
+        int32_t type = h_exists_size(name, &siz);
 
         // Make sure that the file / dir exists. But only in strict mode,
         // otherwise just go on, missing files will be skipped during file
         // copy anyway.
-        if(node->type == LG_NONE && get_num(contxt, "@strict") &&
+        if(type == LG_NONE && get_num(contxt, "@strict") &&
           !opt(contxt, OPT_NOFAIL))
         {
             // File or directory doesn't exist.
-            ERR(ERR_NO_SUCH_FILE_OR_DIR, node->name);
-            return head;
+            ERR(ERR_NO_SUCH_FILE_OR_DIR, name);
+            free(name);
+            free(copy);
+            return;
+        }
+
+        // Without a valid source and destination there's nothing to copy.
+        if(name && copy)
+        {
+            if(!pl_add(pln, name, copy, "", type) && PANIC(contxt))
+            {
+                free(name);
+                free(copy);
+                return;
+            }
+
+            // Used by the progress report only.
+            pl_size(pln, siz);
+
+            // Add .info and .font files if necessary.
+            if(infos)
+            {
+                h_suffix_append(contxt, pln, "info");
+            }
+
+            if(fonts)
+            {
+                h_suffix_append(contxt, pln, "font");
+            }
+
+            // Traverse (old, if info or font) directory if applicable.
+            if(type == LG_DIR
+               #ifndef AMIGA
+               && strcmp(f_nam, ".") && strcmp(f_nam, "..")
+               #endif
+               )
+            {
+                // Get tree of subdirectory. Don't promote (choices).
+                h_filetree(contxt, pln, src, name, copy, NULL, NULL, NULL,
+                           NULL, NULL);
+            }
+        }
+
+        free(name);
+        free(copy);
+    }
+}
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+//------------------------------------------------------------------------------
+// Name:        h_filetree_type
+// Description: Get the type of a directory entry, relative to the directory
+//              it was read from. Use the type returned by readdir() if there
+//              is one, fall back to fstatat() for links and file systems that
+//              don't give us any. Links are followed, just like h_exists().
+//              Files always need fstatat() to get their size.
+// Input:       DIR *dir:               Directory.
+//              struct dirent *ent:     Entry in 'dir'.
+//              uint64_t *siz:          Size of file.
+// Return:      int32_t:                LG_NONE/LG_FILE/LG_DIR
+//------------------------------------------------------------------------------
+static int32_t h_filetree_type(DIR *dir, struct dirent *ent, uint64_t *siz)
+{
+    *siz = 0;
+
+    #if defined(DT_UNKNOWN)
+    if(ent->d_type == DT_DIR)
+    {
+        // A plain directory.
+        return LG_DIR;
+    }
+
+    if(ent->d_type != DT_REG && ent->d_type != DT_LNK &&
+       ent->d_type != DT_UNKNOWN)
+    {
+        // Devices, pipes and sockets.
+        return LG_NONE;
+    }
+    #endif
+
+    struct stat fst;
+
+    if(fstatat(dirfd(dir), ent->d_name, &fst, 0))
+    {
+        // Broken link.
+        return LG_NONE;
+    }
+
+    *siz = S_ISREG(fst.st_mode) ? (uint64_t) fst.st_size : 0;
+
+    return S_ISREG(fst.st_mode) ? LG_FILE : S_ISDIR(fst.st_mode) ? LG_DIR :
+           LG_NONE;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_filetree_open
+// Description: Open subdirectory for reading. On POSIX systems the directory
+//              is opened relative to its parent, no path lookup needed.
+// Input:       DIR *dir:               Parent directory.
+//              struct dirent *ent:     Entry in 'dir'.
+//              const char *path:       Full path of the subdirectory.
+// Return:      DIR *:                  Subdirectory or NULL on error.
+//------------------------------------------------------------------------------
+static DIR *h_filetree_open(DIR *dir, struct dirent *ent, const char *path)
+{
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    int fd = openat(dirfd(dir), ent->d_name, O_RDONLY | O_DIRECTORY);
+    DIR *sub = fd < 0 ? NULL : fdopendir(fd);
+
+    if(!sub && fd >= 0)
+    {
+        close(fd);
+    }
+
+    (void) path;
+    return sub;
+    #else
+    (void) dir;
+    (void) ent;
+    return opendir(path);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_filetree_cat
+// Description: Concatenate path prefix and name.
+// Input:       const char *pre:    Prefix, empty or ending with a delimiter.
+//              const char *name:   Name.
+//              bool dlm:           Append delimiter, making it a new prefix.
+// Return:      char *:             New path, NULL if out of memory.
+//------------------------------------------------------------------------------
+static char *h_filetree_cat(const char *pre, const char *name, bool dlm)
+{
+    size_t pln = strlen(pre), nln = strlen(name), len = pln + nln;
+    char *ret = DBG_ALLOC(calloc(len + 2, 1));
+
+    if(ret)
+    {
+        memcpy(ret, pre, pln);
+        memcpy(ret + pln, name, nln);
+
+        // No delimiter needed if empty or if we have one already.
+        if(dlm && len && ret[len - 1] != '/' && ret[len - 1] != ':')
+        {
+            ret[len] = '/';
+        }
+    }
+
+    return ret;
+}
+
+// Directory being read by h_filetree_dir.
+struct tframe_t
+{
+    DIR *dir;
+    char *spre;
+    char *dpre;
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_filetree_close
+// Description: Close directory and free its path prefixes.
+// Input:       struct tframe_t *frm:   Directory.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_filetree_close(struct tframe_t *frm)
+{
+    closedir(frm->dir);
+    free(frm->spre);
+    free(frm->dpre);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_filetree_dir
+// Description: Directory part of h_filetree. Walks the tree depth first using
+//              an explicit stack of open directories. Entries are added with
+//              the path prefixes of their directory, full paths are only
+//              created when needed.
+// Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Plan to add files and dirs to.
+//              const char *srt:    Source root.
+//              const char *src:    Source directory.
+//              const char *dst:    Destination directory.
+//              entry_p files:      * Files only.
+//              entry_p pattern:    * File / dir pattern.
+//              entry_p infos:      * Include icons.
+//                                  * Refer to the Installer.guide.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_filetree_dir(entry_p contxt, plan_p pln, const char *srt,
+                           const char *src, const char *dst, entry_p files,
+                           entry_p pattern, entry_p infos)
+{
+    struct tframe_t stk[LG_MAXDEP + 1];
+    DIR *dir = opendir(src);
+
+    if(!dir)
+    {
+        // Could not read from dir.
+        ERR(ERR_READ_DIR, src);
+        return;
+    }
+
+    // Start at the top.
+    size_t num = 1;
+    stk[0].dir = dir;
+    stk[0].spre = h_filetree_cat(src, "", true);
+    stk[0].dpre = h_filetree_cat(dst, "", true);
+
+    // The type of the first element is known; it's a directory.
+    bool run = stk[0].spre && stk[0].dpre && pl_add(pln, src, dst, "", LG_DIR);
+
+    if(!run)
+    {
+        PANIC(contxt);
+    }
+    else if(infos)
+    {
+        // Create .info entry if necessary.
+        h_suffix_append(contxt, pln, "info");
+    }
+
+    // Full pattern, only used on the top level.
+    char *pat = pattern ? h_tackon(contxt, srt, str(pattern)) : NULL;
+
+    // Nothing but the directory itself without a valid pattern.
+    run = run && (!pattern || pat);
+
+    while(run && num)
+    {
+        struct tframe_t *cur = stk + num - 1;
+        struct dirent *entry = readdir(cur->dir);
+
+        // Done with this directory?
+        if(!entry)
+        {
+            // Back to the parent.
+            h_filetree_close(cur);
+            num--;
+            continue;
         }
 
-        int32_t type = node->type;
-        char *name = node->name, *copy = node->copy;
+        #ifndef AMIGA
+        if(!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+        {
+            // Not part of the tree.
+            continue;
+        }
+        #endif
+
+        // Full source path, only created if needed.
+        char *path = NULL;
+        uint64_t siz = 0;
 
-        // Create .info and .font nodes if necessary. No need to check node
-        // pointer. Bounce and PANIC in h_suffix_append.
-        node = infos ? h_suffix_append(contxt, node, "info") : node;
-        node = fonts ? h_suffix_append(contxt, node, "font") : node;
+        #if !defined(AMIGA) && !defined(__MINGW32__)
+        // File or directory?
+        int32_t type = h_filetree_type(cur->dir, entry, &siz);
+        #else
+        path = h_filetree_cat(cur->spre, entry->d_name, false);
+
+        // File or directory?
+        int32_t type = h_exists_size(path, &siz);
+        #endif
+
+        if(pat && num == 1)
+        {
+            path = path ? path : h_filetree_cat(cur->spre, entry->d_name,
+                                                false);
+
+            #if defined(AMIGA) && !defined(LG_TEST)
+            // The CBM implementation restricts pattern length to 64.
+            // MatchPattern() can use a lot of stack if patterns are
+            // long. To preserve stack, keep the static pattern size
+            // but increase it to whatever buf_len() is.
+            LONG w = ParsePatternNoCase(pat, buf_get(B_KEY), buf_len());
+
+            // Use string comparison if we don't have any wildcards, use
+            // pattern matching if we do.
+            if(!path || !((w == 0 && strcasecmp(pat, path) == 0) ||
+                          (w > 0 && MatchPatternNoCase(buf_get(B_KEY),
+                                                       path))))
+            {
+                // Not a match.
+                type = LG_NONE;
+            }
+            #else
+            // Get rid of warning and increase test coverage.
+            snprintf(buf_get(B_KEY), buf_len(), "%s:%s", srt,
+                     path ? path : "");
+            #endif
+
+            // Unlock buffer.
+            buf_put(B_KEY);
+        }
+
+        // No need to store directory names if the (files) option is set.
+        if(type == LG_DIR && files)
+        {
+            free(path);
+            continue;
+        }
 
-        // Traverse (old, if info or font) directory if applicable.
-        if(type == LG_DIR
-           #ifndef AMIGA
-           && strcmp(f_nam, ".") && strcmp(f_nam, "..")
-           #endif
-           )
+        // Descend if we have a directory.
+        if(type == LG_DIR)
         {
-            // Get tree of subdirectory. Don't promote (choices).
-            node->next = h_filetree
-            (
-                contxt, src, name, copy, NULL, NULL, NULL, NULL, NULL
-            );
+            struct tframe_t *sub = stk + num;
 
-            // Fast forward to the end of the list.
-            while(node->next)
+            // Keep track of recursion depth.
+            if(num > LG_MAXDEP)
             {
-                node = node->next;
+                // This is not a realistic path.
+                ERR(ERR_MAX_DEPTH, contxt->name);
+                free(path);
+                continue;
+            }
+
+            sub->dir = h_filetree_open(cur->dir, entry, path);
+
+            if(!sub->dir)
+            {
+                // Could not read from dir.
+                path = path ? path : h_filetree_cat(cur->spre, entry->d_name,
+                                                    false);
+                ERR(ERR_READ_DIR, path);
+                free(path);
+                continue;
+            }
+
+            // Don't promote pattern or (infos), if we have a dir match,
+            // everything in that dir should be copied.
+            sub->spre = h_filetree_cat(cur->spre, entry->d_name, true);
+            sub->dpre = h_filetree_cat(cur->dpre, entry->d_name, true);
+            num++;
+
+            if(!sub->spre || !sub->dpre)
+            {
+                // Out of memory.
+                free(path);
+                PANIC(contxt);
+                break;
             }
         }
 
-        // If there are more files, allocate memory for the next node.
-        if(exists(*chl))
+        free(path);
+
+        // Source and destination share the name.
+        if(!pl_add(pln, cur->spre, cur->dpre, entry->d_name, type))
         {
-            // Not necessary to check the return value.
-            node->next = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
+            PANIC(contxt);
+            break;
         }
 
-        // Next element.
-        node = node ? node->next : node;
+        // Used by the progress report only.
+        pl_size(pln, type == LG_FILE ? siz : 0);
     }
 
-    // List complete.
-    return head;
+    // Close whatever is left open on failure.
+    for(; num; num--)
+    {
+        h_filetree_close(stk + num - 1);
+    }
+
+    free(pat);
 }
 
 //------------------------------------------------------------------------------
@@ -484,6 +779,7 @@ static pnode_p h_choices(entry_p contxt, entry_p choices, entry_p fonts,
 // Description: Generate a complete file / directory tree with source and
 //              destination tuples. Used by n_copyfiles.
 // Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Plan to add files and dirs to.
 //              const char *srt:    Source root.
 //              const char *src:    Source directory / file.
 //              const char *dst:    Destination directory.
@@ -493,28 +789,29 @@ static pnode_p h_choices(entry_p contxt, entry_p choices, entry_p fonts,
 //              entry_p pattern:    * File / dir pattern.
 //              entry_p infos:      * Include icons (choices).
 //                                  * Refer to the Installer.guide.
-// Return:      entry_p:            A linked list of file and dir pairs.
+// Return:      -
 //------------------------------------------------------------------------------
-static pnode_p h_filetree(entry_p contxt, const char *srt, const char *src,
-                          const char *dst, entry_p files, entry_p fonts,
-                          entry_p choices, entry_p pattern, entry_p infos)
+static void h_filetree(entry_p contxt, plan_p pln, const char *srt,
+                       const char *src, const char *dst, entry_p files,
+                       entry_p fonts, entry_p choices, entry_p pattern,
+                       entry_p infos)
 {
-    char *n_src = NULL, *n_dst = NULL;
-
     if((!src || !dst) && PANIC(contxt))
     {
         // Bad input.
-        return NULL;
+        return;
     }
 
     // File enumeration.
     if(choices)
     {
         // No need for recursion. Handle enumerations separately.
-        return h_choices(contxt, choices, fonts, infos, src, dst);
+        h_choices(contxt, pln, choices, fonts, infos, src, dst);
+        return;
     }
 
-    int32_t type = h_exists(src);
+    uint64_t siz = 0;
+    int32_t type = h_exists_size(src, &siz);
 
     if(type == LG_NONE)
     {
@@ -525,278 +822,58 @@ static pnode_p h_filetree(entry_p contxt, const char *srt, const char *src,
         }
 
         // It's neither a directory or a file.
-        return NULL;
+        return;
     }
 
     // Is source a directory?
     if(type == LG_DIR)
     {
-        DIR *dir = opendir(src);
+        h_filetree_dir(contxt, pln, srt, src, dst, files, pattern, infos);
+        return;
+    }
 
-        if(!dir)
-        {
-            // Could not read from dir.
-            ERR(ERR_READ_DIR, src);
-            return NULL;
-        }
+    // The destination of the first entry will be a directory even though the
+    // source is a file. We need somewhere to put the file. The second entry
+    // will be the file.
+    char *copy = h_tackon(contxt, dst, h_fileonly(contxt, src));
+    bool done = copy && pl_add(pln, src, dst, "", LG_DIR) &&
+                pl_add(pln, src, copy, "", LG_FILE);
 
-        // Create head node.
-        pnode_p node = DBG_ALLOC(calloc(1, sizeof(struct pnode_t))),
-                head = node;
+    free(copy);
+    pl_size(pln, siz);
 
-        if(node)
-        {
-            struct dirent *entry = readdir(dir);
+    if(done && fonts)
+    {
+        // Font file = name + .font.
+        snprintf(buf_get(B_KEY), buf_len(), "%s.font", src);
 
-            // The type of the first element is known; it's a directory.
-            node->name = DBG_ALLOC(strdup(src));
-            node->copy = DBG_ALLOC(strdup(dst));
-            node->type = LG_DIR;
+        if(h_exists_size(buf_get(B_KEY), &siz) == LG_FILE)
+        {
+            copy = h_tackon(contxt, dst, h_fileonly(contxt, buf_get(B_KEY)));
+            done = copy && pl_add(pln, buf_get(B_KEY), copy, "", LG_FILE);
+            pl_size(pln, siz);
+            free(copy);
+        }
 
-            // Create .info node if necessary. No need to check node pointer.
-            // Bounce and PANIC in h_suffix_append.
-            node = infos ? h_suffix_append(contxt, node, "info") : node;
+        // Name no longer needed.
+        buf_put(B_KEY);
+    }
 
-            // Iterate over all entries in the source directory.
-            while(entry)
-            {
-                // Create the source destination tuple
-                n_src = h_tackon(contxt, src, entry->d_name),
-                n_dst = DBG_ALLOC(h_tackon(contxt, dst, entry->d_name));
+    if(!done)
+    {
+        // Out of memory or invalid destination.
+        PANIC(contxt);
+    }
+}
 
-                // Out of memory?
-                if(!n_src || !n_dst)
-                {
-                    free(n_src);
-                    free(n_dst);
-                    break;
-                }
-
-                if(pattern)
-                {
-                    // Create full pattern temp buffer.
-                    char *pat = h_tackon(contxt, srt, str(pattern));
-
-                    // Out of memory?
-                    if(!pat)
-                    {
-                        free(n_src);
-                        free(n_dst);
-                        break;
-                    }
-
-                    #if defined(AMIGA) && !defined(LG_TEST)
-                    // The CBM implementation restricts pattern length to 64.
-                    // MatchPattern() can use a lot of stack if patterns are
-                    // long. To preserve stack, keep the static pattern size
-                    // but increase it to whatever buf_len() is.
-                    LONG w = ParsePatternNoCase(pat, buf_get(B_KEY), buf_len());
-
-                    // Use string comparison if we don't have any wildcards.
-                    if(w == 0 && strcasecmp(pat, n_src) == 0)
-                    {
-                        // Get type of match.
-                        type = h_exists(n_src);
-                    }
-                    // Use pattern matching if we have any wildcards.
-                    else if(w > 0 && MatchPatternNoCase(buf_get(B_KEY), n_src))
-                    {
-                        // Get type of match.
-                        type = h_exists(n_src);
-                    }
-                    else
-                    {
-                        // Not a match.
-                        type = LG_NONE;
-                    }
-                    #else
-                    // Get rid of warning and increase test coverage.
-                    snprintf(buf_get(B_KEY), buf_len(), "%s:%s", srt, n_src);
-                    type = h_exists(n_src);
-                    #endif
-
-                    // Unlock buffer and release full pattern temp.
-                    buf_put(B_KEY);
-                    free(pat);
-                }
-                else
-                {
-                    // File or directory?
-                    type = h_exists(n_src);
-                }
-
-                // Recur if we have a directory.
-                if(type == LG_DIR)
-                {
-                    // Unless the (files) option is set.
-                    if(!files
-                       #ifndef AMIGA
-                       && strcmp(entry->d_name, ".")
-                       && strcmp(entry->d_name, "..")
-                       #endif
-                      )
-                    {
-                        // Keep track of recursion depth.
-                        static size_t dep;
-
-                        if(dep++ < LG_MAXDEP)
-                        {
-                            // Get subdirectory tree. Don't promote (choices),
-                            // dirs will be considered files. Don't promote
-                            // pattern, if we have a dir match, everything in
-                            // that dir should be copied.
-                            node->next = h_filetree(contxt, srt, n_src, n_dst,
-                                                    files, fonts, NULL, NULL,
-                                                    NULL);
-                            dep--;
-
-                            // Fast forward to the end of the list.
-                            while(node->next)
-                            {
-                                node = node->next;
-                            }
-                        }
-                        else
-                        {
-                            // This is not a realistic path.
-                            ERR(ERR_MAX_DEPTH, contxt->name);
-                        }
-                    }
-
-                    // No need to store directory names.
-                    free(n_src);
-                    free(n_dst);
-                }
-                else
-                {
-                    node->next = DBG_ALLOC(calloc(1,
-                                           sizeof(struct pnode_t)));
-
-                    if(!node->next && PANIC(contxt))
-                    {
-                        free(n_src);
-                        free(n_dst);
-                        break;
-                    }
-
-                    node->next->type = type;
-                    node->next->name = n_src;
-                    node->next->copy = n_dst;
-                    node = node->next;
-                }
-
-                // Get next entry.
-                entry = readdir(dir);
-            }
-        }
-
-        // No more entries.
-        closedir(dir);
-
-        // The list is complete.
-        return head;
-    }
-
-    // Is source a file?
-    if(type == LG_FILE)
-    {
-        pnode_p file = DBG_ALLOC(calloc(1, sizeof(struct pnode_t))),
-                head = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
-
-        if(head && file)
-        {
-            n_src = DBG_ALLOC(strdup(src));
-            n_dst = DBG_ALLOC(strdup(dst));
-
-            if(n_src && n_dst)
-            {
-                // The destination of the head element will be a directory
-                // even though the source is a file. We need somewhere to
-                // put the file.
-                head->type = LG_DIR;
-                head->next = file;
-                head->name = n_src;
-                head->copy = n_dst;
-
-                // Create destination file path.
-                n_dst = h_tackon(contxt, dst, h_fileonly(contxt, src));
-                n_src = DBG_ALLOC(strdup(src));
-
-                if(n_src && n_dst)
-                {
-                    // The second element in the list will be the file.
-                    file->type = LG_FILE;
-                    file->name = n_src;
-                    file->copy = n_dst;
-
-                    if(!fonts)
-                    {
-                        // The list is complete.
-                        return head;
-                    }
-
-                    // Font file = name + .font.
-                    snprintf(buf_get(B_KEY), buf_len(), "%s.font", n_src);
-
-                    if(h_exists(buf_get(B_KEY)) == LG_FILE)
-                    {
-                        pnode_p font = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
-
-                        if(font)
-                        {
-                            font->name = DBG_ALLOC(strdup(buf_get(B_KEY)));
-                            font->copy = h_tackon(contxt, dst,
-                                         h_fileonly(contxt, buf_get(B_KEY)));
-
-                            // Add the font to the list.
-                            if(font->name && font->copy)
-                            {
-                                font->type = LG_FILE;
-                                file->next = font;
-
-                                // Unlock before return.
-                                buf_put(B_KEY);
-
-                                // The list is complete.
-                                return head;
-                            }
-
-                            free(font->name);
-                            free(font->copy);
-                            free(font);
-                        }
-                    }
-
-                    // Name no longer needed.
-                    buf_put(B_KEY);
-                }
-
-                free(head->name);
-                free(head->copy);
-            }
-        }
-
-        free(head);
-        free(file);
-    }
-
-    PANIC(contxt);
-
-    // These will leak if we don't free them.
-    free(n_src);
-    free(n_dst);
-
-    return NULL;
-}
-
-//------------------------------------------------------------------------------
-// We don't care about the distinction between root, group and user since that
-// doesn't matter on Amiga.
-//------------------------------------------------------------------------------
-#define POSIX_READ_MASK (S_IRUSR | S_IRGRP | S_IROTH)
-#define POSIX_WRITE_MASK (S_IWUSR | S_IWGRP | S_IWOTH)
-#define POSIX_EXEC_MASK (S_IXUSR | S_IXGRP | S_IXOTH)
-#define POSIX_RWX_MASK (POSIX_READ_MASK | POSIX_WRITE_MASK | POSIX_EXEC_MASK)
+//------------------------------------------------------------------------------
+// We don't care about the distinction between root, group and user since that
+// doesn't matter on Amiga.
+//------------------------------------------------------------------------------
+#define POSIX_READ_MASK (S_IRUSR | S_IRGRP | S_IROTH)
+#define POSIX_WRITE_MASK (S_IWUSR | S_IWGRP | S_IWOTH)
+#define POSIX_EXEC_MASK (S_IXUSR | S_IXGRP | S_IXOTH)
+#define POSIX_RWX_MASK (POSIX_READ_MASK | POSIX_WRITE_MASK | POSIX_EXEC_MASK)
 
 //------------------------------------------------------------------------------
 // 8 7 6 5 4 3 2 1  <- Bit number
@@ -864,37 +941,26 @@ static inline int32_t h_perm_posix_to_amiga(mode_t posix)
 static int32_t h_protect_get_amiga(entry_p contxt, const char *file,
                                    int32_t *mask)
 {
-    struct FileInfoBlock *fib = (struct FileInfoBlock *)
-           AllocDosObject(DOS_FIB, NULL);
-
-    if(*file == '\0' || (!fib && PANIC(contxt)))
+    if(*file == '\0')
     {
         return LG_FALSE;
     }
 
-    // Attempt to lock file / directory.
-    BPTR lock = (BPTR) Lock(file, ACCESS_READ);
+    struct meta_t met;
+    mc_get(file, &met);
 
-    // Fill up FIB. Filter out non-POSIX flags in test mode.
-    if(lock && Examine(lock, fib))
+    // Filter out non-POSIX flags in test mode.
+    if(met.found)
     {
         #ifdef LG_TEST
-        *mask = (fib->fib_Protection & 0xff) | 0x01;
+        *mask = (int32_t) (met.mode & 0xff) | 0x01;
         #else
-        *mask = fib->fib_Protection;
+        *mask = (int32_t) met.mode;
         #endif
 
-        // Release lock and free FIB.
-        FreeDosObject(DOS_FIB, fib);
-        UnLock(lock);
-
         return LG_TRUE;
     }
 
-    // Release lock and free FIB.
-    FreeDosObject(DOS_FIB, fib);
-    UnLock(lock);
-
     // Only fail if we're in 'strict' mode (and not in test mode).
     #ifndef LG_TEST
     if(get_num(contxt, "@strict"))
@@ -922,17 +988,18 @@ static int32_t h_protect_get_amiga(entry_p contxt, const char *file,
 //------------------------------------------------------------------------------
 static int32_t h_protect_get_posix(const char *file, int32_t *mask)
 {
-    struct stat fst;
+    struct meta_t met;
+    mc_get(file, &met);
 
     // Get POSIX file / dir permission.
-    if(stat(file, &fst))
+    if(!met.found)
     {
         // Could not get file / dir permission.
         return LG_FALSE;
     }
 
     // Report permissions in Amiga format.
-    *mask = h_perm_posix_to_amiga(fst.st_mode);
+    *mask = h_perm_posix_to_amiga((mode_t) met.mode);
 
     return LG_TRUE;
 }
@@ -1003,6 +1070,7 @@ static int32_t h_protect_set(entry_p contxt, const char *file, int32_t mask)
     chmod(file, h_perm_amiga_to_posix(mask));
     #endif
 
+    mc_drop(file);
     return LG_TRUE;
 }
 
@@ -1032,6 +1100,10 @@ static inp_t h_copyfile_reset(char *name)
             grc = G_FALSE;
         }
 
+        char icon[PATH_MAX];
+        snprintf(icon, sizeof(icon), "%s.info", name);
+        mc_drop(icon);
+
         FreeDiskObject(obj);
     }
     #else
@@ -1041,345 +1113,3069 @@ static inp_t h_copyfile_reset(char *name)
     return grc;
 }
 
-//------------------------------------------------------------------------------
-// Name:        h_copyfile
-// Description: Copy file. Helper used by n_copyfiles and n_copylib.
-// Input:       entry_p contxt:     The execution context.
-//              char *src:          Source file.
-//              char *dst:          Destination file.
-//              bool bck:           Enable back mode.
-//              bool sln:           Silent mode.
-// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
-//------------------------------------------------------------------------------
-static inp_t h_copyfile(entry_p contxt, char *src, char *dst, bool bck, bool sln)
+// Min number of milliseconds between rate samples.
+#define COPY_SAMPLE 500
+
+// Statistics of the current (copyfiles). The progress is what the GUI gets,
+// the rest is used to compute it.
+static struct cstat_t
 {
-    if((!contxt || !src || !dst) && PANIC(contxt))
+    struct cprog_t prg;
+    uint64_t beg;
+    uint64_t smp;
+    uint64_t byt;
+    uint64_t skp;
+    uint32_t fil;
+    uint32_t sam;
+} cst;
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_clock
+// Description: Get monotonic time, if the system has a monotonic clock.
+// Input:       -
+// Return:      uint64_t:   Time in milliseconds.
+//------------------------------------------------------------------------------
+static uint64_t h_copyfiles_clock(void)
+{
+    #if defined(AMIGA)
+    struct DateStamp now;
+    DateStamp(&now);
+
+    // 50 ticks per second.
+    return (uint64_t) now.ds_Days * 86400000 +
+           (uint64_t) now.ds_Minute * 60000 + (uint64_t) now.ds_Tick * 20;
+    #elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+
+    if(!clock_gettime(CLOCK_MONOTONIC, &now))
     {
-        // Bad input.
-        return G_ERR;
+        return (uint64_t) now.tv_sec * 1000 +
+               (uint64_t) now.tv_nsec / 1000000;
     }
 
-    // GUI return code.
-    inp_t grc = G_TRUE;
+    // Wall clock fallback.
+    return (uint64_t) time(NULL) * 1000;
+    #else
+    return (uint64_t) time(NULL) * 1000;
+    #endif
+}
 
-    // Show GUI unless we're in silent mode.
-    if(!sln)
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_begin
+// Description: Reset the statistics before copying.
+// Input:       -
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyfiles_begin(void)
+{
+    memset(&cst, 0, sizeof(cst));
+    cst.beg = cst.smp = h_copyfiles_clock();
+    cst.prg.eta = -1;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_tick
+// Description: Account for bytes copied and report progress to the GUI. Rates
+//              are sampled at most every COPY_SAMPLE milliseconds, the
+//              current rate is the rate since the last sample. Files that are
+//              skipped count as progress but not in the rates.
+// Input:       uint64_t len:   Number of bytes copied since the last call.
+//              bool nga:       No gauge.
+//              bool bck:       Enable back mode.
+// Return:      inp_t:          G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfiles_tick(uint64_t len, bool nga, bool bck)
+{
+    struct cprog_t *prg = &cst.prg;
+    uint64_t now = h_copyfiles_clock();
+
+    prg->cur += len;
+
+    // Files might have grown since the plan was made.
+    prg->max = prg->cur > prg->max ? prg->cur : prg->max;
+
+    if(now - cst.smp >= COPY_SAMPLE)
     {
-        grc = gui_copyfiles_setcur(src, opt(contxt, OPT_NOGAUGE) != NULL, bck);
+        uint64_t byt = prg->cur - cst.skp;
+        prg->rat = (byt - cst.byt) * 1000 / (now - cst.smp);
+        prg->avg = now > cst.beg ? byt * 1000 / (now - cst.beg) : 0;
+        prg->eta = prg->avg ? (int32_t) ((prg->max - prg->cur) / prg->avg) :
+                   -1;
+        cst.smp = now;
+        cst.byt = byt;
     }
 
-    // Prepare GUI unless we're in silent mode as used by copylib.
-    if((grc != G_TRUE) && HALT)
+    return gui_copyfiles_progress(prg, nga, bck);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_stats
+// Description: Write the final statistics to the log file and to @copy-files,
+//              @copy-kb, @copy-time (milliseconds), @copy-rate (KB/s) and
+//              @copy-skipped. Files that were up to date are not included in
+//              the size and the rate.
+// Input:       entry_p contxt:     The execution context.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyfiles_stats(entry_p contxt)
+{
+    uint64_t byt = cst.prg.cur - cst.skp, kib = byt >> 10,
+             msc = h_copyfiles_clock() - cst.beg,
+             rat = msc ? byt * 1000 / msc >> 10 : kib;
+
+    // Clamp to what fits in a variable.
+    set_num(contxt, "@copy-files", (int32_t) cst.fil);
+    set_num(contxt, "@copy-skipped", (int32_t) cst.sam);
+    set_num(contxt, "@copy-kb", (int32_t) (kib < INT32_MAX ? kib : INT32_MAX));
+    set_num(contxt, "@copy-time", (int32_t) (msc < INT32_MAX ? msc :
+                                             INT32_MAX));
+    set_num(contxt, "@copy-rate", (int32_t) (rat < INT32_MAX ? rat :
+                                             INT32_MAX));
+
+    h_log(contxt, tr(S_CSTA), (unsigned long) cst.fil, (unsigned long) kib,
+          (unsigned long) (msc / 1000), (unsigned long) (msc % 1000 / 10),
+          (unsigned long) rat);
+
+    // Don't leave the end of the copy in the buffer.
+    h_log_flush();
+
+    // File info cache, for this run as a whole.
+    uint64_t hit, mis;
+    mc_stats(&hit, &mis);
+
+    set_num(contxt, "@cache-hits", (int32_t) (hit < INT32_MAX ? hit :
+                                              INT32_MAX));
+    set_num(contxt, "@cache-misses", (int32_t) (mis < INT32_MAX ? mis :
+                                                INT32_MAX));
+
+    h_log(contxt, tr(S_MCST), (unsigned long) hit, (unsigned long) mis);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_stamp
+// Description: Get the size and the modification time of a file.
+// Input:       const char *name:   File.
+//              uint64_t *siz:      Size in bytes.
+//              uint64_t *tim:      Modification time in seconds.
+// Return:      bool:               'true' if 'name' is a file, 'false'
+//                                  otherwise.
+//------------------------------------------------------------------------------
+static bool h_copyfile_stamp(const char *name, uint64_t *siz, uint64_t *tim)
+{
+    #if defined(AMIGA)
+    struct FileInfoBlock *fib = (struct FileInfoBlock *)
+           AllocDosObject(DOS_FIB, NULL);
+
+    if(!fib)
     {
-        h_log(contxt, tr(S_ACPY), src, dst);
-        return grc;
+        // Out of memory.
+        return false;
     }
 
-    static char buf[BUFSIZ];
-    FILE *file = h_fopen(contxt, src, "r", false);
-    size_t cnt = file ? fread(buf, 1, BUFSIZ, file) : 0;
-    int err = file ? ferror(file) : 0;
+    BPTR lock = (BPTR) Lock(name, ACCESS_READ);
+    bool file = lock && Examine(lock, fib) && fib->fib_DirEntryType < 0;
 
-    if(!file || err)
+    if(file)
     {
-        // The source handle might be open.
-        if(file)
-        {
-            h_fclose(&file);
-        }
-
-        if(opt(contxt, OPT_NOFAIL))
-        {
-            // Ignore failure.
-            h_log(contxt, tr(S_NCPY), src, dst);
-            return G_TRUE;
-        }
+        struct DateStamp *dst = &fib->fib_Date;
 
-        // Fail for real.
-        ERR(ERR_READ_FILE, src);
-        return G_FALSE;
+        // 50 ticks per second.
+        *siz = (uint64_t) fib->fib_Size;
+        *tim = (uint64_t) dst->ds_Days * 86400 +
+               (uint64_t) dst->ds_Minute * 60 + (uint64_t) dst->ds_Tick / 50;
     }
 
-    // Is there an existing destination file that is write protected?
-    if(!access(dst, F_OK) && access(dst, W_OK))
+    UnLock(lock);
+    FreeDosObject(DOS_FIB, fib);
+    return file;
+    #else
+    struct stat fst;
+
+    if(stat(name, &fst) || !S_ISREG(fst.st_mode))
     {
-        // No need to ask if only (force).
-        if(opt(contxt, OPT_FORCE) && !opt(contxt, OPT_ASKUSER))
-        {
-            // Unprotect file.
-            chmod(dst, POSIX_RWX_MASK);
-        }
-        else
-        // Confirm if (askuser) unless we're running in novice mode and (force)
-        // at the same time.
-        if(opt(contxt, OPT_ASKUSER) && (opt(contxt, OPT_FORCE) ||
-           get_num(contxt, "@user-level") != LG_NOVICE))
-        {
-            if(h_confirm(contxt, "", tr(S_OWRT), dst))
-            {
-                // Unprotect file.
-                chmod(dst, POSIX_RWX_MASK);
-            }
-            else
-            {
-                // Skip file or abort.
-                h_fclose(&file);
-                return DID_HALT ? G_ABORT : G_TRUE;
-            }
-        }
+        // Not a file.
+        return false;
     }
 
-    // Create / overwrite file.
-    FILE *dest = h_fopen(contxt, dst, "w", false);
+    *siz = (uint64_t) fst.st_size;
+    *tim = (uint64_t) fst.st_mtime;
+    return true;
+    #endif
+}
 
-    if(!dest)
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_equal
+// Description: Compare the contents of two files of the same size, block by
+//              block, until they differ.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+// Return:      bool:               'true' if the contents are the same,
+//                                  'false' if they differ or on error.
+//------------------------------------------------------------------------------
+static bool h_copyfile_equal(const char *src, const char *dst)
+{
+    FILE *fst = fopen(src, "rb"), *snd = fopen(dst, "rb");
+
+    // On the heap, this might run on the small stack of a copy thread.
+    char *fbf = fst && snd ? DBG_ALLOC(malloc(BUFSIZ << 1)) : NULL,
+         *sbf = fbf ? fbf + BUFSIZ : NULL;
+    bool equ = fbf != NULL;
+
+    // Blocks are compared as we go, we're done at the first difference.
+    while(equ)
     {
-        // The source handle is open.
-        h_fclose(&file);
+        size_t fln = fread(fbf, 1, BUFSIZ, fst),
+               sln = fread(sbf, 1, BUFSIZ, snd);
 
-        if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
+        equ = fln == sln && !memcmp(fbf, sbf, fln);
+
+        if(fln < BUFSIZ)
         {
-            // Ignore failure.
-            h_log(contxt, tr(S_NCPY), src, dst);
-            return G_TRUE;
+            // End of file or I/O error.
+            equ = equ && !ferror(fst) && !ferror(snd);
+            break;
         }
+    }
 
-        // Fail for real.
-        ERR(ERR_WRITE_FILE, dst);
-        return G_FALSE;
+    free(fbf);
+
+    if(fst)
+    {
+        fclose(fst);
     }
 
-    // Read and write until there is nothing more to read.
-    while(cnt)
+    if(snd)
     {
-        if(fwrite(buf, 1, cnt, dest) == cnt)
-        {
-            // Update GUI unless we're in silent mode.
-            if(!sln)
-            {
-                grc = gui_copyfiles_setcur(NULL, opt(contxt, OPT_NOGAUGE) != NULL, bck);
-            }
+        fclose(snd);
+    }
 
-            if(grc == G_TRUE)
-            {
-                cnt = fread(buf, 1, sizeof(buf), file);
-            }
-            else
-            {
-                break;
-            }
-        }
-        else
-        {
-            if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
-            {
-                // Ignore failure.
-                h_log(contxt, tr(S_NCPY), src, dst);
-                grc = G_TRUE;
-            }
-            else
-            {
-                ERR(ERR_WRITE_FILE, dst);
-                grc = G_FALSE;
-            }
-            break;
-        }
+    return equ;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_same
+// Description: Check if an existing destination is already up to date, as
+//              requested by @skip-unchanged. Mode 1 compares the size and the
+//              modification time. Mode 2 compares the contents as well if the
+//              size is the same but the time is not. Safe to use from any
+//              thread.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+//              int32_t mod:        Value of @skip-unchanged.
+//              uint64_t *siz:      Size of the source file.
+// Return:      bool:               'true' if there is no need to copy the
+//                                  file, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_copyfile_same(const char *src, const char *dst, int32_t mod,
+                            uint64_t *siz)
+{
+    uint64_t ssz, stm, dsz, dtm;
+
+    if(mod <= 0 || !h_copyfile_stamp(src, &ssz, &stm) ||
+       !h_copyfile_stamp(dst, &dsz, &dtm) || ssz != dsz)
+    {
+        // Missing or different.
+        return false;
     }
 
-    // Close input and output files.
-    h_fclose(&file);
-    h_fclose(&dest);
+    *siz = ssz;
+    return stm == dtm || (mod > 1 && h_copyfile_equal(src, dst));
+}
 
-    // The number of bytes read and not written should be zero.
-    if(cnt)
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_date
+// Description: Give the destination the modification time of the source, so
+//              that it's found to be up to date the next time around, refer to
+//              h_copyfile_same.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyfile_date(const char *src, const char *dst)
+{
+    #if defined(AMIGA)
+    struct FileInfoBlock *fib = (struct FileInfoBlock *)
+           AllocDosObject(DOS_FIB, NULL);
+
+    if(!fib)
     {
-        // Reported / ignored error or user abort.
-        return grc;
+        // Out of memory.
+        return;
+    }
+
+    BPTR lock = (BPTR) Lock(src, ACCESS_READ);
+
+    if(lock && Examine(lock, fib))
+    {
+        // Not fatal, the file will be copied again next time.
+        SetFileDate((STRPTR) dst, &fib->fib_Date);
+    }
+
+    UnLock(lock);
+    FreeDosObject(DOS_FIB, fib);
+    #else
+    struct stat fst;
+
+    if(!stat(src, &fst))
+    {
+        struct utimbuf utb = { .actime = fst.st_atime,
+                               .modtime = fst.st_mtime };
+
+        // Not fatal, the file will be copied again next time.
+        (void) utime(dst, &utb);
     }
+    #endif
+}
 
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_skip
+// Description: Account for a file that is already up to date, as if it had
+//              been copied, without logging it as copied.
+// Input:       entry_p contxt:     The execution context.
+//              const char *src:    Source file.
+//              const char *dst:    Destination file.
+//              uint64_t siz:       Size of the file.
+//              bool bck:           Enable back mode.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfile_skip(entry_p contxt, const char *src, const char *dst,
+                             uint64_t siz, bool bck)
+{
     // Write to the log file (if logging is enabled).
-    h_log(contxt, tr(S_CPYD), src, dst);
+    h_log(contxt, tr(S_UPTD), src, dst);
 
-    // Are we going to copy the icon as well?
-    if(opt(contxt, OPT_INFOS))
+    // Counts as progress but not as copied.
+    cst.sam++;
+    cst.skp += siz;
+
+    return h_copyfiles_tick(siz, opt(contxt, OPT_NOGAUGE) != NULL, bck);
+}
+
+// Suffix of files being copied in journaled mode, refer to h_journal_open.
+#define JOURNAL_PART ".lgpart"
+
+// Min number of bytes copied between journal records of the same file.
+#define JOURNAL_STEP (32 << 20)
+
+// Journal record. A file that is done, or a file that was copied up to 'off'
+// when the record was written. 'siz' and 'tim' belong to the source.
+struct jrec_t
+{
+    char *dst;
+    size_t ndx;
+    uint64_t off;
+    uint64_t siz;
+    uint64_t tim;
+    bool done;
+};
+
+// Journal of the current (copyfiles), the records of an interrupted run and
+// the file being copied.
+static struct cjournal_t
+{
+    FILE *file;
+    char *name;
+    struct jrec_t *rec;
+    size_t num;
+    char *dst;
+    char *tmp;
+    uint64_t siz;
+    uint64_t tim;
+} jnl;
+
+//------------------------------------------------------------------------------
+// Name:        h_journal_cmp
+// Description: Compare journal records, qsort / bsearch callback used by
+//              h_journal_load and h_journal_begin.
+// Input:       const void *fst:    struct jrec_t.
+//              const void *snd:    struct jrec_t.
+// Return:      int:                strcmp() of the paths.
+//------------------------------------------------------------------------------
+static int h_journal_cmp(const void *fst, const void *snd)
+{
+    return strcmp(((const struct jrec_t *) fst)->dst,
+                  ((const struct jrec_t *) snd)->dst);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_journal_load
+// Description: Read the records of an interrupted run. Only the last record of
+//              each file is kept. Malformed records are ignored.
+// Input:       FILE *file:     Journal.
+// Return:      bool:           'true' on success, 'false' if out of memory.
+//------------------------------------------------------------------------------
+static bool h_journal_load(FILE *file)
+{
+    // Room for a path and three numbers.
+    size_t max = 0, len = PATH_MAX + 64;
+    char *lin = DBG_ALLOC(malloc(len));
+
+    if(!lin)
     {
-        // The source icon.
-        static char icon[PATH_MAX];
-        snprintf(icon, sizeof(icon), "%s.info", src);
+        // Out of memory.
+        return false;
+    }
 
-        // Only if it exists, it's not an error if it's missing.
-        if(h_exists(icon) == LG_FILE)
+    while(fgets(lin, (int) len, file))
+    {
+        unsigned long long off, siz, tim;
+        char typ;
+        int pos = 0;
+
+        if(sscanf(lin, "%c %llu %llu %llu %n", &typ, &off, &siz, &tim,
+                  &pos) < 4 ||
+           !pos || (typ != 'D' && typ != 'P'))
         {
-            static char copy[PATH_MAX];
+            // Not a record, could be the last one, cut short.
+            continue;
+        }
 
-            // The destination icon.
-            snprintf(copy, sizeof(copy), "%s.info", dst);
+        // Newline not part of the path.
+        lin[strcspn(lin, "\n")] = '\0';
 
-            // Recur to copy icon. If info.[...].info exist, they will all be
-            // copied as well.
-            grc = h_copyfile(contxt, icon, copy, bck, sln);
+        if(jnl.num == max)
+        {
+            size_t nmx = max ? max << 1 : 64;
+            struct jrec_t *rec = DBG_ALLOC(calloc(nmx, sizeof(*rec)));
 
-            // Reset icon position?
-            if(grc == G_TRUE && opt(contxt, OPT_NOPOSITION))
+            if(!rec)
             {
-                grc = h_copyfile_reset(dst);
+                // Out of memory.
+                free(lin);
+                return false;
+            }
+
+            if(jnl.rec)
+            {
+                memcpy(rec, jnl.rec, max * sizeof(*rec));
+                free(jnl.rec);
             }
+
+            jnl.rec = rec;
+            max = nmx;
+        }
+
+        struct jrec_t *rec = jnl.rec + jnl.num;
+        rec->dst = DBG_ALLOC(strdup(lin + pos));
+
+        if(!rec->dst)
+        {
+            // Out of memory.
+            free(lin);
+            return false;
         }
+
+        rec->ndx = jnl.num++;
+        rec->off = off;
+        rec->siz = siz;
+        rec->tim = tim;
+        rec->done = typ == 'D';
     }
 
-    // Try to preserve file permissions.
-    int32_t prm = 0;
+    free(lin);
 
-    if(h_protect_get(contxt, src, &prm))
+    if(!jnl.num)
     {
-        h_protect_set(contxt, dst, prm);
+        // Nothing to resume.
+        return true;
     }
 
-    // Reset error codes if necessary.
-    if(DID_ERR)
+    // Sort by path, and keep the last record of each file.
+    qsort(jnl.rec, jnl.num, sizeof(struct jrec_t), h_journal_cmp);
+    size_t num = 0;
+
+    for(size_t cur = 0; cur < jnl.num; cur++)
     {
-        if(opt(contxt, OPT_NOFAIL))
+        struct jrec_t *lst = num ? jnl.rec + num - 1 : NULL;
+
+        if(lst && !strcmp(lst->dst, jnl.rec[cur].dst))
         {
-            // Clear errors.
-            RESET;
+            // Same file, the record written last wins.
+            if(jnl.rec[cur].ndx > lst->ndx)
+            {
+                free(lst->dst);
+                *lst = jnl.rec[cur];
+            }
+            else
+            {
+                free(jnl.rec[cur].dst);
+            }
+
+            continue;
         }
-        else
+
+        jnl.rec[num++] = jnl.rec[cur];
+    }
+
+    jnl.num = num;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_journal_close
+// Description: Close the journal. The journal is deleted if all files were
+//              copied, or kept for the next run to resume from if not.
+// Input:       bool del:   Delete the journal.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_journal_close(bool del)
+{
+    if(jnl.file)
+    {
+        fclose(jnl.file);
+
+        if(del)
         {
-            // Fail for real.
-            grc = G_ABORT;
+            remove(jnl.name);
+            mc_drop(jnl.name);
         }
     }
 
-    // Unknown status.
-    return grc;
+    for(size_t cur = 0; cur < jnl.num; cur++)
+    {
+        free(jnl.rec[cur].dst);
+    }
+
+    free(jnl.rec);
+    free(jnl.name);
+    free(jnl.dst);
+    free(jnl.tmp);
+    memset(&jnl, 0, sizeof(jnl));
 }
 
 //------------------------------------------------------------------------------
-// Name:        h_makedir_create_icon
-// Description: Create directory icon.
+// Name:        h_journal_open
+// Description: Start journaling (copyfiles) if @copy-journal is set. Files are
+//              then copied to temporary names and renamed when complete. The
+//              journal, stored next to the log file, records the files that
+//              are done and how far large files have been copied. If a run is
+//              interrupted, the next run skips what's done and continues the
+//              copy of partially copied files instead of starting over.
 // Input:       entry_p contxt:     The execution context.
-//              char *dst:          The directory.
-// Return:      bool:               On success 'true', else 'false'.
+// Return:      bool:               'true' on success or if journaling is not
+//                                  enabled, 'false' on error.
 //------------------------------------------------------------------------------
-static bool h_makedir_create_icon(entry_p contxt, char *dst)
+static bool h_journal_open(entry_p contxt)
 {
-    if(!dst && PANIC(contxt))
+    if(!get_num(contxt, "@copy-journal"))
+    {
+        // Not enabled.
+        return true;
+    }
+
+    // Left open if the last (copyfiles) ended badly.
+    h_journal_close(false);
+
+    const char *log = get_str(contxt, "@log-file");
+    size_t len = strlen(log) + sizeof(".journal");
+
+    jnl.name = DBG_ALLOC(calloc(len, 1));
+
+    if(!jnl.name && PANIC(contxt))
     {
+        // Out of memory.
         return false;
     }
 
-    // Don't overwrite existing icons.
-    if(h_exists(h_suffix(dst, "info")) == LG_FILE)
+    snprintf(jnl.name, len, "%s.journal", log);
+
+    // Records from an interrupted run, if any.
+    FILE *file = fopen(jnl.name, "r");
+
+    if(file)
     {
-        return true;
+        bool mem = h_journal_load(file);
+        fclose(file);
+
+        if(!mem && PANIC(contxt))
+        {
+            // Out of memory.
+            h_journal_close(false);
+            return false;
+        }
     }
 
-    #if defined(AMIGA) && !defined(LG_TEST)
-    // Get the default drawer icon from the OS.
-    struct DiskObject *obj = (struct DiskObject *) GetDefDiskObject(WBDRAWER);
-    #else
-    FILE *obj = h_fopen(contxt, h_suffix(dst, "info"), "w", true);
-    #endif
+    jnl.file = fopen(jnl.name, "a");
+    mc_drop(jnl.name);
 
-    // Bail out if we can't open the default icon.
-    if(!obj)
+    if(!jnl.file)
     {
+        // Typically a write protected directory.
+        ERR(ERR_WRITE_FILE, jnl.name);
+        h_journal_close(false);
         return false;
     }
 
-    // Save default icon if we have one.
-    #if defined(AMIGA) && !defined(LG_TEST)
-    // Create new .info.
-    bool done = PutDiskObject(h_suffix(dst, ""), obj);
-    #else
-    bool done = fputs("icon", obj) != EOF;
-    #endif
+    return true;
+}
 
-    #if defined(AMIGA) && !defined(LG_TEST)
-    // Free def. icon.
-    FreeDiskObject(obj);
-    #else
-    h_fclose(&obj);
+//------------------------------------------------------------------------------
+// Name:        h_journal_write
+// Description: Write a record of the file being copied to the journal. The
+//              record is handed over to the system but not synced, if it's
+//              lost the file is copied again.
+// Input:       bool done:      The file is done.
+//              uint64_t off:   Number of bytes copied and synced so far.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_journal_write(bool done, uint64_t off)
+{
+    if(jnl.file && jnl.dst)
+    {
+        fprintf(jnl.file, "%c %llu %llu %llu %s\n", done ? 'D' : 'P',
+                (unsigned long long) off, (unsigned long long) jnl.siz,
+                (unsigned long long) jnl.tim, jnl.dst);
+        fflush(jnl.file);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_journal_begin
+// Description: Prepare the copy of a file in journaled mode. Find out if the
+//              file is done already, and if not, where to continue. Records
+//              only count if the source hasn't changed since they were
+//              written.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+//              uint64_t *off:      Where to continue, 0 to start over.
+// Return:      const char *:       Where to copy the file, NULL if the file
+//                                  is done already.
+//------------------------------------------------------------------------------
+static const char *h_journal_begin(const char *src, const char *dst,
+                                   uint64_t *off)
+{
+    *off = 0;
+    free(jnl.dst);
+    free(jnl.tmp);
+    jnl.dst = DBG_ALLOC(strdup(dst));
+    jnl.tmp = DBG_ALLOC(calloc(strlen(dst) + sizeof(JOURNAL_PART), 1));
+
+    if(!jnl.dst || !jnl.tmp || !h_copyfile_stamp(src, &jnl.siz, &jnl.tim))
+    {
+        // Out of memory or not a file. Copy the way we usually do.
+        free(jnl.dst);
+        free(jnl.tmp);
+        jnl.dst = jnl.tmp = NULL;
+        return dst;
+    }
+
+    sprintf(jnl.tmp, "%s%s", dst, JOURNAL_PART);
+
+    struct jrec_t key = { .dst = jnl.dst }, *rec = jnl.num ?
+           bsearch(&key, jnl.rec, jnl.num, sizeof(struct jrec_t),
+                   h_journal_cmp) : NULL;
+
+    // Irrelevant if the source has changed.
+    if(!rec || rec->siz != jnl.siz || rec->tim != jnl.tim)
+    {
+        return jnl.tmp;
+    }
+
+    uint64_t siz = 0;
+
+    // Done already unless someone else has touched the destination.
+    if(rec->done)
+    {
+        return h_exists_size(dst, &siz) == LG_FILE && siz == jnl.siz ?
+               NULL : jnl.tmp;
+    }
+
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // Data beyond the last record might not have made it to the disk. Cut it
+    // off and go on from there. Only h_copyfile_fd can do this.
+    if(h_exists_size(jnl.tmp, &siz) == LG_FILE && siz >= rec->off &&
+       rec->off <= jnl.siz && !truncate(jnl.tmp, (off_t) rec->off))
+    {
+        *off = rec->off;
+    }
     #endif
 
-    // Success or I/O error.
-    return done;
+    return jnl.tmp;
 }
 
 //------------------------------------------------------------------------------
-// Name:        h_makedir_path
-// Description: Create directory and all its parent directories.
-// Input:       char *dst:          Directory to be created.
-// Return:      bool:               'true' on succes, 'false' otherwise.
+// Name:        h_journal_commit
+// Description: Give a completely copied file its real name and record that
+//              it's done.
+// Input:       const char *dst:    Destination file.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_journal_commit(const char *dst)
+{
+    if(!jnl.tmp)
+    {
+        // Nothing to rename.
+        return true;
+    }
+
+    // Not all systems replace existing files.
+    bool done = !rename(jnl.tmp, dst) || (!remove(dst) &&
+                !rename(jnl.tmp, dst));
+
+    mc_drop(jnl.tmp);
+    mc_drop(dst);
+
+    if(!done)
+    {
+        return false;
+    }
+
+    h_journal_write(true, jnl.siz);
+    free(jnl.tmp);
+    jnl.tmp = NULL;
+    return true;
+}
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+// Max number of bytes copied between GUI updates.
+#define COPY_CHUNK (1 << 20)
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_range
+// Description: Copy part of a file to the same offset in another file. If the
+//              kernel can do the copying, by the way of copy_file_range() or
+//              sendfile(), the data never reaches user space. If not, pread()
+//              and pwrite() are used. Methods that aren't supported are given
+//              up, and not tried again, for the rest of the file.
+// Input:       int src:        Source file descriptor.
+//              int dst:        Destination file descriptor.
+//              off_t off:      Offset.
+//              size_t len:     Max number of bytes to copy.
+//              int *how:       Copy method, 0 to begin with.
+//              char **buf:     Buffer used by pread() / pwrite(), allocated
+//                              the first time it's needed.
+//              size_t siz:     Buffer size.
+// Return:      ssize_t:        Number of bytes copied, 0 at the end of the
+//                              source file and -1 on error.
+//------------------------------------------------------------------------------
+static ssize_t h_copyfile_range(int src, int dst, off_t off, size_t len,
+                                int *how, char **buf, size_t siz)
+{
+    #if defined(__linux__)
+    if(*how == 0)
+    {
+        loff_t inp = off, out = off;
+        ssize_t cnt = copy_file_range(src, &inp, dst, &out, len, 0);
+
+        // Not supported by the kernel or not between these file systems.
+        if(cnt >= 0 || (errno != ENOSYS && errno != EXDEV && errno != EINVAL &&
+           errno != EOPNOTSUPP && errno != EPERM))
+        {
+            return cnt;
+        }
+
+        *how = 1;
+    }
+
+    if(*how == 1)
+    {
+        // The destination offset is the current one.
+        off_t inp = off;
+        ssize_t cnt = lseek(dst, off, SEEK_SET) == off ?
+                      sendfile(dst, src, &inp, len) : -1;
+
+        if(cnt >= 0 || (errno != ENOSYS && errno != EINVAL))
+        {
+            return cnt;
+        }
+
+        *how = 2;
+    }
+    #endif
+
+    if(!*buf)
+    {
+        // Page aligned memory, the best we can do for the kernel.
+        long pag = sysconf(_SC_PAGESIZE);
+        void *mem = NULL;
+
+        if(posix_memalign(&mem, pag > 0 ? (size_t) pag : sizeof(void *), siz))
+        {
+            // Out of memory.
+            return -1;
+        }
+
+        *buf = DBG_ALLOC(mem);
+
+        if(!*buf)
+        {
+            // Out of memory.
+            return -1;
+        }
+    }
+
+    ssize_t cnt = pread(src, *buf, len < siz ? len : siz, off);
+
+    // Write all we got, even if it takes more than one pwrite().
+    for(ssize_t pos = 0, res; pos < cnt; pos += res)
+    {
+        res = pwrite(dst, *buf + pos, (size_t) (cnt - pos), off + pos);
+
+        if(res <= 0)
+        {
+            return -1;
+        }
+    }
+
+    return cnt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_alloc
+// Description: Reserve space for the rest of a file before copying it. Blocks
+//              allocated all at once are likely to be laid out contiguously,
+//              and running out of space is noticed before anything has been
+//              written. The size of the destination is left as it is. Small
+//              files, that are written in one go anyway, and sparse files,
+//              that would lose their holes, are left alone.
+// Input:       int dst:            Destination file descriptor.
+//              struct stat *ist:   Source file status.
+//              struct stat *ost:   Destination file status.
+//              off_t beg:          Number of bytes copied already.
+// Return:      bool:               'false' if there's no room for the file,
+//                                  'true' otherwise, also if the file system
+//                                  can't reserve space in advance.
+//------------------------------------------------------------------------------
+static bool h_copyfile_alloc(int dst, struct stat *ist, struct stat *ost,
+                             off_t beg)
+{
+    #if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+    off_t len = ist->st_size - beg;
+
+    if(len <= COPY_CHUNK || (off_t) ist->st_blocks * 512 < ist->st_size ||
+       !fallocate(dst, FALLOC_FL_KEEP_SIZE, beg, len) ||
+       (errno != ENOSPC && errno != EDQUOT))
+    {
+        // Nothing to do, reserved, or not supported by the file system.
+        return true;
+    }
+
+    // Give back what we might have got beyond the end of the file.
+    (void) ftruncate(dst, ost->st_size);
+    return false;
+    #else
+    (void) dst;
+    (void) ist;
+    (void) ost;
+    (void) beg;
+    return true;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_fd
+// Description: Copy regular file on the file descriptor level, the fastest way
+//              the system can. Blocks are shared between the files if the file
+//              system supports reflinks. If not, the data is copied in chunks
+//              by h_copyfile_range(), updating the GUI between chunks. Holes in
+//              sparse files are skipped and recreated by setting the size of
+//              the destination once all data has been copied.
+// Input:       entry_p contxt:     The execution context.
+//              int src:            Source file descriptor.
+//              int dst:            Destination file descriptor.
+//              const char *buf:    What has been read from the source already.
+//              size_t *cnt:        Number of bytes in 'buf'. On return, 0 if
+//                                  the file was copied and something else on
+//                                  error or abort.
+//              off_t beg:          Number of bytes copied already, refer to
+//                                  h_journal_begin.
+//              bool bck:           Enable back mode.
+//              bool sln:           Silent mode. The context isn't used, and
+//                                  can be NULL, in silent mode.
+//              inp_t *grc:         GUI return code.
+// Return:      bool:               'true' if the file was copied, or if it
+//                                  failed, 'false' if either of the files is
+//                                  not a regular file.
+//------------------------------------------------------------------------------
+static bool h_copyfile_fd(entry_p contxt, int src, int dst, const char *buf,
+                          size_t *cnt, off_t beg, bool bck, bool sln,
+                          inp_t *grc)
+{
+    struct stat ist, ost;
+
+    // Holes can't be skipped when writing to anything but files.
+    if(fstat(src, &ist) || !S_ISREG(ist.st_mode) || fstat(dst, &ost) ||
+       !S_ISREG(ost.st_mode))
+    {
+        // Let the caller use stdio.
+        return false;
+    }
+
+    off_t end = ist.st_size;
+    bool nga = !sln && opt(contxt, OPT_NOGAUGE) != NULL;
+
+    #if defined(__linux__) && defined(FICLONE)
+    // Nothing to copy if the blocks can be shared.
+    if(!beg && !ioctl(dst, FICLONE, src))
+    {
+        *grc = sln ? G_TRUE : h_copyfiles_tick((uint64_t) end, nga, bck);
+        *cnt = *grc == G_TRUE ? 0 : 1;
+        return true;
+    }
+    #endif
+
+    // Make room for the file, or fail before writing anything.
+    if(!h_copyfile_alloc(dst, &ist, &ost, beg))
+    {
+        *cnt = 1;
+        return true;
+    }
+
+    // Write what has been read already.
+    for(ssize_t pos = 0, res; pos < (ssize_t) *cnt; pos += res)
+    {
+        res = pwrite(dst, buf + pos, *cnt - (size_t) pos, pos);
+
+        if(res <= 0)
+        {
+            // Leave 'cnt' as it is.
+            return true;
+        }
+    }
+
+    // Go on from where the last run stopped, if we're resuming.
+    off_t off = (off_t) *cnt > beg ? (off_t) *cnt : beg, rep = off, mrk = off;
+
+    // Update GUI unless we're in silent mode.
+    *grc = (sln || !off) ? G_TRUE : h_copyfiles_tick((uint64_t) off, nga, bck);
+
+    // Copy chunks of at least one block, as many blocks as fits in a chunk.
+    size_t blk = ist.st_blksize > 0 ? (size_t) ist.st_blksize : BUFSIZ,
+           siz = COPY_CHUNK > blk ? COPY_CHUNK - COPY_CHUNK % blk : blk;
+    char *mem = NULL;
+    int how = 0;
+
+    while(off < end && *grc == G_TRUE)
+    {
+        off_t hol = end;
+
+        #if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        // Find the next range of data, there might be nothing but holes left.
+        off_t dat = lseek(src, off, SEEK_DATA);
+
+        if(dat < 0 && errno == ENXIO)
+        {
+            break;
+        }
+
+        // If not supported, everything is data.
+        if(dat >= off)
+        {
+            off = dat;
+            hol = lseek(src, dat, SEEK_HOLE);
+            hol = hol > dat ? hol : end;
+        }
+        #endif
+
+        // Copy range, chunk by chunk.
+        while(off < hol && *grc == G_TRUE)
+        {
+            size_t len = (size_t) (hol - off) < siz ?
+                         (size_t) (hol - off) : siz;
+            ssize_t res = h_copyfile_range(src, dst, off, len, &how, &mem, siz);
+
+            if(res < 0)
+            {
+                // I/O error.
+                free(mem);
+                *cnt = 1;
+                return true;
+            }
+
+            if(!res)
+            {
+                // The source has been truncated while we were copying.
+                end = hol = off;
+                break;
+            }
+
+            off += res;
+
+            // Update GUI unless we're in silent mode. Holes count as copied.
+            *grc = sln ? G_TRUE : h_copyfiles_tick((uint64_t) (off - rep), nga,
+                                                   bck);
+            rep = off;
+
+            // Let the next run resume from here if this one is interrupted.
+            if(jnl.tmp && off - mrk >= JOURNAL_STEP && !fsync(dst))
+            {
+                h_journal_write(false, (uint64_t) off);
+                mrk = off;
+            }
+        }
+    }
+
+    free(mem);
+
+    // Abort or skip.
+    if(*grc != G_TRUE)
+    {
+        *cnt = 1;
+        return true;
+    }
+
+    // Holes at the end count as copied as well.
+    if(!sln && rep < end)
+    {
+        cst.prg.cur += (uint64_t) (end - rep);
+    }
+
+    // Set the size, holes at the end are created this way. In journaled mode,
+    // the data must be on the disk before the file gets its real name.
+    *cnt = ftruncate(dst, end) || (jnl.tmp && fsync(dst)) ? 1 : 0;
+    return true;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile
+// Description: Decl. needed by h_copyfile_done(). See description further down.
+//------------------------------------------------------------------------------
+static inp_t h_copyfile(entry_p contxt, char *src, char *dst, bool bck,
+                        bool sln);
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_done
+// Description: Finish a file that has been copied; log, copy icon if (infos) is
+//              set and preserve file permissions. Used by h_copyfile and by
+//              h_copyfiles_pool.
+// Input:       entry_p contxt:     The execution context.
+//              char *src:          Source file.
+//              char *dst:          Destination file.
+//              bool bck:           Enable back mode.
+//              bool sln:           Silent mode.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfile_done(entry_p contxt, char *src, char *dst, bool bck,
+                             bool sln)
+{
+    // GUI return code.
+    inp_t grc = G_TRUE;
+
+    // Write to the log file (if logging is enabled).
+    h_log(contxt, tr(S_CPYD), src, dst);
+
+    // Only (copyfiles) counts.
+    cst.fil += sln ? 0 : 1;
+
+    // Are we going to copy the icon as well?
+    if(opt(contxt, OPT_INFOS))
+    {
+        // The source icon.
+        static char icon[PATH_MAX];
+        snprintf(icon, sizeof(icon), "%s.info", src);
+
+        // Only if it exists, it's not an error if it's missing.
+        if(h_exists(icon) == LG_FILE)
+        {
+            static char copy[PATH_MAX];
+
+            // The destination icon.
+            snprintf(copy, sizeof(copy), "%s.info", dst);
+
+            // Recur to copy icon. If info.[...].info exist, they will all be
+            // copied as well.
+            grc = h_copyfile(contxt, icon, copy, bck, sln);
+
+            // Reset icon position?
+            if(grc == G_TRUE && opt(contxt, OPT_NOPOSITION))
+            {
+                grc = h_copyfile_reset(dst);
+            }
+        }
+    }
+
+    // Keep the time for the next @skip-unchanged run. Do this before the
+    // destination might be write protected.
+    if(get_num(contxt, "@skip-unchanged"))
+    {
+        h_copyfile_date(src, dst);
+    }
+
+    // Try to preserve file permissions.
+    int32_t prm = 0;
+
+    if(h_protect_get(contxt, src, &prm))
+    {
+        h_protect_set(contxt, dst, prm);
+    }
+
+    // Whatever we knew about the destination is out of date.
+    mc_drop(dst);
+
+    // Reset error codes if necessary.
+    if(DID_ERR)
+    {
+        if(opt(contxt, OPT_NOFAIL))
+        {
+            // Clear errors.
+            RESET;
+        }
+        else
+        {
+            // Fail for real.
+            grc = G_ABORT;
+        }
+    }
+
+    // Unknown status.
+    return grc;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile
+// Description: Copy file. Helper used by n_copyfiles and n_copylib.
+// Input:       entry_p contxt:     The execution context.
+//              char *src:          Source file.
+//              char *dst:          Destination file.
+//              bool bck:           Enable back mode.
+//              bool sln:           Silent mode.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfile(entry_p contxt, char *src, char *dst, bool bck, bool sln)
+{
+    if((!contxt || !src || !dst) && PANIC(contxt))
+    {
+        // Bad input.
+        return G_ERR;
+    }
+
+    // GUI return code.
+    inp_t grc = G_TRUE;
+
+    // Show GUI unless we're in silent mode.
+    if(!sln)
+    {
+        grc = gui_copyfiles_setcur(src, opt(contxt, OPT_NOGAUGE) != NULL, bck);
+    }
+
+    // Prepare GUI unless we're in silent mode as used by copylib.
+    if((grc != G_TRUE) && HALT)
+    {
+        h_log(contxt, tr(S_ACPY), src, dst);
+        return grc;
+    }
+
+    // Journaled copies go through a temporary file, refer to h_journal_open.
+    uint64_t beg = 0;
+    const char *out = jnl.file ? h_journal_begin(src, dst, &beg) : dst;
+
+    if(!out)
+    {
+        // Copied by an interrupted run.
+        return sln ? G_TRUE : h_copyfile_skip(contxt, src, dst, jnl.siz, bck);
+    }
+
+    static char buf[BUFSIZ];
+    FILE *file = h_fopen(contxt, src, "r", false);
+    size_t cnt = file ? fread(buf, 1, BUFSIZ, file) : 0;
+    int err = file ? ferror(file) : 0;
+
+    if(!file || err)
+    {
+        // The source handle might be open.
+        if(file)
+        {
+            h_fclose(&file);
+        }
+
+        if(opt(contxt, OPT_NOFAIL))
+        {
+            // Ignore failure.
+            h_log(contxt, tr(S_NCPY), src, dst);
+            return G_TRUE;
+        }
+
+        // Fail for real.
+        ERR(ERR_READ_FILE, src);
+        return G_FALSE;
+    }
+
+    // Is there an existing destination file that is write protected?
+    if(!access(dst, F_OK) && access(dst, W_OK))
+    {
+        // No need to ask if only (force).
+        if(opt(contxt, OPT_FORCE) && !opt(contxt, OPT_ASKUSER))
+        {
+            // Unprotect file.
+            chmod(dst, POSIX_RWX_MASK);
+            mc_drop(dst);
+        }
+        else
+        // Confirm if (askuser) unless we're running in novice mode and (force)
+        // at the same time.
+        if(opt(contxt, OPT_ASKUSER) && (opt(contxt, OPT_FORCE) ||
+           get_num(contxt, "@user-level") != LG_NOVICE))
+        {
+            if(h_confirm(contxt, "", tr(S_OWRT), dst))
+            {
+                // Unprotect file.
+                chmod(dst, POSIX_RWX_MASK);
+                mc_drop(dst);
+            }
+            else
+            {
+                // Skip file or abort.
+                h_fclose(&file);
+                return DID_HALT ? G_ABORT : G_TRUE;
+            }
+        }
+    }
+
+    // Create / overwrite file, or continue where an interrupted run stopped.
+    FILE *dest = h_fopen(contxt, out, beg ? "r+" : "w", false);
+
+    if(!dest)
+    {
+        // The source handle is open.
+        h_fclose(&file);
+
+        if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
+        {
+            // Ignore failure.
+            h_log(contxt, tr(S_NCPY), src, dst);
+            return G_TRUE;
+        }
+
+        // Fail for real.
+        ERR(ERR_WRITE_FILE, dst);
+        return G_FALSE;
+    }
+
+    if(beg)
+    {
+        // What's copied already counts as progress but not as copied.
+        h_log(contxt, tr(S_RSME), src, dst, (unsigned long) beg);
+        cst.skp += sln ? 0 : beg;
+    }
+
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // Let the system do the copying if it's a regular file. Anything left when
+    // we're done means that we failed or that we're aborting.
+    if(h_copyfile_fd(contxt, fileno(file), fileno(dest), buf, &cnt,
+                     (off_t) beg, bck, sln, &grc))
+    {
+        if(cnt && grc == G_TRUE)
+        {
+            if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
+            {
+                // Ignore failure.
+                h_log(contxt, tr(S_NCPY), src, dst);
+            }
+            else
+            {
+                ERR(ERR_WRITE_FILE, dst);
+                grc = G_FALSE;
+            }
+        }
+    }
+    else
+    #endif
+    // Read and write until there is nothing more to read.
+    while(cnt)
+    {
+        if(fwrite(buf, 1, cnt, dest) == cnt)
+        {
+            // Update GUI unless we're in silent mode.
+            if(!sln)
+            {
+                grc = h_copyfiles_tick(cnt, opt(contxt, OPT_NOGAUGE) != NULL,
+                                       bck);
+            }
+
+            if(grc == G_TRUE)
+            {
+                cnt = fread(buf, 1, sizeof(buf), file);
+            }
+            else
+            {
+                break;
+            }
+        }
+        else
+        {
+            if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
+            {
+                // Ignore failure.
+                h_log(contxt, tr(S_NCPY), src, dst);
+                grc = G_TRUE;
+            }
+            else
+            {
+                ERR(ERR_WRITE_FILE, dst);
+                grc = G_FALSE;
+            }
+            break;
+        }
+    }
+
+    // Close input and output files.
+    h_fclose(&file);
+    h_fclose(&dest);
+
+    // The number of bytes read and not written should be zero.
+    if(cnt)
+    {
+        // Reported / ignored error or user abort.
+        return grc;
+    }
+
+    // Journaled copies get their real name once they're complete.
+    if(!h_journal_commit(dst))
+    {
+        if(opt(contxt, OPT_NOFAIL) || opt(contxt, OPT_OKNODELETE))
+        {
+            // Ignore failure.
+            h_log(contxt, tr(S_NCPY), src, dst);
+            return G_TRUE;
+        }
+
+        // Fail for real.
+        ERR(ERR_WRITE_FILE, dst);
+        return G_FALSE;
+    }
+
+    // Log, copy icon and so on.
+    return h_copyfile_done(contxt, src, dst, bck, sln);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_makedir_create_icon
+// Description: Create directory icon.
+// Input:       entry_p contxt:     The execution context.
+//              char *dst:          The directory.
+// Return:      bool:               On success 'true', else 'false'.
+//------------------------------------------------------------------------------
+static bool h_makedir_create_icon(entry_p contxt, char *dst)
+{
+    if(!dst && PANIC(contxt))
+    {
+        return false;
+    }
+
+    // Don't overwrite existing icons.
+    if(h_exists(h_suffix(dst, "info")) == LG_FILE)
+    {
+        return true;
+    }
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    // Get the default drawer icon from the OS.
+    struct DiskObject *obj = (struct DiskObject *) GetDefDiskObject(WBDRAWER);
+    #else
+    FILE *obj = h_fopen(contxt, h_suffix(dst, "info"), "w", true);
+    #endif
+
+    // Bail out if we can't open the default icon.
+    if(!obj)
+    {
+        return false;
+    }
+
+    // Save default icon if we have one.
+    #if defined(AMIGA) && !defined(LG_TEST)
+    // Create new .info.
+    bool done = PutDiskObject(h_suffix(dst, ""), obj);
+    mc_drop(h_suffix(dst, "info"));
+    #else
+    bool done = fputs("icon", obj) != EOF;
+    #endif
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    // Free def. icon.
+    FreeDiskObject(obj);
+    #else
+    h_fclose(&obj);
+    #endif
+
+    // Success or I/O error.
+    return done;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_makedir_one
+// Description: Used by h_makedir_path to create a single directory, unless
+//              it's known to exist already.
+// Input:       const char *dir:    Directory to be created.
+// Return:      int:                0 on success, ENOENT if the parent doesn't
+//                                  exist or some other errno value.
+//------------------------------------------------------------------------------
+static int h_makedir_one(const char *dir)
+{
+    if(!*dir || mc_isdir(dir))
+    {
+        // Current dir or created / seen by us, nothing to do.
+        return 0;
+    }
+
+    if(!mkdir(dir, 0777))
+    {
+        // We know what's there now.
+        mc_mkdir(dir);
+        return 0;
+    }
+
+    #if !defined(AMIGA)
+    int err = errno;
+
+    if(err != EEXIST)
+    {
+        // Missing parent or permission problems.
+        return err;
+    }
+    #endif
+
+    // There's something there already, a directory we hope.
+    int32_t type = h_exists(dir);
+    return type == LG_DIR ? 0 : type == LG_NONE ? ENOENT : EEXIST;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_makedir_path
+// Description: Create directory and all its parent directories. Directories
+//              known to exist are not looked at. In directories created by us
+//              we go straight for mkdir(), parents are only looked at if that
+//              fails, which is rarely the case when creating trees top down.
+// Input:       char *dst:          Directory to be created.
+// Return:      bool:               'true' on succes, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_makedir_path(char *dst)
+{
+    if(!*dst || mc_isdir(dst))
+    {
+        // Current dir or known to exist.
+        return true;
+    }
+
+    // Create working copy without trailing slashes.
+    char *buf = buf_get(B_KEY);
+    strncpy(buf, dst, buf_len());
+
+    size_t len = strlen(buf), end;
+
+    while(len > 1 && buf[len - 1] == '/')
+    {
+        buf[--len] = '\0';
+    }
+
+    // Is the parent a directory that we just created?
+    for(end = len; end && buf[--end] != '/';);
+
+    if(end)
+    {
+        buf[end] = '\0';
+    }
+
+    bool made = end && mc_made(buf);
+
+    if(end)
+    {
+        buf[end] = '/';
+    }
+
+    // If not, the directory might exist already.
+    int32_t type = made ? LG_NONE : h_exists(buf);
+    int err = type == LG_DIR ? 0 : type == LG_FILE ? EEXIST :
+              h_makedir_one(buf);
+
+    // Walk up until we find a parent that exists or can be created.
+    for(end = len; err == ENOENT;)
+    {
+        while(end && buf[--end] != '/');
+
+        if(!end)
+        {
+            // Nothing left to create.
+            break;
+        }
+
+        buf[end] = '\0';
+        err = h_makedir_one(buf);
+    }
+
+    // Walk back down, creating the rest.
+    while(!err && end < len)
+    {
+        buf[end] = '/';
+        end += strlen(buf + end);
+        err = h_makedir_one(buf);
+    }
+
+    // Unlock buffer.
+    buf_put(B_KEY);
+    return !err;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_makedir
+// Description: Create directory / icon / tree of directories.
+// Input:       entry_p contxt:     The execution context.
+//              char *dst:          The directory.
+// Return:      bool:               'true' on succes, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_makedir(entry_p contxt, char *dst)
+{
+    if(!dst && PANIC(contxt))
+    {
+        return false;
+    }
+
+    // Make full path if it doesn't exist.
+    if(!h_makedir_path(dst))
+    {
+        return false;
+    }
+
+    // Create icon if (infos) is set. Ignore errors.
+    if(opt(contxt, OPT_INFOS))
+    {
+        h_makedir_create_icon(contxt, dst);
+    }
+
+    return true;
+}
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+// Max number of copy workers, refer to h_copyfiles.
+#define COPY_JOBS 64
+
+// Outcome of a file copied by a worker.
+enum
+{
+    CPY_WAIT,   // Not copied yet.
+    CPY_DONE,   // Copied.
+    CPY_SEQ,    // Left to h_copyfile.
+    CPY_READ,   // Couldn't read from source.
+    CPY_OPEN,   // Couldn't open destination.
+    CPY_WRITE,  // Couldn't write to destination.
+    CPY_SAME    // Up to date, refer to h_copyfile_same.
+};
+
+// File to be copied by a worker.
+struct cjob_t
+{
+    char *src;
+    char *dst;
+    uint64_t len;
+    int res;
+};
+
+// Source or destination of a file to be copied.
+struct cpath_t
+{
+    const char *path;
+    struct cjob_t *job;
+};
+
+// State shared by the interpreter and the workers.
+struct cpool_t
+{
+    struct cjob_t *job;
+    size_t num;
+    size_t nxt;
+    size_t cur;
+    size_t ahd;
+    int32_t sam;
+    bool stop;
+    pthread_mutex_t mtx;
+    pthread_cond_t cnd;
+    #if defined(LG_URING)
+    struct cring_t *rng;
+    #endif
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_plain
+// Description: Test whether a file can be copied without the help of
+//              h_copyfile or not. Regular files can, if the destination is
+//              missing or a regular file. Files that would require user
+//              interaction can't, nor can files that h_copyfile would fail to
+//              open. The permission checks are the same as in h_fopen and
+//              h_copyfile.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+//              struct stat *ist:   Source file status.
+// Return:      bool:               'true' if the file can be copied without
+//                                  h_copyfile, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_copyfile_plain(const char *src, const char *dst, struct stat *ist)
+{
+    struct stat ost;
+
+    return !stat(src, ist) && S_ISREG(ist->st_mode) &&
+           (ist->st_mode & POSIX_READ_MASK) && (stat(dst, &ost) ||
+           (S_ISREG(ost.st_mode) && (ost.st_mode & POSIX_WRITE_MASK) &&
+           !access(dst, W_OK)));
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfile_job
+// Description: Copy file without GUI updates, logging or error reporting, the
+//              part of h_copyfile that can be done by a worker. Refer to
+//              h_copyfile_plain for files that are left to h_copyfile.
+// Input:       const char *src:    Source file.
+//              const char *dst:    Destination file.
+//              uint64_t *siz:      Size of the source file.
+// Return:      int:                CPY_DONE / CPY_SEQ / CPY_READ / CPY_OPEN /
+//                                  CPY_WRITE.
+//------------------------------------------------------------------------------
+static int h_copyfile_job(const char *src, const char *dst, uint64_t *siz)
+{
+    struct stat ist;
+
+    if(!h_copyfile_plain(src, dst, &ist))
+    {
+        return CPY_SEQ;
+    }
+
+    *siz = (uint64_t) ist.st_size;
+
+    int inp = open(src, O_RDONLY);
+
+    if(inp < 0)
+    {
+        return CPY_READ;
+    }
+
+    // Make sure that we can read before creating the destination.
+    char buf[BUFSIZ];
+    ssize_t cnt = read(inp, buf, sizeof(buf));
+
+    if(cnt < 0)
+    {
+        close(inp);
+        return CPY_READ;
+    }
+
+    int out = open(dst, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+    if(out < 0)
+    {
+        close(inp);
+        return CPY_OPEN;
+    }
+
+    // Silent mode, the GUI belongs to the interpreter.
+    size_t len = (size_t) cnt;
+    inp_t grc = G_TRUE;
+    bool reg = h_copyfile_fd(NULL, inp, out, buf, &len, 0, false, true,
+                             &grc);
+
+    close(inp);
+
+    if(close(out))
+    {
+        len = 1;
+    }
+
+    // Something else than a regular file has taken the place of the source or
+    // the destination file.
+    return reg ? (len ? CPY_WRITE : CPY_DONE) : CPY_SEQ;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_worker
+// Description: Copy worker. Copy files in list order until there are no files
+//              left or until told to stop. Workers don't get further ahead of
+//              the interpreter than needed to keep all of them busy, fewer
+//              files are copied in vain if the interpreter stops.
+// Input:       void *arg:      State shared with the interpreter.
+// Return:      void *:         NULL.
+//------------------------------------------------------------------------------
+static void *h_copyfiles_worker(void *arg)
+{
+    struct cpool_t *pol = (struct cpool_t *) arg;
+
+    pthread_mutex_lock(&pol->mtx);
+
+    while(!pol->stop && pol->nxt < pol->num)
+    {
+        // Wait for the interpreter to catch up.
+        if(pol->nxt >= pol->cur + pol->ahd)
+        {
+            pthread_cond_wait(&pol->cnd, &pol->mtx);
+            continue;
+        }
+
+        struct cjob_t *job = pol->job + pol->nxt++;
+
+        // Skip files left to h_copyfile.
+        if(job->res != CPY_WAIT)
+        {
+            continue;
+        }
+
+        // Don't hold the lock while copying.
+        pthread_mutex_unlock(&pol->mtx);
+        uint64_t len = 0;
+        int res = h_copyfile_same(job->src, job->dst, pol->sam, &len) ?
+                  CPY_SAME : h_copyfile_job(job->src, job->dst, &len);
+        pthread_mutex_lock(&pol->mtx);
+
+        // The interpreter might be waiting for this file.
+        job->len = len;
+        job->res = res;
+        pthread_cond_broadcast(&pol->cnd);
+    }
+
+    pthread_mutex_unlock(&pol->mtx);
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_cmp
+// Description: Compare paths, qsort callback used by h_copyfiles_deps.
+// Input:       const void *fst:    struct cpath_t.
+//              const void *snd:    struct cpath_t.
+// Return:      int:                strcasecmp() of the paths.
+//------------------------------------------------------------------------------
+static int h_copyfiles_cmp(const void *fst, const void *snd)
+{
+    return strcasecmp(((const struct cpath_t *) fst)->path,
+                      ((const struct cpath_t *) snd)->path);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_deps
+// Description: Find files that must be copied in list order; files with the
+//              same destination as other files, and files with a destination
+//              that is the source of another file. These are left to
+//              h_copyfile.
+// Input:       struct cjob_t *job: Files to be copied.
+//              size_t num:         Number of files.
+// Return:      bool:               'true' on success, 'false' if out of memory.
+//------------------------------------------------------------------------------
+static bool h_copyfiles_deps(struct cjob_t *job, size_t num)
+{
+    size_t cnt = num << 1;
+    struct cpath_t *pth = DBG_ALLOC(calloc(cnt, sizeof(struct cpath_t)));
+
+    if(!pth)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    // Sort all sources and destinations, equal paths end up next to each
+    // other.
+    for(size_t cur = 0; cur < num; cur++)
+    {
+        pth[cur << 1].path = job[cur].src;
+        pth[cur << 1].job = job + cur;
+        pth[(cur << 1) + 1].path = job[cur].dst;
+        pth[(cur << 1) + 1].job = job + cur;
+    }
+
+    qsort(pth, cnt, sizeof(struct cpath_t), h_copyfiles_cmp);
+
+    for(size_t fst = 0, end; fst < cnt; fst = end)
+    {
+        bool out = false;
+
+        // Is any of the equal paths a destination?
+        for(end = fst; end < cnt && !h_copyfiles_cmp(pth + fst, pth + end);
+            end++)
+        {
+            out = out || pth[end].path == pth[end].job->dst;
+        }
+
+        for(size_t cur = fst; out && end - fst > 1 && cur < end; cur++)
+        {
+            pth[cur].job->res = CPY_SEQ;
+        }
+    }
+
+    free(pth);
+    return true;
+}
+
+#if defined(LG_URING)
+// Default number of files in flight with io_uring, refer to h_copyfiles.
+#define COPY_RING 8
+
+// Buffer size of each file in flight. Bigger files are left to h_copyfile,
+// the kernel copies those without the data passing through user space.
+#define COPY_RBUF (1 << 17)
+
+// Stage of a file in flight.
+enum
+{
+    RNG_FREE,   // Slot not used.
+    RNG_OPEN,   // Opening source.
+    RNG_READ,   // Reading from source.
+    RNG_CREAT,  // Opening destination.
+    RNG_WRITE,  // Writing to destination.
+    RNG_CLOSE   // Closing source and destination.
+};
+
+// File in flight.
+struct cslot_t
+{
+    struct cjob_t *job;
+    int stage;
+    int src;
+    int dst;
+    int res;
+    int cls;
+    off_t off;
+    size_t len;
+    size_t pos;
+    char *buf;
+};
+
+// io_uring copy engine.
+struct cring_t
+{
+    struct ur_t ur;
+    struct cslot_t *slot;
+    char *mem;
+    size_t dep;
+    size_t act;
+    bool fix;
+    bool bad;
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_init
+// Description: Set up io_uring copy engine. Each file in flight has a buffer
+//              of its own, registered as a fixed buffer if possible.
+// Input:       size_t dep:     Number of files in flight.
+// Return:      struct cring_t *:   Copy engine, NULL if io_uring isn't
+//                                  available or if we're out of memory.
+//------------------------------------------------------------------------------
+static struct cring_t *h_copyring_init(size_t dep)
+{
+    static const uint8_t ops[] =
+    {
+        IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE,
+        IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED
+    };
+
+    struct cring_t *rng = DBG_ALLOC(calloc(1, sizeof(struct cring_t)));
+
+    if(!rng)
+    {
+        // Out of memory.
+        return NULL;
+    }
+
+    // Not a ring until ur_init() says so, 0 is stdin.
+    rng->ur.fd = -1;
+
+    // Two close requests per file at the most.
+    if(!ur_init(&rng->ur, (unsigned) dep << 1))
+    {
+        free(rng);
+        return NULL;
+    }
+
+    long pag = sysconf(_SC_PAGESIZE);
+    void *mem = NULL;
+
+    rng->slot = DBG_ALLOC(calloc(dep, sizeof(struct cslot_t)));
+    rng->mem = posix_memalign(&mem, pag > 0 ? (size_t) pag : sizeof(void *),
+                              dep * COPY_RBUF) ? NULL : DBG_ALLOC(mem);
+
+    if(!rng->slot || !rng->mem || !ur_probe(&rng->ur, ops, sizeof(ops)))
+    {
+        ur_done(&rng->ur);
+        free(rng->slot);
+        free(rng->mem);
+        free(rng);
+        return NULL;
+    }
+
+    struct iovec vec[COPY_JOBS];
+
+    for(size_t cur = 0; cur < dep; cur++)
+    {
+        rng->slot[cur].buf = rng->mem + cur * COPY_RBUF;
+        vec[cur].iov_base = rng->slot[cur].buf;
+        vec[cur].iov_len = COPY_RBUF;
+    }
+
+    // Not having fixed buffers is OK, but slower.
+    rng->fix = ur_buffers(&rng->ur, vec, (unsigned) dep);
+    rng->dep = dep;
+    return rng;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_sqe
+// Description: Get submission queue entry for a file in flight.
+// Input:       struct cring_t *rng:    Copy engine.
+//              struct cslot_t *slt:    File in flight.
+//              uint8_t op:             Operation.
+//              bool out:               Closing destination.
+// Return:      struct io_uring_sqe *:  Entry, NULL on error.
+//------------------------------------------------------------------------------
+static struct io_uring_sqe *h_copyring_sqe(struct cring_t *rng,
+                                           struct cslot_t *slt, uint8_t op,
+                                           bool out)
+{
+    // The slot and what's being closed.
+    uint64_t dat = ((uint64_t) (slt - rng->slot) << 1) | (out ? 1 : 0);
+    struct io_uring_sqe *sqe = ur_sqe(&rng->ur, dat);
+
+    // Make room if the queue is full.
+    if(!sqe && ur_submit(&rng->ur, 0) >= 0)
+    {
+        sqe = ur_sqe(&rng->ur, dat);
+    }
+
+    if(sqe)
+    {
+        sqe->opcode = op;
+    }
+
+    return sqe;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_free
+// Description: Free slot, the file is done.
+// Input:       struct cring_t *rng:    Copy engine.
+//              struct cslot_t *slt:    File in flight.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_free(struct cring_t *rng, struct cslot_t *slt)
+{
+    slt->job->res = slt->res;
+    slt->job = NULL;
+    slt->stage = RNG_FREE;
+    rng->act--;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_close
+// Description: Close source and destination, if open, and set the outcome.
+// Input:       struct cring_t *rng:    Copy engine.
+//              struct cslot_t *slt:    File in flight.
+//              int res:                CPY_DONE / CPY_SEQ / CPY_READ /
+//                                      CPY_OPEN / CPY_WRITE.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_close(struct cring_t *rng, struct cslot_t *slt, int res)
+{
+    int fds[] = { slt->src, slt->dst };
+
+    slt->res = res;
+    slt->stage = RNG_CLOSE;
+    slt->cls = 0;
+
+    for(size_t cur = 0; cur < 2; cur++)
+    {
+        if(fds[cur] < 0)
+        {
+            continue;
+        }
+
+        struct io_uring_sqe *sqe = rng->bad ? NULL :
+                                   h_copyring_sqe(rng, slt, IORING_OP_CLOSE,
+                                                  cur == 1);
+        if(sqe)
+        {
+            sqe->fd = fds[cur];
+            slt->cls++;
+        }
+        else if(close(fds[cur]) && cur == 1 && res == CPY_DONE)
+        {
+            // Close synchronously instead.
+            slt->res = CPY_WRITE;
+        }
+    }
+
+    slt->src = slt->dst = -1;
+
+    if(!slt->cls)
+    {
+        h_copyring_free(rng, slt);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_next
+// Description: Submit the next request of a file in flight. If that fails, the
+//              file is left to h_copyfile.
+// Input:       struct cring_t *rng:    Copy engine.
+//              struct cslot_t *slt:    File in flight.
+//              int stage:              RNG_OPEN / RNG_READ / RNG_CREAT /
+//                                      RNG_WRITE.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_next(struct cring_t *rng, struct cslot_t *slt,
+                            int stage)
+{
+    static const uint8_t opr[] = { 0, IORING_OP_OPENAT, IORING_OP_READ,
+                                   IORING_OP_OPENAT, IORING_OP_WRITE },
+                         opf[] = { 0, IORING_OP_OPENAT, IORING_OP_READ_FIXED,
+                                   IORING_OP_OPENAT, IORING_OP_WRITE_FIXED };
+
+    struct io_uring_sqe *sqe = rng->bad ? NULL : h_copyring_sqe(rng, slt,
+                               rng->fix ? opf[stage] : opr[stage], false);
+    if(!sqe)
+    {
+        h_copyring_close(rng, slt, CPY_SEQ);
+        return;
+    }
+
+    slt->stage = stage;
+
+    if(stage == RNG_OPEN || stage == RNG_CREAT)
+    {
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uintptr_t) (stage == RNG_OPEN ? slt->job->src :
+                                 slt->job->dst);
+        sqe->open_flags = stage == RNG_OPEN ? O_RDONLY :
+                          O_WRONLY | O_CREAT | O_TRUNC;
+        sqe->len = 0666;
+        return;
+    }
+
+    // Read to / write from the buffer of the file.
+    sqe->fd = stage == RNG_READ ? slt->src : slt->dst;
+    sqe->addr = (uintptr_t) (slt->buf + slt->pos);
+    sqe->len = (unsigned) (stage == RNG_READ ? COPY_RBUF :
+                           slt->len - slt->pos);
+    sqe->off = (uint64_t) (slt->off + (off_t) slt->pos);
+
+    if(rng->fix)
+    {
+        sqe->buf_index = (uint16_t) (slt - rng->slot);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_step
+// Description: Move a file in flight to the next stage when a request has
+//              been completed. The stages are the same as in h_copyfile_job;
+//              open and read from the source before creating the destination,
+//              write until there's nothing more to read and close.
+// Input:       struct cring_t *rng:    Copy engine.
+//              uint64_t dat:           User data of the request.
+//              int32_t res:            Result of the request.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_step(struct cring_t *rng, uint64_t dat, int32_t res)
+{
+    struct cslot_t *slt = rng->slot + (dat >> 1);
+
+    switch(slt->stage)
+    {
+    case RNG_OPEN:
+        slt->src = res;
+
+        if(res < 0)
+        {
+            h_copyring_close(rng, slt, CPY_READ);
+        }
+        else
+        {
+            h_copyring_next(rng, slt, RNG_READ);
+        }
+        break;
+
+    case RNG_READ:
+        slt->len = res > 0 ? (size_t) res : 0;
+        slt->pos = 0;
+
+        // The destination is created after the first read.
+        if(res < 0)
+        {
+            h_copyring_close(rng, slt, CPY_READ);
+        }
+        else if(slt->dst < 0)
+        {
+            h_copyring_next(rng, slt, RNG_CREAT);
+        }
+        else if(res > 0)
+        {
+            h_copyring_next(rng, slt, RNG_WRITE);
+        }
+        else
+        {
+            h_copyring_close(rng, slt, CPY_DONE);
+        }
+        break;
+
+    case RNG_CREAT:
+        slt->dst = res;
+
+        if(res < 0)
+        {
+            h_copyring_close(rng, slt, CPY_OPEN);
+        }
+        else if(slt->len)
+        {
+            h_copyring_next(rng, slt, RNG_WRITE);
+        }
+        else
+        {
+            h_copyring_close(rng, slt, CPY_DONE);
+        }
+        break;
+
+    case RNG_WRITE:
+        if(res <= 0)
+        {
+            h_copyring_close(rng, slt, CPY_WRITE);
+            break;
+        }
+
+        slt->pos += (size_t) res;
+
+        // Write what's left, or read more if the buffer was full.
+        if(slt->pos < slt->len)
+        {
+            h_copyring_next(rng, slt, RNG_WRITE);
+        }
+        else if(slt->len == COPY_RBUF)
+        {
+            slt->off += (off_t) slt->len;
+            slt->pos = 0;
+            h_copyring_next(rng, slt, RNG_READ);
+        }
+        else
+        {
+            h_copyring_close(rng, slt, CPY_DONE);
+        }
+        break;
+
+    case RNG_CLOSE:
+        // Failing to close the destination is a write error.
+        if(res < 0 && (dat & 1) && slt->res == CPY_DONE)
+        {
+            slt->res = CPY_WRITE;
+        }
+
+        if(!--slt->cls)
+        {
+            h_copyring_free(rng, slt);
+        }
+        break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_start
+// Description: Start copying a file, or leave it to h_copyfile if it isn't a
+//              small regular file.
+// Input:       struct cring_t *rng:    Copy engine.
+//              struct cjob_t *job:     File to copy.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_start(struct cring_t *rng, struct cjob_t *job)
+{
+    struct stat ist;
+
+    if(rng->bad || !h_copyfile_plain(job->src, job->dst, &ist) ||
+       ist.st_size > COPY_RBUF)
+    {
+        job->res = CPY_SEQ;
+        return;
+    }
+
+    // There's always a free slot when we get here.
+    struct cslot_t *slt = rng->slot;
+
+    while(slt->stage != RNG_FREE)
+    {
+        slt++;
+    }
+
+    job->len = (uint64_t) ist.st_size;
+    slt->job = job;
+    slt->src = slt->dst = -1;
+    slt->off = 0;
+    slt->len = slt->pos = 0;
+    rng->act++;
+
+    h_copyring_next(rng, slt, RNG_OPEN);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_wait
+// Description: Copy files in list order, keeping as many files in flight as
+//              possible, until a file has been copied.
+// Input:       struct cpool_t *pol:    Files to copy.
+//              size_t cur:             File to wait for.
+// Return:      int:                    Outcome of the file.
+//------------------------------------------------------------------------------
+static int h_copyring_wait(struct cpool_t *pol, size_t cur)
+{
+    struct cring_t *rng = pol->rng;
+
+    while(pol->job[cur].res == CPY_WAIT)
+    {
+        // Fill up with the next files in the list.
+        while(rng->act < rng->dep && pol->nxt < pol->num)
+        {
+            struct cjob_t *job = pol->job + pol->nxt++;
+
+            if(job->res != CPY_WAIT)
+            {
+                // Left to h_copyfile.
+                continue;
+            }
+
+            if(h_copyfile_same(job->src, job->dst, pol->sam, &job->len))
+            {
+                // Nothing to copy.
+                job->res = CPY_SAME;
+                continue;
+            }
+
+            h_copyring_start(rng, job);
+        }
+
+        // Submit and wait for something to complete. If the ring is broken,
+        // close what's open and let h_copyfile do the rest.
+        if(rng->act && ur_submit(&rng->ur, 1) < 0 && errno != EAGAIN &&
+           errno != EBUSY)
+        {
+            rng->bad = true;
+
+            for(size_t ndx = 0; ndx < rng->dep; ndx++)
+            {
+                if(rng->slot[ndx].stage != RNG_FREE)
+                {
+                    h_copyring_close(rng, rng->slot + ndx, CPY_SEQ);
+                }
+            }
+        }
+
+        uint64_t dat;
+        int32_t res;
+
+        while(ur_cqe(&rng->ur, &dat, &res))
+        {
+            h_copyring_step(rng, dat, res);
+        }
+    }
+
+    return pol->job[cur].res;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyring_done
+// Description: Wait for the files in flight and free the copy engine.
+// Input:       struct cring_t *rng:    Copy engine.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copyring_done(struct cring_t *rng)
+{
+    while(rng->act && !rng->bad)
+    {
+        uint64_t dat;
+        int32_t res;
+
+        if(ur_submit(&rng->ur, 1) < 0 && errno != EAGAIN && errno != EBUSY)
+        {
+            break;
+        }
+
+        while(ur_cqe(&rng->ur, &dat, &res))
+        {
+            h_copyring_step(rng, dat, res);
+        }
+    }
+
+    ur_done(&rng->ur);
+
+    // If the ring broke, requests might still be in flight. Let the buffers
+    // be rather than having the kernel write to memory that isn't ours.
+    if(!rng->act && !rng->bad)
+    {
+        free(rng->mem);
+    }
+
+    free(rng->slot);
+    free(rng);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_wait
+// Description: Wait for a file to be copied by the workers or by io_uring.
+// Input:       struct cpool_t *pol:    Files to copy.
+//              size_t cur:             File to wait for.
+// Return:      int:                    Outcome of the file.
+//------------------------------------------------------------------------------
+static int h_copyfiles_wait(struct cpool_t *pol, size_t cur)
+{
+    #if defined(LG_URING)
+    if(pol->rng)
+    {
+        // We're doing the work ourselves.
+        return h_copyring_wait(pol, cur);
+    }
+    #endif
+
+    struct cjob_t *job = pol->job + cur;
+
+    pthread_mutex_lock(&pol->mtx);
+
+    while(job->res == CPY_WAIT)
+    {
+        pthread_cond_wait(&pol->cnd, &pol->mtx);
+    }
+
+    // Let the workers move on.
+    int res = job->res;
+    pol->cur = cur + 1;
+    pthread_cond_broadcast(&pol->cnd);
+    pthread_mutex_unlock(&pol->mtx);
+
+    return res;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_pool
+// Description: Copy files using a pool of workers, or io_uring if asked to and
+//              if possible. Directories are created first, in list order. Files
+//              are then copied while the interpreter goes through the list,
+//              waiting for one file at a time. GUI updates, logging, errors and
+//              (nofail) are handled by the interpreter in list order, the same
+//              way as if the files were copied one by one. The only difference
+//              is that a few files further down the list might have been
+//              copied when copying stops because of an error or an abort.
+// Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Files and directories.
+//              const char *dst:    Destination, used in error messages.
+//              bool bck:           Enable back mode.
+//              size_t max:         Max number of workers.
+//              bool urg:           Use io_uring.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfiles_pool(entry_p contxt, plan_p pln, const char *dst,
+                              bool bck, size_t max, bool urg)
+{
+    size_t num = 0, len = 0;
+
+    // Create directories, count files and the size of their destinations.
+    for(size_t cur = 0; cur < pln->num; cur++)
+    {
+        int32_t type = pln->ent[cur].type;
+
+        if(type == LG_DIR && !h_makedir(contxt, pl_dst(pln, cur, NULL)))
+        {
+            ERR(ERR_WRITE_DIR, dst);
+            return G_FALSE;
+        }
+
+        if(type == LG_FILE)
+        {
+            num++;
+            len += strlen(pl_dst(pln, cur, NULL)) + 1;
+        }
+    }
+
+    if(!num)
+    {
+        // Nothing to copy.
+        return G_TRUE;
+    }
+
+    struct cpool_t pol =
+    {
+        .job = DBG_ALLOC(calloc(num, sizeof(struct cjob_t))),
+        .num = num,
+        .sam = get_num(contxt, "@skip-unchanged"),
+        .mtx = PTHREAD_MUTEX_INITIALIZER,
+        .cnd = PTHREAD_COND_INITIALIZER
+    };
+
+    // The workers need all destinations at once.
+    char *out = DBG_ALLOC(calloc(len, 1));
+
+    if((!pol.job || !out) && PANIC(contxt))
+    {
+        // Out of memory.
+        free(pol.job);
+        free(out);
+        return G_ERR;
+    }
+
+    // Files only, in plan order.
+    num = 0;
+
+    for(size_t cur = 0, off = 0; cur < pln->num; cur++)
+    {
+        if(pln->ent[cur].type == LG_FILE)
+        {
+            pol.job[num].src = pl_src(pln, cur);
+            pol.job[num++].dst = pl_dst(pln, cur, out + off);
+            off += strlen(out + off) + 1;
+        }
+    }
+
+    if(!h_copyfiles_deps(pol.job, num) && PANIC(contxt))
+    {
+        // Out of memory.
+        free(pol.job);
+        free(out);
+        return G_ERR;
+    }
+
+    pthread_t thr[COPY_JOBS];
+    size_t run = 0;
+    bool own = false;
+
+    #if defined(LG_URING)
+    // One thread, many files in flight. If io_uring isn't available we fall
+    // back to workers, or to h_copyfile if we don't have any.
+    if(urg)
+    {
+        size_t dep = max > 1 ? max : COPY_RING;
+
+        dep = dep < COPY_JOBS ? dep : COPY_JOBS;
+        pol.rng = h_copyring_init(dep < num ? dep : num);
+    }
+
+    own = pol.rng != NULL;
+    #else
+    (void) urg;
+    #endif
+
+    // No more workers than files.
+    max = max < COPY_JOBS ? max : COPY_JOBS;
+    max = max < num ? max : num;
+    pol.ahd = max << 1;
+
+    for(; !own && max > 1 && run < max; run++)
+    {
+        if(pthread_create(thr + run, NULL, h_copyfiles_worker, &pol))
+        {
+            break;
+        }
+    }
+
+    // Without workers, everything is left to h_copyfile.
+    for(size_t cur = 0; !own && !run && cur < num; cur++)
+    {
+        pol.job[cur].res = CPY_SEQ;
+    }
+
+    bool nga = opt(contxt, OPT_NOGAUGE) != NULL;
+    inp_t grc = G_TRUE;
+
+    for(size_t cur = 0; cur < num && grc == G_TRUE; cur++)
+    {
+        char *src = pol.job[cur].src, *cpy = pol.job[cur].dst;
+        int res = h_copyfiles_wait(&pol, cur);
+
+        // Files left to us might be up to date as well.
+        if(res == CPY_SEQ && h_copyfile_same(src, cpy, pol.sam,
+                                             &pol.job[cur].len))
+        {
+            res = CPY_SAME;
+        }
+
+        if(res == CPY_SEQ)
+        {
+            grc = h_copyfile(contxt, src, cpy, bck, false);
+            continue;
+        }
+
+        // Show GUI, the same way as h_copyfile.
+        grc = gui_copyfiles_setcur(src, nga, bck);
+
+        if((grc != G_TRUE) && HALT)
+        {
+            h_log(contxt, tr(S_ACPY), src, cpy);
+            break;
+        }
+
+        if(res == CPY_SAME)
+        {
+            // Up to date.
+            grc = h_copyfile_skip(contxt, src, cpy, pol.job[cur].len, bck);
+        }
+        else if(res == CPY_DONE)
+        {
+            // Log, copy permissions and so on.
+            grc = h_copyfile_done(contxt, src, cpy, bck, false);
+
+            // The whole file at once.
+            grc = grc == G_TRUE ? h_copyfiles_tick(pol.job[cur].len, nga, bck)
+                                : grc;
+        }
+        else if(opt(contxt, OPT_NOFAIL) ||
+                (res != CPY_READ && opt(contxt, OPT_OKNODELETE)))
+        {
+            // Ignore failure.
+            h_log(contxt, tr(S_NCPY), src, cpy);
+        }
+        else
+        {
+            // Fail for real.
+            ERR(res == CPY_READ ? ERR_READ_FILE : ERR_WRITE_FILE,
+                res == CPY_READ ? src : cpy);
+            grc = G_FALSE;
+        }
+    }
+
+    #if defined(LG_URING)
+    if(own)
+    {
+        h_copyring_done(pol.rng);
+    }
+    #endif
+
+    // Stop the workers and wait for them to finish what they're doing.
+    pthread_mutex_lock(&pol.mtx);
+    pol.stop = true;
+    pthread_cond_broadcast(&pol.cnd);
+    pthread_mutex_unlock(&pol.mtx);
+
+    for(; run; run--)
+    {
+        pthread_join(thr[run - 1], NULL);
+    }
+
+    // The workers might have written to files we never got to.
+    for(size_t cur = 0; cur < num; cur++)
+    {
+        mc_drop(pol.job[cur].dst);
+    }
+
+    pthread_cond_destroy(&pol.cnd);
+    pthread_mutex_destroy(&pol.mtx);
+    free(pol.job);
+    free(out);
+    return grc;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles_room
+// Description: Make sure that there's room for the plan at the destination
+//              before copying anything. Files about to be replaced give back
+//              what they use, but those are only looked up if the plan as a
+//              whole doesn't fit. If the free space is unknown, there's room.
+//              Helper used by n_copyfiles and h_copypipe.
+// Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Files and directories.
+//              const char *dst:    Destination.
+//              bool *chk:          Check, cleared when the user wants to try
+//                                  anyway.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfiles_room(entry_p contxt, plan_p pln, const char *dst,
+                              bool *chk)
+{
+    uint64_t need = *chk ? pl_bytes(pln) : 0;
+    char *dir = need ? DBG_ALLOC(strdup(dst)) : NULL;
+
+    if(!dir)
+    {
+        // Nothing to copy or out of memory.
+        return need && PANIC(contxt) ? G_ERR : G_TRUE;
+    }
+
+    // The destination might not exist yet, ask its closest existing parent.
+    long long spc = -1;
+    size_t len = strlen(dir);
+
+    while(!h_diskspace(*dir ? dir : ".", &spc))
+    {
+        size_t old = len;
+
+        // Cut the last part of the path, keep the volume name.
+        while(len && dir[len - 1] == '/')
+        {
+            len--;
+        }
+
+        while(len && dir[len - 1] != '/' && dir[len - 1] != ':')
+        {
+            len--;
+        }
+
+        if(!old || len == old)
+        {
+            // Not supported or no such volume, the free space is unknown.
+            free(dir);
+            return G_TRUE;
+        }
+
+        dir[len] = '\0';
+    }
+
+    free(dir);
+
+    uint64_t room = spc > 0 ? (uint64_t) spc : 0;
+
+    // Files that we're about to replace make room for their replacements.
+    for(size_t cur = 0; cur < pln->num && need > room; cur++)
+    {
+        struct meta_t met;
+        char *cpy = pln->ent[cur].type == LG_FILE ? pl_dst(pln, cur, NULL) :
+                    NULL;
+
+        if(cpy)
+        {
+            mc_get(cpy, &met);
+
+            if(met.found && met.type == LG_FILE)
+            {
+                need -= met.size < need ? met.size : need;
+            }
+        }
+    }
+
+    if(need <= room)
+    {
+        // There's room.
+        return G_TRUE;
+    }
+
+    if(h_confirm(contxt, "", tr(S_NSPC), dst, (unsigned long) (need >> 10),
+                 (unsigned long) (room >> 10)))
+    {
+        // The user wants to try anyway, don't ask again.
+        *chk = false;
+        return G_TRUE;
+    }
+
+    // Skip or abort.
+    return DID_HALT ? G_ABORT : G_FALSE;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copyfiles
+// Description: Copy files and create directories in list order. Helper used by
+//              n_copyfiles. If asked to, by '-jobs N', files are copied by a
+//              pool of workers on systems with threads, or by io_uring on Linux
+//              with '-uring', unless (infos) or @copy-journal is set. Icons
+//              are copied by h_copyfile when their file has been copied and
+//              might be in the list as well.
+// Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Files and directories.
+//              const char *dst:    Destination, used in error messages.
+//              bool bck:           Enable back mode.
+// Return:      inp_t:              G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+static inp_t h_copyfiles(entry_p contxt, plan_p pln, const char *dst, bool bck)
+{
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // One file at a time by default.
+    char *arg = arg_get(ARG_JOBS);
+    long max = arg ? strtol(arg, NULL, 10) : 1;
+    bool urg = arg_get(ARG_URING) != NULL;
+
+    if((max > 1 || urg) && !opt(contxt, OPT_INFOS) && !jnl.file)
+    {
+        return h_copyfiles_pool(contxt, pln, dst, bck,
+                                max > 1 ? (size_t) max : 1, urg);
+    }
+    #endif
+
+    inp_t grc = G_TRUE;
+    int32_t sam = get_num(contxt, "@skip-unchanged");
+    bool nga = opt(contxt, OPT_NOGAUGE) != NULL;
+
+    // For all files / dirs in plan, copy / create.
+    for(size_t cur = 0; cur < pln->num && grc == G_TRUE; cur++)
+    {
+        int32_t type = pln->ent[cur].type;
+        char *src = pl_src(pln, cur), *cpy = pl_dst(pln, cur, NULL);
+        uint64_t siz = 0;
+
+        // Skip file if up to date / copy file / create dir / skip if non
+        // existing.
+        if(type == LG_FILE && cpy && h_copyfile_same(src, cpy, sam, &siz))
+        {
+            // Show GUI, the same way as h_copyfile.
+            grc = gui_copyfiles_setcur(src, nga, bck);
+            grc = grc == G_TRUE ? h_copyfile_skip(contxt, src, cpy, siz, bck) :
+                  grc;
+        }
+        else if(type == LG_FILE)
+        {
+            grc = h_copyfile(contxt, src, cpy, bck, false);
+        }
+        else if(type == LG_DIR && !h_makedir(contxt, cpy))
+        {
+            ERR(ERR_WRITE_DIR, dst);
+            grc = G_FALSE;
+        }
+    }
+
+    return grc;
+}
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+// Number of entries in each part of a pipelined plan, refer to h_copypipe.
+#define COPY_PART 1024
+
+// Failures found while reading the source, added as the last entry of a part.
+enum
+{
+    PIP_READ = -16, // Couldn't read from directory.
+    PIP_DEPTH       // Too many levels of directories.
+};
+
+// Part of a pipelined plan, filled by the reader and copied by the
+// interpreter.
+struct cpart_t
+{
+    struct plan_t pln;
+    bool rdy;
+    bool lst;
+    bool mem;
+};
+
+// State shared by the interpreter and the reader.
+struct cpipe_t
+{
+    struct cpart_t prt[2];
+    const char *src;
+    const char *dst;
+    bool files;
+    bool stop;
+    pthread_mutex_t mtx;
+    pthread_cond_t cnd;
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_copypipe_put
+// Description: Hand over the current part to the interpreter, and wait for the
+//              other part to be copied unless this is the last one.
+// Input:       struct cpipe_t *pip:    Pipeline.
+//              size_t *cur:            Current part.
+//              bool lst:               Last part.
+// Return:      bool:                   'true' to go on reading, 'false' if the
+//                                      interpreter has stopped copying.
+//------------------------------------------------------------------------------
+static bool h_copypipe_put(struct cpipe_t *pip, size_t *cur, bool lst)
+{
+    struct cpart_t *prt = pip->prt + *cur;
+
+    pthread_mutex_lock(&pip->mtx);
+    prt->rdy = true;
+    prt->lst = lst;
+    pthread_cond_broadcast(&pip->cnd);
+
+    // Switch to the other part when the interpreter is done with it.
+    *cur ^= 1;
+    prt = pip->prt + *cur;
+
+    while(!lst && prt->rdy && !pip->stop)
+    {
+        pthread_cond_wait(&pip->cnd, &pip->mtx);
+    }
+
+    bool run = !lst && !pip->stop;
+    pthread_mutex_unlock(&pip->mtx);
+
+    if(run)
+    {
+        // Reuse the memory of the part.
+        pl_clear(&prt->pln);
+        prt->mem = false;
+    }
+
+    return run;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copypipe_add
+// Description: Add entry to the current part, refer to pl_add. The part is
+//              handed over when full or when a failure has been added.
+// Input:       struct cpipe_t *pip:    Pipeline.
+//              size_t *cur:            Current part.
+//              const char *spre:       Source prefix.
+//              const char *dpre:       Destination prefix.
+//              const char *tail:       Tail of both paths.
+//              int32_t type:           LG_FILE / LG_DIR / LG_NONE / PIP_READ /
+//                                      PIP_DEPTH.
+// Return:      bool:                   'true' to go on reading, 'false' if out
+//                                      of memory or if the interpreter has
+//                                      stopped copying.
+//------------------------------------------------------------------------------
+static bool h_copypipe_add(struct cpipe_t *pip, size_t *cur, const char *spre,
+                           const char *dpre, const char *tail, int32_t type)
+{
+    plan_p pln = &pip->prt[*cur].pln;
+
+    if(!pl_add(pln, spre, dpre, tail, type))
+    {
+        // Out of memory.
+        pip->prt[*cur].mem = true;
+        return false;
+    }
+
+    return (type >= LG_NONE && pln->num < COPY_PART) ||
+           h_copypipe_put(pip, cur, false);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copypipe_read
+// Description: Reader thread. Walks the source tree the same way as
+//              h_filetree_dir, filling one part while the interpreter copies
+//              the other one. Nothing but the pipeline is touched, failures
+//              are passed on to the interpreter as entries.
+// Input:       void *arg:  Pipeline.
+// Return:      void *:     NULL.
+//------------------------------------------------------------------------------
+static void *h_copypipe_read(void *arg)
+{
+    struct cpipe_t *pip = (struct cpipe_t *) arg;
+    struct tframe_t stk[LG_MAXDEP + 1];
+    size_t cur = 0, num = 0;
+    DIR *dir = opendir(pip->src);
+    bool run;
+
+    if(dir)
+    {
+        // Start at the top.
+        num = 1;
+        stk[0].dir = dir;
+        stk[0].spre = h_filetree_cat(pip->src, "", true);
+        stk[0].dpre = h_filetree_cat(pip->dst, "", true);
+        pip->prt[cur].mem = !stk[0].spre || !stk[0].dpre;
+
+        // The type of the first element is known; it's a directory.
+        run = !pip->prt[cur].mem &&
+              h_copypipe_add(pip, &cur, pip->src, pip->dst, "", LG_DIR);
+    }
+    else
+    {
+        // Could not read from dir.
+        run = h_copypipe_add(pip, &cur, pip->src, "", "", PIP_READ);
+    }
+
+    while(run && num)
+    {
+        struct tframe_t *top = stk + num - 1;
+        struct dirent *entry = readdir(top->dir);
+
+        // Done with this directory?
+        if(!entry)
+        {
+            // Back to the parent.
+            h_filetree_close(top);
+            num--;
+            continue;
+        }
+
+        if(!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+        {
+            // Not part of the tree.
+            continue;
+        }
+
+        // File or directory?
+        uint64_t siz = 0;
+        int32_t type = h_filetree_type(top->dir, entry, &siz);
+
+        // No need to store directory names if the (files) option is set.
+        if(type == LG_DIR && pip->files)
+        {
+            continue;
+        }
+
+        // Descend if we have a directory.
+        if(type == LG_DIR)
+        {
+            struct tframe_t *sub = stk + num;
+
+            // Keep track of recursion depth.
+            if(num > LG_MAXDEP)
+            {
+                // This is not a realistic path.
+                run = h_copypipe_add(pip, &cur, top->spre, "", entry->d_name,
+                                     PIP_DEPTH);
+                continue;
+            }
+
+            sub->dir = h_filetree_open(top->dir, entry, NULL);
+
+            if(!sub->dir)
+            {
+                // Could not read from dir.
+                run = h_copypipe_add(pip, &cur, top->spre, "", entry->d_name,
+                                     PIP_READ);
+                continue;
+            }
+
+            sub->spre = h_filetree_cat(top->spre, entry->d_name, true);
+            sub->dpre = h_filetree_cat(top->dpre, entry->d_name, true);
+            num++;
+
+            if(!sub->spre || !sub->dpre)
+            {
+                // Out of memory.
+                pip->prt[cur].mem = true;
+                break;
+            }
+        }
+
+        // Source and destination share the name.
+        pl_size(&pip->prt[cur].pln, siz);
+        run = h_copypipe_add(pip, &cur, top->spre, top->dpre, entry->d_name,
+                             type);
+    }
+
+    // Close whatever is left open on failure.
+    for(; num; num--)
+    {
+        h_filetree_close(stk + num - 1);
+    }
+
+    // Whatever we have, even if empty, is the last part.
+    h_copypipe_put(pip, &cur, true);
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_copypipe_err
+// Description: Raise the failure, if any, found when reading a part.
+// Input:       entry_p contxt:     The execution context.
+//              plan_p pln:         Part.
+//              bool mem:           The reader ran out of memory.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_copypipe_err(entry_p contxt, plan_p pln, bool mem)
+{
+    int32_t type = pln->num ? pln->ent[pln->num - 1].type : LG_NONE;
+
+    if(type == PIP_READ)
+    {
+        // Could not read from dir.
+        ERR(ERR_READ_DIR, pl_src(pln, pln->num - 1));
+    }
+    else if(type == PIP_DEPTH)
+    {
+        // This is not a realistic path.
+        ERR(ERR_MAX_DEPTH, contxt->name);
+    }
+    else if(mem)
+    {
+        // Out of memory.
+        PANIC(contxt);
+    }
+}
+
 //------------------------------------------------------------------------------
-static bool h_makedir_path(char *dst)
+// Name:        h_copypipe
+// Description: Copy directory while it's being read, used by n_copyfiles when
+//              asked to by '-pipe'. A reader thread fills two parts of at most
+//              COPY_PART entries each, one at a time, while the interpreter
+//              copies the other one using h_copyfiles. Memory use depends on
+//              the size of the parts instead of the size of the tree, and the
+//              number of bytes to copy grows as files are found. The free space
+//              is checked for each part before it's copied, when the parts
+//              before it have been written. Failures found by the reader are
+//              raised when the entries before them have been copied, in the
+//              same order as they were found.
+// Input:       entry_p contxt:     The execution context.
+//              const char *src:    Source directory.
+//              const char *dst:    Destination directory.
+//              const char *msg:    Prompt.
+//              bool bck:           Enable back mode.
+//              inp_t *grc:         G_TRUE / G_FALSE / G_ABORT / G_ERR.
+// Return:      bool:               'true' if the directory was handled,
+//                                  'false' if the reader couldn't be started.
+//------------------------------------------------------------------------------
+static bool h_copypipe(entry_p contxt, const char *src, const char *dst,
+                       const char *msg, bool bck, inp_t *grc)
 {
-    if(h_exists(dst) == LG_DIR)
+    struct cpipe_t pip =
     {
-        // Nothing to do,
-        return true;
+        .src = src,
+        .dst = dst,
+        .files = opt(contxt, OPT_FILES) != NULL,
+        .mtx = PTHREAD_MUTEX_INITIALIZER,
+        .cnd = PTHREAD_COND_INITIALIZER
+    };
+
+    pthread_t thr;
+
+    if(pthread_create(&thr, NULL, h_copypipe_read, &pip))
+    {
+        // No reader, read everything first.
+        return false;
     }
 
-    // Create working copy.
-    char *buf = buf_get(B_KEY);
-    strncpy(buf, dst, buf_len());
+    bool lst = false, gui = false, chk = true;
+    size_t cur = 0;
 
-    // Create all directories one by one.
-    for(size_t ndx = 0; buf[ndx]; ndx++)
+    for(*grc = G_TRUE; !lst && *grc == G_TRUE; cur ^= 1)
     {
-        // Find separator or end of string.
-        if(buf[ndx] == '/')
+        struct cpart_t *prt = pip.prt + cur;
+        plan_p pln = &prt->pln;
+
+        pthread_mutex_lock(&pip.mtx);
+
+        while(!prt->rdy)
         {
-            // Terminate string.
-            buf[ndx] = '\0';
+            pthread_cond_wait(&pip.cnd, &pip.mtx);
+        }
 
-            // Create directory if it doesn't exist.
-            if(h_exists(buf) == LG_NONE && mkdir(buf, 0777))
+        lst = prt->lst;
+        pthread_mutex_unlock(&pip.mtx);
+
+        if(!gui)
+        {
+            if(!pln->num || pln->ent[0].type != LG_DIR)
             {
-                buf_put(B_KEY);
-                return false;
+                // I/O error or out of memory. Nothing to copy.
+                h_copypipe_err(contxt, pln, prt->mem);
+                break;
             }
 
-            // Reinstate separator.
-            buf[ndx] = '/';
+            // Initialize GUI with what we have so far.
+            *grc = gui_copyfiles_start(msg, NULL, pln, false, bck);
+            gui = true;
         }
-    }
 
-    // Unlock buffer.
-    buf_put(B_KEY);
+        // More files have been found.
+        cst.prg.max += pl_bytes(pln);
 
-    // The path as a whole exists or the final directory needs to be created.
-    return h_exists(dst) == LG_DIR || !mkdir(dst, 0777);
-}
+        if(*grc == G_TRUE)
+        {
+            *grc = h_copyfiles_room(contxt, pln, dst, &chk);
+        }
 
-//------------------------------------------------------------------------------
-// Name:        h_makedir
-// Description: Create directory / icon / tree of directories.
-// Input:       entry_p contxt:     The execution context.
-//              char *dst:          The directory.
-// Return:      bool:               'true' on succes, 'false' otherwise.
-//------------------------------------------------------------------------------
-static bool h_makedir(entry_p contxt, char *dst)
-{
-    if(!dst && PANIC(contxt))
-    {
-        return false;
-    }
+        if(*grc == G_TRUE)
+        {
+            *grc = h_copyfiles(contxt, pln, dst, bck);
+        }
 
-    // Make full path if it doesn't exist.
-    if(!h_makedir_path(dst))
-    {
-        return false;
+        if(*grc == G_TRUE)
+        {
+            h_copypipe_err(contxt, pln, prt->mem);
+        }
+
+        // Let the reader fill this part again.
+        pthread_mutex_lock(&pip.mtx);
+        prt->rdy = false;
+        pthread_cond_broadcast(&pip.cnd);
+        pthread_mutex_unlock(&pip.mtx);
     }
 
-    // Create icon if (infos) is set. Ignore errors.
-    if(opt(contxt, OPT_INFOS))
+    // Stop reading if we're not done.
+    pthread_mutex_lock(&pip.mtx);
+    pip.stop = true;
+    pthread_cond_broadcast(&pip.cnd);
+    pthread_mutex_unlock(&pip.mtx);
+    pthread_join(thr, NULL);
+
+    if(gui)
     {
-        h_makedir_create_icon(contxt, dst);
+        // GUI and event teardown.
+        gui_copyfiles_end();
     }
 
+    pthread_cond_destroy(&pip.cnd);
+    pthread_mutex_destroy(&pip.mtx);
+    pl_free(&pip.prt[0].pln);
+    pl_free(&pip.prt[1].pln);
     return true;
 }
+#endif
 
 //------------------------------------------------------------------------------
 // (copyfiles (prompt..) (help..) (source..) (dest..) (newname..) (choices..)
@@ -1462,57 +4258,88 @@ entry_p n_copyfiles(entry_p contxt)
         if(dln && dst[dln - 1] != ':')
         {
             chmod(dst, POSIX_RWX_MASK);
+            mc_drop(dst);
         }
     }
 
-    // Traverse source directory and create destination strings.
-    pnode_p tree = h_filetree(contxt, src, src, dst, files, fonts, choices,
-                              pattern, infos);
-    if(!tree)
-    {
-        // I/O error or out of memory. Status set by h_filetree. The CBM
-        // installer always returns (dest).
-        R_STR(DBG_ALLOC(strdup(dst)));
-    }
+    struct plan_t pln = { .ent = NULL };
+    inp_t grc = G_TRUE;
+    bool pip = false;
 
-    // Start from the top.
-    pnode_p cur = tree;
+    // Nothing copied so far.
+    h_copyfiles_begin();
 
-    // Replace file name if single file and the 'newname' option is set
-    if(newname && cur->next && cur->type == LG_DIR &&
-       cur->next->type == LG_FILE && !cur->next->next)
+    if(!h_journal_open(contxt))
     {
-        free(cur->next->copy);
-        cur->next->copy = h_tackon(contxt, dst, str(newname));
+        // Journal not writable or out of memory.
+        R_EST;
     }
 
-    // Initialize GUI, set up file lists, events, and so on.
-    inp_t grc = gui_copyfiles_start(prompt ? str(prompt) : NULL, confirm ?
-                                    str(help) : NULL, cur, confirm != false,
-                                    back != false);
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // Copy directories while they're being read if asked to, refer to
+    // h_copypipe. Selections, patterns and icons need the complete tree.
+    pip = arg_get(ARG_PIPE) && !choices && !pattern && !infos && !confirm &&
+          h_exists(src) == LG_DIR &&
+          h_copypipe(contxt, src, dst, prompt ? str(prompt) : NULL,
+                     back != false, &grc);
+    #endif
 
-    // Start copy unless skip / abort / back.
-    if(grc == G_TRUE)
+    if(!pip)
     {
-        // For all files / dirs in list, copy / create.
-        for(; cur && grc == G_TRUE; cur = cur->next)
+        // Traverse source directory and create destination strings.
+        h_filetree(contxt, &pln, src, src, dst, files, fonts, choices, pattern,
+                   infos);
+
+        if(!pln.num)
         {
-            // Copy file / create dir / skip if non existing.
-            if(cur->type == LG_FILE)
-            {
-                grc = h_copyfile(contxt, cur->name, cur->copy, back != false,
-                                 false);
-            }
-            else if(cur->type == LG_DIR && !h_makedir(contxt, cur->copy))
+            // I/O error or out of memory. Status set by h_filetree. The CBM
+            // installer always returns (dest).
+            h_copyfiles_stats(contxt);
+            h_journal_close(false);
+            R_STR(DBG_ALLOC(strdup(dst)));
+        }
+
+        // Replace file name if single file and the 'newname' option is set
+        if(newname && pln.num == 2 && pln.ent[0].type == LG_DIR &&
+           pln.ent[1].type == LG_FILE)
+        {
+            char *cpy = h_tackon(contxt, dst, str(newname));
+
+            if(cpy && !pl_set(&pln, 1, cpy))
             {
-                ERR(ERR_WRITE_DIR, dst);
-                grc = G_FALSE;
+                PANIC(contxt);
             }
+
+            free(cpy);
+        }
+
+        // Initialize GUI, set up file lists, events, and so on.
+        grc = gui_copyfiles_start(prompt ? str(prompt) : NULL, confirm ?
+                                  str(help) : NULL, &pln, confirm != false,
+                                  back != false);
+
+        // Start copy unless skip / abort / back.
+        if(grc == G_TRUE)
+        {
+            bool chk = true;
+            cst.prg.max = pl_bytes(&pln);
+            grc = h_copyfiles_room(contxt, &pln, dst, &chk);
+        }
+
+        // Copy unless there's no room and the user doesn't want to try.
+        if(grc == G_TRUE)
+        {
+            grc = h_copyfiles(contxt, &pln, dst, back != false);
         }
+
+        // GUI and event teardown.
+        gui_copyfiles_end();
     }
 
-    // GUI and event teardown.
-    gui_copyfiles_end();
+    // Let the script and the log know how it went. Keep the journal unless
+    // we're done.
+    h_copyfiles_stats(contxt);
+    h_journal_close(grc == G_TRUE);
 
     // Back return value.
     entry_p bck = NULL;
@@ -1543,17 +4370,8 @@ entry_p n_copyfiles(entry_p contxt)
         }
     }
 
-    cur = tree;
-
-    // Free list of files / dirs.
-    while(cur)
-    {
-        tree = cur;
-        free(cur->name);
-        free(cur->copy);
-        cur = cur->next;
-        free(tree);
-    }
+    // Free plan.
+    pl_free(&pln);
 
     // Return resolved (back) if it exists.
     if(bck)
@@ -1650,7 +4468,7 @@ static inp_t h_copylib_none(entry_p contxt, char *src, char *dst)
     }
 
     // Get source file version.
-    int32_t ver = h_getversion_file(src);
+    int32_t ver = h_getversion_file(contxt, src);
 
     if(ver == LG_NOVER)
     {
@@ -1812,8 +4630,18 @@ static inp_t h_copylib_known_known(entry_p contxt, char *src, char *dst,
 //------------------------------------------------------------------------------
 static inp_t h_copylib_file(entry_p contxt, char *src, char *dst)
 {
+    uint64_t siz = 0;
+
+    // No need to compare versions if nothing has changed.
+    if(h_copyfile_same(src, dst, get_num(contxt, "@skip-unchanged"), &siz))
+    {
+        h_log(contxt, tr(S_UPTD), src, dst);
+        return G_TRUE;
+    }
+
     // Get version of source and destination file.
-    int32_t old = h_getversion_file(dst), new = h_getversion_file(src);
+    int32_t old = h_getversion_file(contxt, dst),
+            new = h_getversion_file(contxt, src);
 
     if(!opt(contxt, OPT_CONFIRM))
     {
@@ -1999,8 +4827,11 @@ static int32_t h_delete_info(entry_p contxt, const char *file)
     {
         // Set write permission and delete file.
         mode_t perm = POSIX_WRITE_MASK;
+        bool done = !chmod(info, perm) && !remove(info);
+
+        mc_drop(info);
 
-        if(chmod(info, perm) || remove(info))
+        if(!done)
         {
             ERR(ERR_DELETE_FILE, info);
             return LG_FALSE;
@@ -2097,7 +4928,12 @@ static int32_t h_delete_file(entry_p contxt, const char *file)
         }
     }
 
-    if(remove(file))
+    bool done = !remove(file);
+
+    // Deleted, or at least the permissions might have changed.
+    mc_drop(file);
+
+    if(!done)
     {
         // Could not delete file.
         ERR(ERR_DELETE_FILE, file);
@@ -2111,6 +4947,383 @@ static int32_t h_delete_file(entry_p contxt, const char *file)
     return opt(contxt, OPT_INFOS) ? h_delete_info(contxt, file) : LG_TRUE;
 }
 
+#if !defined(AMIGA) && !defined(__MINGW32__)
+// Directory to be emptied and removed, refer to h_delete_tree. A directory
+// is pending until it has been read and all its subdirectories are gone.
+struct dtask_t
+{
+    char *path;
+    struct dtask_t *up;
+    struct dtask_t *next;
+    size_t pend;
+    bool keep;
+};
+
+// State shared by the interpreter and the delete workers. Directories are
+// kept on a stack shared by all, the most recently found are taken first.
+struct dpool_t
+{
+    struct dtask_t *top;
+    size_t busy;
+    bool force;
+    bool log;
+    bool mem;
+    char *lst;
+    size_t len;
+    size_t cap;
+    pthread_mutex_t mtx;
+    pthread_cond_t cnd;
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree_log
+// Description: Save the name of a deleted file, to be written to the log file
+//              by the interpreter. Used by h_delete_tree_scan.
+// Input:       struct dpool_t *pol:    Pool.
+//              const char *pre:        Directory, ending with a delimiter.
+//              const char *name:       File name.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_delete_tree_log(struct dpool_t *pol, const char *pre,
+                              const char *name)
+{
+    size_t pln = strlen(pre), nln = strlen(name) + 1;
+
+    pthread_mutex_lock(&pol->mtx);
+
+    if(pol->len + pln + nln > pol->cap)
+    {
+        size_t cap = (pol->cap ? pol->cap : 4096) << 1;
+        cap = cap < pol->len + pln + nln ? pol->len + pln + nln : cap;
+
+        char *lst = DBG_ALLOC(realloc(pol->lst, cap));
+
+        if(!lst)
+        {
+            // Out of memory, let the interpreter know.
+            pol->mem = true;
+            pthread_mutex_unlock(&pol->mtx);
+            return;
+        }
+
+        pol->lst = lst;
+        pol->cap = cap;
+    }
+
+    memcpy(pol->lst + pol->len, pre, pln);
+    memcpy(pol->lst + pol->len + pln, name, nln);
+    pol->len += pln + nln;
+    pthread_mutex_unlock(&pol->mtx);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree_flush
+// Description: Write the names of the files deleted so far to the log file.
+//              Only the interpreter may do this.
+// Input:       entry_p contxt:         The execution context.
+//              struct dpool_t *pol:    Pool.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_delete_tree_flush(entry_p contxt, struct dpool_t *pol)
+{
+    pthread_mutex_lock(&pol->mtx);
+    char *lst = pol->lst;
+    size_t len = pol->len;
+    pol->lst = NULL;
+    pol->len = pol->cap = 0;
+    pthread_mutex_unlock(&pol->mtx);
+
+    for(size_t off = 0; off < len; off += strlen(lst + off) + 1)
+    {
+        h_log(contxt, tr(S_DLTD), lst + off);
+    }
+
+    free(lst);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree_done
+// Description: Remove directory if it's no longer pending, and its parent if
+//              that was the last thing holding it back, and so on. The top
+//              directory is left to h_delete_dir. Must be called with the
+//              pool locked.
+// Input:       struct dtask_t *tsk:    Directory.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_delete_tree_done(struct dtask_t *tsk)
+{
+    while(tsk->up && !--tsk->pend)
+    {
+        struct dtask_t *up = tsk->up;
+
+        // Something left inside or a directory that can't be removed will
+        // keep all parents from being removed as well.
+        if(tsk->keep || rmdir(tsk->path))
+        {
+            up->keep = true;
+        }
+
+        free(tsk->path);
+        free(tsk);
+        tsk = up;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree_scan
+// Description: Delete all files in directory and queue its subdirectories.
+//              Everything that h_delete_file and h_delete_dir would have to
+//              ask about, or fail on, is left alone. Links are removed, never
+//              followed.
+// Input:       struct dpool_t *pol:    Pool.
+//              struct dtask_t *tsk:    Directory.
+// Return:      bool:                   'true' if something was left alone.
+//------------------------------------------------------------------------------
+static bool h_delete_tree_scan(struct dpool_t *pol, struct dtask_t *tsk)
+{
+    int fd = open(tsk->path, O_RDONLY | O_DIRECTORY);
+    DIR *dir = fd < 0 ? NULL : fdopendir(fd);
+
+    if(!dir)
+    {
+        // Leave it to h_delete_dir.
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+
+        return true;
+    }
+
+    bool keep = false;
+
+    for(struct dirent *ent = readdir(dir); ent; ent = readdir(dir))
+    {
+        const char *name = ent->d_name;
+
+        if(!strcmp(name, ".") || !strcmp(name, ".."))
+        {
+            // Not part of the tree.
+            continue;
+        }
+
+        bool sub = false, lnk = false;
+
+        #if defined(DT_UNKNOWN)
+        sub = ent->d_type == DT_DIR;
+        lnk = ent->d_type == DT_LNK;
+
+        if(ent->d_type == DT_UNKNOWN)
+        #endif
+        {
+            struct stat fst;
+
+            if(fstatat(fd, name, &fst, AT_SYMLINK_NOFOLLOW))
+            {
+                // Gone already?
+                keep = true;
+                continue;
+            }
+
+            sub = S_ISDIR(fst.st_mode);
+            lnk = S_ISLNK(fst.st_mode);
+        }
+
+        // Same permission checks as h_delete_perm, same as h_delete_file and
+        // h_delete_dir with (force).
+        if(!lnk && !pol->force && faccessat(fd, name, W_OK, 0))
+        {
+            // Might need to ask.
+            keep = true;
+            continue;
+        }
+
+        if(sub)
+        {
+            // Give permissions so that delete can succeed.
+            fchmodat(fd, name, POSIX_RWX_MASK, 0);
+
+            struct dtask_t *nsk = DBG_ALLOC(calloc(1, sizeof(struct dtask_t)));
+            char *path = nsk ? h_filetree_cat(tsk->path, name, true) : NULL;
+
+            if(!path)
+            {
+                // Out of memory, let the interpreter know.
+                free(nsk);
+                pthread_mutex_lock(&pol->mtx);
+                pol->mem = keep = true;
+                pthread_mutex_unlock(&pol->mtx);
+                continue;
+            }
+
+            nsk->path = path;
+            nsk->up = tsk;
+            nsk->pend = 1;
+
+            // Somebody idle will pick it up.
+            pthread_mutex_lock(&pol->mtx);
+            tsk->pend++;
+            nsk->next = pol->top;
+            pol->top = nsk;
+            pthread_cond_signal(&pol->cnd);
+            pthread_mutex_unlock(&pol->mtx);
+            continue;
+        }
+
+        if(!lnk && pol->force)
+        {
+            fchmodat(fd, name, POSIX_RWX_MASK, 0);
+        }
+
+        if(unlinkat(fd, name, 0))
+        {
+            // Leave the error to h_delete_file.
+            keep = true;
+            continue;
+        }
+
+        if(pol->log)
+        {
+            h_delete_tree_log(pol, tsk->path, name);
+        }
+    }
+
+    closedir(dir);
+    return keep;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree_run
+// Description: Take directories from the pool until there are none left and
+//              no one is busy finding new ones. Used by the workers and by the
+//              interpreter, the interpreter writes to the log file as well.
+// Input:       entry_p contxt:         The execution context, NULL in workers.
+//              struct dpool_t *pol:    Pool.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_delete_tree_run(entry_p contxt, struct dpool_t *pol)
+{
+    pthread_mutex_lock(&pol->mtx);
+
+    for(;;)
+    {
+        while(!pol->top && pol->busy)
+        {
+            pthread_cond_wait(&pol->cnd, &pol->mtx);
+        }
+
+        struct dtask_t *tsk = pol->top;
+
+        if(!tsk)
+        {
+            // Nothing queued and no one busy, we're done.
+            break;
+        }
+
+        pol->top = tsk->next;
+        pol->busy++;
+        pthread_mutex_unlock(&pol->mtx);
+
+        bool keep = h_delete_tree_scan(pol, tsk);
+
+        if(contxt && pol->log)
+        {
+            h_delete_tree_flush(contxt, pol);
+        }
+
+        pthread_mutex_lock(&pol->mtx);
+        tsk->keep = tsk->keep || keep;
+        h_delete_tree_done(tsk);
+        pol->busy--;
+
+        if(!pol->top && !pol->busy)
+        {
+            // Wake up everyone so that they can leave.
+            pthread_cond_broadcast(&pol->cnd);
+        }
+    }
+
+    pthread_mutex_unlock(&pol->mtx);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_worker
+// Description: Delete worker, refer to h_delete_tree.
+// Input:       void *arg:  Pool.
+// Return:      void *:     NULL.
+//------------------------------------------------------------------------------
+static void *h_delete_worker(void *arg)
+{
+    h_delete_tree_run(NULL, (struct dpool_t *) arg);
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_delete_tree
+// Description: Remove everything in directory that can be removed without
+//              asking the user. Files are removed relative to their directory
+//              and subdirectories are handled in parallel by a pool of
+//              workers, as many as '-jobs N', the interpreter included.
+//              Anything left is left to the passes in h_delete_dir, where
+//              the user can be asked, one question at a time.
+// Input:       entry_p contxt:     The execution context.
+//              const char *name:   Directory.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_delete_tree(entry_p contxt, const char *name)
+{
+    struct dtask_t top = { .path = h_filetree_cat(name, "", true), .pend = 1 };
+
+    if(!top.path && PANIC(contxt))
+    {
+        // Out of memory.
+        return;
+    }
+
+    struct dpool_t pol =
+    {
+        .top = &top,
+        .force = opt(contxt, OPT_FORCE) != NULL,
+        .log = get_num(contxt, "@log") != 0,
+        .mtx = PTHREAD_MUTEX_INITIALIZER,
+        .cnd = PTHREAD_COND_INITIALIZER
+    };
+
+    // Same limit as when copying.
+    char *arg = arg_get(ARG_JOBS);
+    long max = arg ? strtol(arg, NULL, 10) : 1;
+    pthread_t thr[COPY_JOBS];
+    size_t run = 0;
+
+    max = max < COPY_JOBS ? max : COPY_JOBS;
+
+    for(; (long) run + 1 < max; run++)
+    {
+        if(pthread_create(thr + run, NULL, h_delete_worker, &pol))
+        {
+            break;
+        }
+    }
+
+    h_delete_tree_run(contxt, &pol);
+
+    for(; run; run--)
+    {
+        pthread_join(thr[run - 1], NULL);
+    }
+
+    h_delete_tree_flush(contxt, &pol);
+    pthread_cond_destroy(&pol.cnd);
+    pthread_mutex_destroy(&pol.mtx);
+    free(top.path);
+
+    if(pol.mem)
+    {
+        PANIC(contxt);
+    }
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Name:        h_delete_dir
 // Description: Delete directory. Helper used by n_delete.
@@ -2157,6 +5370,12 @@ static int32_t h_delete_dir(entry_p contxt, const char *name)
     {
         if(all)
         {
+            #if !defined(AMIGA) && !defined(__MINGW32__)
+            // Remove what we can without asking first. What's left, if
+            // anything, is handled one by one below.
+            h_delete_tree(contxt, name);
+            #endif
+
             DIR *dir = opendir(name);
 
             // Permission to read?
@@ -2319,6 +5538,9 @@ static int32_t h_delete_pattern(entry_p contxt, const char *pat)
     MatchEnd(apt);
     free(apt);
 
+    // We don't know what has been deleted.
+    mc_clear();
+
     // Is there nothing left?
     if(!err || err == ERROR_NO_MORE_ENTRIES)
     {
@@ -2344,6 +5566,8 @@ static int32_t h_delete_pattern(entry_p contxt, const char *pat)
 //------------------------------------------------------------------------------
 static int32_t h_delete(entry_p contxt, const char *file)
 {
+    int32_t res;
+
     switch(h_exists(file))
     {
         case LG_NONE:
@@ -2354,7 +5578,10 @@ static int32_t h_delete(entry_p contxt, const char *file)
             return h_delete_file(contxt, file);
 
         case LG_DIR:
-            return h_delete_dir(contxt, file);
+            // Anything below the directory might be gone.
+            res = h_delete_dir(contxt, file);
+            mc_clear();
+            return res;
 
         default:
             return PANIC(contxt);
@@ -2445,7 +5672,7 @@ entry_p n_exists(entry_p contxt)
         #endif
 
         // Get type (file / dir / 0)
-        int32_t res = h_exists(str(C_ARG(1)));
+        int32_t res = h_exists_check(str(C_ARG(1)));
 
         #if defined(AMIGA) && !defined(LG_TEST)
         // Restore auto request.
@@ -2456,7 +5683,7 @@ entry_p n_exists(entry_p contxt)
     }
 
     // Get type (file / dir / 0)
-    R_NUM(h_exists(str(C_ARG(1))));
+    R_NUM(h_exists_check(str(C_ARG(1))));
 }
 
 //------------------------------------------------------------------------------
@@ -2478,6 +5705,10 @@ entry_p n_fileonly(entry_p contxt)
 // (foreach <dir> <pattern> <statements>)
 //     do for entries in directory
 //
+//     The matching entries are collected before the statements are executed.
+//     Memory use grows with the number of matches, reading one entry at a
+//     time would let the statements see entries that they create or rename.
+//
 // Refer to Installer.guide 1.19 (29.4.96) 1995-96 by ESCOM AG
 //------------------------------------------------------------------------------
 entry_p n_foreach(entry_p contxt)
@@ -2485,194 +5716,175 @@ entry_p n_foreach(entry_p contxt)
     // Three arguments and no options.
     C_SANE(3, NULL);
 
-    // Pattern matching is not done on non-Amiga systems and not in test mode.
-    #if defined(AMIGA) && !defined(LG_TEST)
-    const char *pt = str(C_ARG(2));
+    const char *dname = str(C_ARG(1)), *pt = str(C_ARG(2));
+
+    // The directory is only open while the matching entries are collected.
+    DIR *dir = opendir(dname);
+
+    if(!dir)
+    {
+        ERR(ERR_READ_DIR, dname);
+        R_NUM(LG_FALSE);
+    }
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    // Parse the pattern once.
+    size_t len = strlen(pt) * 2 + 2;
+    char *mat = DBG_ALLOC(malloc(len));
+    LONG wld = mat ? ParsePatternNoCase(pt, mat, (LONG) len) : -1;
+
+    // Types are taken from here, they're not limited to LG_FILE / LG_DIR.
+    struct FileInfoBlock *fib = (struct FileInfoBlock *)
+           AllocDosObject(DOS_FIB, NULL);
+    bool err = !mat || !fib, bad = wld < 0;
+    #else
+    // Compile the pattern once. Failure means that it's invalid or that we're
+    // out of memory, let's assume the former.
+    match_p mat = mt_compile(pt);
+    bool err = false, bad = !mat;
+    #endif
+
+    #if defined(AMIGA) || defined(__MINGW32__)
+    // Prefix of entry paths.
+    char *pre = h_filetree_cat("", dname, true);
+    err = err || !pre;
     #endif
 
-    // Open dir and assume failure.
-    const char *dname = str(C_ARG(1));
-    DIR *dir = opendir(dname);
-    pnode_p top = NULL;
-    bool err = true;
+    // Collect all matching entries before the body is executed, what the
+    // body creates, renames or deletes doesn't change what's visited.
+    struct plan_t pln = { .ent = NULL };
 
-    // Permission to read?
-    if(dir)
+    for(struct dirent *ent = err || bad ? NULL : readdir(dir); ent;
+        ent = readdir(dir))
     {
-        // Use global buffer.
-        char *cwd = buf_raw();
-        struct dirent *ent = readdir(dir);
+        const char *name = ent->d_name;
 
-        // Save current working directory and enter the directory <drawer name>
-        if(getcwd(cwd, buf_len()) == cwd && !chdir(dname))
+        #ifndef AMIGA
+        // Filter out the magic on non-Amigas.
+        if(!strcmp(name, ".") || !strcmp(name, ".."))
         {
-            // Allocate memory for the start node.
-            pnode_p cur;
-            top = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
+            continue;
+        }
+        #endif
 
-            #if defined(AMIGA) && !defined(LG_TEST)
-            // This file info block will be used for all files and subdirs.
-            struct FileInfoBlock *fib = (struct FileInfoBlock *)
-                   AllocDosObject(DOS_FIB, NULL);
+        #if defined(AMIGA) && !defined(LG_TEST)
+        if(wld ? !MatchPatternNoCase(mat, (STRPTR) name) :
+           strcasecmp(name, pt))
+        #else
+        if(!mt_match(mat, name))
+        #endif
+        {
+            // Not what we're looking for.
+            continue;
+        }
 
-            // Use cur as a gatekeeper. If set to NULL, nothing will take place
-            // except clean ups.
-            cur = fib ? top : NULL;
-            #else
-            // No pattern matching = no fib.
-            cur = top;
-            #endif
+        int32_t type = LG_NONE;
 
-            // The dir might be empty but that's not an error.
-            err = false;
+        #if !defined(AMIGA) && !defined(__MINGW32__)
+        uint64_t siz;
+        type = h_filetree_type(dir, ent, &siz);
+        #else
+        char *path = h_filetree_cat(pre, name, false);
 
-            // Iterate over all entries in dir.
-            while(ent && cur && !err)
-            {
-                // Name of file / dir.
-                const char *name = ent->d_name;
+        if(!path)
+        {
+            // Out of memory.
+            err = true;
+            break;
+        }
 
-                #ifndef AMIGA
-                // Filter out the magic on non-Amigas.
-                if(strcmp(name, ".") && strcmp(name, ".."))
-                #endif
-                {
-                    #if defined(AMIGA) && !defined(LG_TEST)
-                    // The dir is not empty, we should be able to go all the way
-                    // here. Assume failure.
-                    err = true;
+        #if defined(AMIGA) && !defined(LG_TEST)
+        BPTR lock = (BPTR) Lock(path, ACCESS_READ);
 
-                    // Lock and get information we need from the current entry.
-                    BPTR lock = (BPTR) Lock(name, ACCESS_READ);
+        // Lock and get information we need from the current entry.
+        bool gon = !lock || !Examine(lock, fib);
+        type = gon ? LG_NONE : (int32_t) fib->fib_DirEntryType;
+        UnLock(lock);
+        #else
+        type = h_exists(path);
+        bool gon = false;
+        #endif
 
-                    if(lock)
-                    {
-                        if(Examine(lock, fib))
-                        {
-                            // If lock / examine failed cur->name will be NULL.
-                            cur->type = fib->fib_DirEntryType;
-                            cur->name = DBG_ALLOC(strdup(name));
+        free(path);
 
-                            // We're good. PANIC:s will be caught further down.
-                            err = false;
-                        }
+        if(gon)
+        {
+            // The entry is gone or unreadable.
+            ERR(ERR_READ_DIR, dname);
+            break;
+        }
+        #endif
 
-                        UnLock(lock);
-                    }
-                    #else
-                    cur->type = h_exists(name);
-                    cur->name = DBG_ALLOC(strdup(name));
-                    err = get_num(contxt, "@alfa") == LG_TRUE;
-                    #endif
+        if(!pl_add(&pln, "", "", name, type))
+        {
+            // Out of memory.
+            err = true;
+            break;
+        }
+    }
 
-                    // Empty name indicates a PANIC if the locking failed.
-                    if(!cur->name)
-                    {
-                        // Reset cur to NULL will generate a PANIC further down.
-                        if(!err)
-                        {
-                            cur = NULL;
-                        }
+    closedir(dir);
 
-                        // Always bail out.
-                        break;
-                    }
-                }
+    #if defined(AMIGA) && !defined(LG_TEST)
+    if(fib)
+    {
+        FreeDosObject(DOS_FIB, fib);
+    }
 
-                // Get next entry.
-                ent = readdir(dir);
+    free(mat);
+    #else
+    mt_free(mat);
+    #endif
 
-                // Need to check for cur->name or else the the filtering of '.'
-                // and '..' would not work, we would get entries without names.
-                if(ent && cur->name)
-                {
-                    cur->next = DBG_ALLOC(calloc(1, sizeof(struct pnode_t)));
-                    cur = cur->next;
-                }
-            }
+    #if defined(AMIGA) || defined(__MINGW32__)
+    free(pre);
+    #endif
 
-            #if defined(AMIGA) && !defined(LG_TEST)
-            // If dir is empty, fib will be NULL.
-            if(fib)
-            {
-                FreeDosObject(DOS_FIB, fib);
-            }
-            #endif
+    // Find the variables once, they're set for every entry. Keep the symbols
+    // rather than their values, the body might replace the values.
+    entry_t ref = { .type = SYMREF, .parent = contxt, .name = "@each-name" };
+    entry_p nsm = find_symbol(&ref);
+    ref.name = "@each-type";
+    entry_p tsm = find_symbol(&ref);
 
-            if(!cur && PANIC(contxt))
+    for(size_t cur = 0; !err && cur < pln.num && NOT_ERR; cur++)
+    {
+        if(nsm && nsm->type == SYMBOL && nsm->resolved &&
+           nsm->resolved->type == STRING)
+        {
+            char *cpy = DBG_ALLOC(strdup(pl_src(&pln, cur)));
+
+            if(!cpy)
             {
+                // Out of memory.
                 err = true;
+                break;
             }
 
-            // Go back where we started.
-            chdir(cwd);
+            free(nsm->resolved->name);
+            nsm->resolved->name = cpy;
         }
 
-        // Done.
-        closedir(dir);
-    }
-
-    if(err)
-    {
-        // We could end up here for a number of reasons. More details perhaps?
-        ERR(ERR_READ_DIR, dname);
-    }
-
-    // Iterate over the entire list of files / dirs and free entries one by one.
-    // If the pattern matches the current entry, set variables and execute what
-    // we have in argument 3.
-    while(top)
-    {
-        bool skip = err;
-        pnode_p old = top;
-
-        // 'Export' name and type info if we have a name.
-        if(top->name)
+        if(tsm && tsm->type == SYMBOL && tsm->resolved &&
+           tsm->resolved->type == NUMBER)
         {
-            #if defined(AMIGA) && !defined(LG_TEST)
-            if(!err)
-            {
-                // Use global buffer.
-                char *buf = buf_raw();
-
-                // Parse pattern.
-                switch(ParsePatternNoCase(pt, buf, buf_len()))
-                {
-                    // If we have any wildcards, try to match.
-                    case 1:
-                        skip = !MatchPatternNoCase(buf, top->name);
-                        break;
-
-                    // If no wildcards, do a simple string comparsion.
-                    case 0:
-                        skip = strcmp(top->name, pt);
-                        break;
-
-                    // Could not parse pattern.
-                    default:
-                        err = true;
-                }
-            }
-            #endif
+            tsm->resolved->id = pln.ent[cur].type;
+        }
 
-            // We always export, for memory management reasons.
-            set_num(contxt, "@each-type", (int32_t) top->type);
-            set_str(contxt, "@each-name", top->name);
+        // Execute the code contained in the third argument.
+        invoke(C_ARG(3));
+    }
 
-            if(!skip)
-            {
-                // Execute the code contained in the third argument.
-                invoke(C_ARG(3));
-            }
-        }
+    pl_free(&pln);
 
-        // Free current entry and proceed with the next.
-        top = top->next;
-        free(old);
+    if(err && NOT_ERR)
+    {
+        // Out of memory.
+        PANIC(contxt);
     }
 
-    // Success or failure.
-    R_NUM(err ? LG_FALSE : LG_TRUE);
+    // Success or failure, nothing done if the pattern is invalid.
+    R_NUM(bad || DID_ERR ? LG_FALSE : LG_TRUE);
 }
 
 //------------------------------------------------------------------------------
@@ -2737,6 +5949,9 @@ entry_p n_makeassign(entry_p contxt)
         h_log(contxt, res ? tr(S_ADEL) : tr(S_ADLE), asn);
     }
 
+    // Paths using the assign might not be what they were.
+    mc_clear();
+
     // Clang scan-build dead code true positive.
     if(!res)
     {
@@ -2962,27 +6177,425 @@ entry_p n_protect(entry_p contxt)
 
     size_t args = 0;
 
-    // Get number of arguments leading up to the first option.
-    while(exists(C_ARG(args + 1)) && C_ARG(args + 1)->type != OPTION)
+    // Get number of arguments leading up to the first option.
+    while(exists(C_ARG(args + 1)) && C_ARG(args + 1)->type != OPTION)
+    {
+        args++;
+    }
+
+    // File name only. Get file permissions.
+    if(args == 1)
+    {
+        R_NUM(h_protect_arg_get(contxt));
+    }
+
+    // File name and permission mask / delta. Set file permissions.
+    if(args == 2)
+    {
+        R_NUM(h_protect_arg_set(contxt));
+    }
+
+    // Broken parser.
+    PANIC(contxt);
+    return end();
+}
+
+// Edit of a boot script made by (startup). The markers and the command are
+// kept, not the name of the application, and the line of the (startup) for
+// error messages. Refer to h_startup_write.
+struct sedit_t
+{
+    struct sedit_t *next;
+    int32_t line;
+    char *file;
+    char *beg;
+    char *end;
+    char *cmd;
+    bool done;
+};
+
+// Edits not written yet, in the order they were made.
+static struct sedit_t *ste;
+
+// Growing buffer used when reading boot scripts.
+struct stext_t
+{
+    char *buf;
+    size_t len;
+    size_t cap;
+};
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_cat
+// Description: Append to buffer.
+// Input:       struct stext_t *txt:    Buffer.
+//              const char *str:        Data.
+//              size_t len:             Length of data.
+// Return:      bool:                   'true' on success, 'false' if out of
+//                                      memory.
+//------------------------------------------------------------------------------
+static bool h_startup_cat(struct stext_t *txt, const char *str, size_t len)
+{
+    if(txt->len + len + 1 > txt->cap)
+    {
+        size_t cap = (txt->len + len + 1) << 1;
+        char *buf = DBG_ALLOC(realloc(txt->buf, cap));
+
+        if(!buf)
+        {
+            // Out of memory.
+            return false;
+        }
+
+        txt->buf = buf;
+        txt->cap = cap;
+    }
+
+    memcpy(txt->buf + txt->len, str, len);
+    txt->len += len;
+    txt->buf[txt->len] = '\0';
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_line
+// Description: Read line from boot script, including the line feed, if any.
+// Input:       FILE *file:             Boot script.
+//              struct stext_t *lin:    Line.
+// Return:      int:                    1 if we got a line, 0 at the end of
+//                                      the file and -1 on errors.
+//------------------------------------------------------------------------------
+static int h_startup_line(FILE *file, struct stext_t *lin)
+{
+    char chk[256];
+    lin->len = 0;
+
+    while(fgets(chk, sizeof(chk), file))
+    {
+        size_t len = strlen(chk);
+
+        if(!h_startup_cat(lin, chk, len))
+        {
+            // Out of memory.
+            return -1;
+        }
+
+        if(len && chk[len - 1] == '\n')
+        {
+            // Complete line.
+            return 1;
+        }
+    }
+
+    return ferror(file) ? -1 : lin->len ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_sect
+// Description: Write section, from the start marker up to the end marker.
+// Input:       FILE *file:             Boot script.
+//              struct sedit_t *edt:    Edit.
+// Return:      bool:                   'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_startup_sect(FILE *file, struct sedit_t *edt)
+{
+    // Surrounding line feeds so that the command won't end up being a comment.
+    edt->done = true;
+    return fputc('\n', file) != EOF && fputs(edt->cmd, file) != EOF &&
+           fputc('\n', file) != EOF;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_find
+// Description: Find the start marker of a section that we're about to change.
+//              Pick the first one on the line, and the longest one if there
+//              are several at the same position.
+// Input:       const char *fln:        Boot script.
+//              const char *lin:        Line.
+//              const char **pos:       Start marker position.
+// Return:      struct sedit_t *:       Edit or NULL if nothing found.
+//------------------------------------------------------------------------------
+static struct sedit_t *h_startup_find(const char *fln, const char *lin,
+                                      const char **pos)
+{
+    struct sedit_t *edt = NULL;
+
+    // Quick test before looking for every marker.
+    if(!strstr(lin, ";BEGIN "))
+    {
+        return NULL;
+    }
+
+    for(struct sedit_t *cur = ste; cur; cur = cur->next)
+    {
+        const char *beg = cur->done || strcmp(cur->file, fln) ? NULL :
+                          strstr(lin, cur->beg);
+
+        if(beg && (!edt || beg < *pos || (beg == *pos &&
+           strlen(cur->beg) > strlen(edt->beg))))
+        {
+            edt = cur;
+            *pos = beg;
+        }
+    }
+
+    return edt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_edit
+// Description: Apply all edits of a boot script in one pass, line by line.
+//              The first section of each application is replaced, from the
+//              start marker up to the end marker. Applications without a
+//              section get a new one at the end of the file.
+// Input:       const char *fln:    Boot script.
+//              FILE *inp:          Current boot script, NULL if none.
+//              FILE *out:          New boot script.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_startup_edit(const char *fln, FILE *inp, FILE *out)
+{
+    // Section being replaced and what we have read of it.
+    struct stext_t lin = { NULL, 0, 0 }, hld = { NULL, 0, 0 };
+    struct sedit_t *cur = NULL;
+    size_t cut = 0;
+    bool done = true;
+    int res = 0;
+
+    while(done && inp && (res = h_startup_line(inp, &lin)) > 0)
+    {
+        const char *fin, *beg = NULL;
+
+        if(cur)
+        {
+            // Within a section, keep it until we know that it ends.
+            fin = strstr(lin.buf, cur->end);
+            done = fin || h_startup_cat(&hld, lin.buf, lin.len);
+        }
+        else if((cur = h_startup_find(fln, lin.buf, &beg)) != NULL)
+        {
+            // Start of section. The end might be on the same line.
+            cut = (size_t) (beg - lin.buf) + strlen(cur->beg);
+            fin = strstr(lin.buf + cut, cur->end);
+            hld.len = 0;
+            done = h_startup_cat(&hld, lin.buf, lin.len);
+        }
+        else
+        {
+            // Not ours.
+            done = fputs(lin.buf, out) != EOF;
+            continue;
+        }
+
+        if(fin && done)
+        {
+            // Start marker, command and whatever follows the end marker.
+            done = fwrite(hld.buf, 1, cut, out) == cut &&
+                   h_startup_sect(out, cur) && fputs(fin, out) != EOF;
+            cur = NULL;
+        }
+    }
+
+    // No end marker. Leave the section alone and add a new one below.
+    if(cur && done)
+    {
+        done = fwrite(hld.buf, 1, hld.len, out) == hld.len;
+    }
+
+    for(cur = ste; cur && done; cur = cur->next)
+    {
+        if(!cur->done && !strcmp(cur->file, fln))
+        {
+            done = fputs(cur->beg, out) != EOF && h_startup_sect(out, cur) &&
+                   fputs(cur->end, out) != EOF && fputc('\n', out) != EOF;
+        }
+    }
+
+    free(lin.buf);
+    free(hld.buf);
+    return done && res >= 0;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_write
+// Description: Write all edits of a boot script. Use a temporary file to make
+//              sure that we don't mess up the current file if disk space
+//              becomes a problem, the system crashes, the power is lost and so
+//              on and so forth.
+// Input:       entry_p contxt:         The execution context.
+//              struct sedit_t *edt:    The first edit of the boot script.
+// Return:      bool:                   'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_startup_write(entry_p contxt, struct sedit_t *edt)
+{
+    const char *fln = edt->file;
+    FILE *inp = h_fopen(contxt, fln, "r", false);
+
+    // The (startup) might be gone by now, refer to the line where it was.
+    if(!inp && h_exists(fln) != LG_NONE)
+    {
+        // There's something there that we can't read.
+        error(contxt, edt->line, ERR_READ_FILE, fln);
+        return false;
+    }
+
+    size_t tln = strlen(fln) + sizeof(".XXXXXX");
+    char *tmp = DBG_ALLOC(calloc(tln, 1));
+
+    if(!tmp)
+    {
+        h_fclose(&inp);
+        PANIC(contxt);
+        return false;
+    }
+
+    // Create temporary file next to the boot script.
+    snprintf(tmp, tln, "%s.XXXXXX", fln);
+    int fd = mkstemp(tmp);
+    FILE *out = fd < 0 ? NULL : fdopen(fd, "w");
+
+    if(!out && fd >= 0)
+    {
+        close(fd);
+    }
+
+    // Write everything to the temporary file in one pass.
+    bool done = out && h_startup_edit(fln, inp, out);
+    done = (!out || !fclose(out)) && done;
+    h_fclose(&inp);
+
+    // Open the target file just to make sure that we have write permissions.
+    FILE *chk = done ? h_fopen(contxt, fln, "a", false) : NULL;
+    done = chk && done;
+    h_fclose(&chk);
+
+    // Do a less un-atomic write to the real file by renaming the temporary
+    // file.
+    done = done && !rename(tmp, fln);
+    mc_drop(fln);
+
+    if(!done)
+    {
+        // The old file is still intact.
+        if(fd >= 0)
+        {
+            remove(tmp);
+        }
+
+        error(contxt, edt->line, ERR_WRITE_FILE, fln);
+    }
+
+    free(tmp);
+    return done;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_free
+// Description: Free edit.
+// Input:       struct sedit_t *edt:    Edit.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_startup_free(struct sedit_t *edt)
+{
+    free(edt->file);
+    free(edt->beg);
+    free(edt->end);
+    free(edt->cmd);
+    free(edt);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_add
+// Description: Add edit to the edits not written yet. A later edit of the same
+//              section replaces an earlier one.
+// Input:       entry_p contxt:     The execution context.
+//              const char *app:    Application name.
+//              char *cmd:          Command(s), owned by the edit from now on.
+// Return:      bool:               'true' on success, 'false' if out of memory.
+//------------------------------------------------------------------------------
+static bool h_startup_add(entry_p contxt, const char *app, char *cmd)
+{
+    const char *fln = get_str(contxt, "@user-startup");
+    size_t len = strlen(app) + sizeof(";BEGIN ");
+    struct sedit_t *edt = DBG_ALLOC(calloc(1, sizeof(struct sedit_t)));
+
+    if(!edt)
+    {
+        // Out of memory.
+        free(cmd);
+        return false;
+    }
+
+    edt->cmd = cmd;
+    edt->line = contxt->id;
+    edt->file = DBG_ALLOC(strdup(fln));
+    edt->beg = DBG_ALLOC(calloc(len, 1));
+    edt->end = DBG_ALLOC(calloc(len, 1));
+
+    if(!edt->file || !edt->beg || !edt->end)
+    {
+        // Out of memory.
+        h_startup_free(edt);
+        return false;
+    }
+
+    snprintf(edt->beg, len, ";BEGIN %s", app);
+    snprintf(edt->end, len, ";END %s", app);
+
+    struct sedit_t **cur = &ste;
+
+    for(; *cur; cur = &(*cur)->next)
+    {
+        if(!strcmp((*cur)->file, fln) && !strcmp((*cur)->beg, edt->beg))
+        {
+            // Replace, but keep the order.
+            edt->next = (*cur)->next;
+            h_startup_free(*cur);
+            break;
+        }
+    }
+
+    *cur = edt;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_startup_flush
+// Description: Write all edits made by (startup) not written yet, one boot
+//              script at a time. Used by (startup), and at teardown when
+//              @startup-batch is set.
+// Input:       entry_p contxt:     The execution context.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+bool h_startup_flush(entry_p contxt)
+{
+    bool done = true;
+
+    while(ste)
     {
-        args++;
-    }
+        struct sedit_t *fst = ste;
+        done = h_startup_write(contxt, fst) && done;
 
-    // File name only. Get file permissions.
-    if(args == 1)
-    {
-        R_NUM(h_protect_arg_get(contxt));
-    }
+        // Forget about the edits of this file, written or not.
+        for(struct sedit_t **cur = &fst->next; *cur;)
+        {
+            struct sedit_t *edt = *cur;
 
-    // File name and permission mask / delta. Set file permissions.
-    if(args == 2)
-    {
-        R_NUM(h_protect_arg_set(contxt));
+            if(strcmp(edt->file, fst->file))
+            {
+                cur = &edt->next;
+                continue;
+            }
+
+            *cur = edt->next;
+            h_startup_free(edt);
+        }
+
+        ste = fst->next;
+        h_startup_free(fst);
     }
 
-    // Broken parser.
-    PANIC(contxt);
-    return end();
+    return done;
 }
 
 //------------------------------------------------------------------------------
@@ -3002,9 +6615,6 @@ entry_p n_startup(entry_p contxt)
             help     = opt(contxt, OPT_HELP),
             prompt   = opt(contxt, OPT_PROMPT);
 
-    // Expect failure.
-    D_NUM = LG_FALSE;
-
     // We need a command and somewhere to put it.
     if((!*app && ERR(ERR_INVALID_APP, app)) ||
        (!command && ERR(ERR_MISSING_OPTION, "command")))
@@ -3035,218 +6645,30 @@ entry_p n_startup(entry_p contxt)
         R_NUM(LG_FALSE);
     }
 
-    const char *fln = get_str(contxt, "@user-startup");
-    const size_t len = strlen(";BEGIN ") + strlen(app);
-    size_t ins = strlen(cmd);
-
     // The CBM installer chomps one (and only one) line feed if it exists.
-    ins += (ins == 0 || cmd[ins - 1] != '\n') ? 2 : 1;
-
-    char *pre = DBG_ALLOC(calloc(len + 1, 1)),
-         *pst = DBG_ALLOC(calloc(len + 1, 1)), *buf = NULL;
-
-    if(pre && pst)
-    {
-        // We don't need to write yet.
-        FILE *file = h_fopen(contxt, fln, "r", false);
-
-        // If the file doesn't exist, try to create it.
-        if(!file && h_exists(fln) == LG_NONE)
-        {
-            file = h_fopen(contxt, fln, "w", false);
-
-            // If successful, close and reopen as read only.
-            if(file)
-            {
-                h_fclose(&file);
-                file = h_fopen(contxt, fln, "r", false);
-            }
-        }
-
-        if(file)
-        {
-            // Seek to the end so that we can use ftell below to get the size of
-            // the file.
-            if(!fseek(file, 0L, SEEK_END))
-            {
-                // Worst case: empty file + 3 NL + terminating 0 + BEGIN and END
-                // markers + command.
-                size_t osz = (size_t) ftell(file),
-                       nsz = osz + 2 * len + ins;
-
-                // Allocate enough memory so that we can keep the old file + any
-                // changes that we need to do in memory at the same time.
-                buf = DBG_ALLOC(calloc(nsz, 1));
-
-                if(buf)
-                {
-                    // Read the whole file in one go.
-                    if(!fseek(file, 0L, SEEK_SET) &&
-                        fread(buf, 1, osz, file) == osz)
-                    {
-                        // Prepare the header and footer.
-                        snprintf(pre, len + 1, ";BEGIN %s", app);
-                        snprintf(pst, len + 1, ";END %s", app);
-
-                        // Do we already have an entry in the current file?
-                        char *beg = strstr(buf, pre), *fin = strstr(buf, pst);
-
-                        // Replace the current entry by inserting the new one at
-                        // the same location.
-                        if(beg && fin)
-                        {
-                            // Move the tail of the buffer to the right place.
-                            memmove(beg + len + ins, fin, (buf + osz) - fin + 1);
-
-                            // Insert the command string.
-                            memcpy(beg + len + 1, cmd, ins - 2);
-
-                            // Add surrounding line feeds so that the command
-                            // won't end up being a comment.
-                            beg[len + ins - 1] = beg[len] = '\n';
-                        }
-                        // No existing entry. Append the new entry.
-                        else
-                        {
-                            // Header.
-                            memcpy(buf + osz, pre, len);
-
-                            // Command.
-                            memcpy(buf + osz + len + 1, cmd, ins - 2);
-
-                            // Footer.
-                            memcpy(buf + osz + len + ins, pst, len);
-
-                            // Add surrounding line feeds so that the command
-                            // won't end up being a comment.
-                            buf[osz + len + ins - 1] = buf[osz + len] = '\n';
-
-                            // Add a newline at the end.
-                            buf[osz + len + ins + strlen(pst)] = '\n';
-                        }
-                    }
-                    else
-                    {
-                        // Read problem, error will be set further down if
-                        // buf == NULL.
-                        free(buf);
-                        buf = NULL;
-                    }
-                }
-                else
-                {
-                    PANIC(contxt);
-                }
-            }
+    size_t len = strlen(cmd);
 
-            // Reading done.
-            h_fclose(&file);
-        }
-    }
-    else
+    if(len && cmd[len - 1] == '\n')
     {
-        PANIC(contxt);
+        cmd[len - 1] = '\0';
     }
 
-    // We have no longer any use for the header, footer or command string.
-    free(pre);
-    free(pst);
-    free(cmd);
-
-    // If we have a buffer everything wen't fine above. Go ahead and write
-    // buffer to file.
-    if(buf)
-    {
-        // Use a temporary file to make sure that we don't mess up the current
-        // file if disk space becomes a problem, the system crashes, the power
-        // is lost and so on and so forth.
-        size_t tln = strlen(fln) + sizeof(".XXXXXX\0");
-        char *tmp = DBG_ALLOC(calloc(tln, 1));
-
-        if(tmp)
-        {
-            // Create temporary file.
-            snprintf(tmp, tln, "%s.XXXXXX", fln);
-            FILE *file = fdopen(mkstemp(tmp), "w+");
-
-            if(file)
-            {
-                // Write everything to the temporary file at once.
-                if(fputs(buf, file) == EOF)
-                {
-                    // Could not write to disk. The old file is still intact.
-                    h_fclose(&file);
-                }
-                else
-                {
-                    // Close file and release buffer.
-                    h_fclose(&file);
-                    free(buf);
-                    buf = NULL;
-
-                    // Open the target file just to make sure that we have
-                    // write permissions.
-                    file = h_fopen(contxt, fln, "a", false);
-
-                    if(file)
-                    {
-                        // Close it immediately, we're not going to write
-                        // directly to it.
-                        h_fclose(&file);
-
-                        // Do a less un-atomic write to the real file by
-                        // renaming the temporary file.
-                        if(!rename(tmp, fln))
-                        {
-                            // We're done.
-                            free(tmp);
-                            tmp = NULL;
-                            D_NUM = LG_TRUE;
-                        }
-                    }
-                    else
-                    {
-                        // We aren't allowed to write data to the target
-                        // file so we need to clean up temp file.
-                        if(remove(tmp))
-                        {
-                            ERR(ERR_WRITE_FILE, tmp);
-                        }
-                    }
-                }
-            }
-
-            // If we haven't released tmp by now, we failed when attempting
-            // one of the write operations above.
-            if(tmp)
-            {
-                ERR(ERR_WRITE_FILE, fln);
-                free(tmp);
-            }
-        }
-        else
-        {
-            PANIC(contxt);
-        }
-
-        // We no longer need the buffer holding the new file contents.
-        free(buf);
-    }
-    else
+    if(!h_startup_add(contxt, app, cmd) && PANIC(contxt))
     {
-        // No buffer == read problem, or out of memory but then we already
-        // have a PANIC.
-        ERR(ERR_READ_FILE, fln);
+        R_NUM(LG_FALSE);
     }
 
-    // Success, failure or out of memory.
-    R_CUR;
+    // Write now, along with earlier edits, unless we're told to wait.
+    R_NUM(get_num(contxt, "@startup-batch") || h_startup_flush(contxt) ?
+          LG_TRUE : LG_FALSE);
 }
 
 //------------------------------------------------------------------------------
 // Name:        h_copy_simple
 // Description: Copy source file to destination file using already open file
-//              handles.
+//              handles. Where h_copyfile_range() is available the kernel does
+//              the copying, if not, a private buffer is used. The shared one
+//              (B_KEY) is left alone so that other I/O can run meanwhile.
 // Input:       entry_p contxt:     The execution context.
 //              FILE *src:          Source file handle.
 //              FILE *dst:          Destination file handle.
@@ -3255,19 +6677,49 @@ entry_p n_startup(entry_p contxt)
 //------------------------------------------------------------------------------
 static void h_copy_simple(entry_p contxt, FILE *src, FILE *dst, const char *nfo)
 {
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // Nothing has been read or written using these handles.
+    int fsrc = fileno(src), fdst = fileno(dst), how = 0;
+    char *mem = NULL;
+    off_t off = 0;
+    ssize_t res;
+
+    // Copy source file to destination in COPY_CHUNK sized chunks.
+    while((res = h_copyfile_range(fsrc, fdst, off, COPY_CHUNK, &how, &mem,
+                                  COPY_CHUNK)) > 0)
+    {
+        off += res;
+    }
+
+    if(res < 0)
+    {
+        ERR(ERR_WRITE_FILE, nfo);
+    }
+
+    free(mem);
+    #else
+    size_t len = buf_len();
+    char *mem = DBG_ALLOC(malloc(len));
+
+    if(!mem && PANIC(contxt))
+    {
+        // Out of memory.
+        return;
+    }
+
     // Copy source file to destination in buf_len() sized chunks.
-    for(size_t cnt = fread(buf_get(B_KEY), 1, buf_len(), src); cnt;
-        cnt = fread(buf_get(B_KEY), 1, buf_len(), src))
+    for(size_t cnt = fread(mem, 1, len, src); cnt;
+        cnt = fread(mem, 1, len, src))
     {
-        if(fwrite(buf_get(B_KEY), 1, cnt, dst) != cnt)
+        if(fwrite(mem, 1, cnt, dst) != cnt)
         {
             ERR(ERR_WRITE_FILE, nfo);
             break;
         }
     }
 
-    // Unlock buffer.
-    buf_put(B_KEY);
+    free(mem);
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -3285,6 +6737,26 @@ void h_fclose(FILE **file)
     }
 }
 
+//------------------------------------------------------------------------------
+// Name:        h_fopen_mode
+// Description: Used by h_fopen to open file. Anything but reading might change
+//              the file.
+// Input:       const char *name:   File name.
+//              const char *mode:   See fopen.
+// Return:      FILE *:             See fopen.
+//------------------------------------------------------------------------------
+static FILE *h_fopen_mode(const char *name, const char *mode)
+{
+    FILE *file = fopen(name, mode);
+
+    if(*mode != 'r' || strchr(mode, '+'))
+    {
+        mc_drop(name);
+    }
+
+    return file;
+}
+
 //------------------------------------------------------------------------------
 // Name:        h_fopen
 // Description: Open file after checking permissions. If necessary, permissions
@@ -3306,7 +6778,7 @@ FILE *h_fopen(entry_p contxt, const char *name, const char *mode, bool force)
     if(h_exists(name) == LG_NONE)
     {
         // Create file if it doesn't exist.
-        return fopen(name, mode);
+        return h_fopen_mode(name, mode);
     }
 
     int32_t prm = 0;
@@ -3328,39 +6800,189 @@ FILE *h_fopen(entry_p contxt, const char *name, const char *mode, bool force)
     if(perm || (force && !get_num(contxt, "@strict") &&
        h_protect_set(contxt, name, prm)))
     {
-        return fopen(name, mode);
+        return h_fopen_mode(name, mode);
     }
 
     // Couldn't set file permissions.
     return NULL;
 }
 
+// Suffix of files written by (textfile), refer to h_textfile_append.
+#define TEXTFILE_PART ".lgpart"
+
+//------------------------------------------------------------------------------
+// Name:        h_textfile_open
+// Description: Open the file that (append) writes to. Without (include), the
+//              destination is written under another name first, but it's
+//              checked as if it was to be written directly.
+// Input:       entry_p contxt:     The execution context.
+//              const char *name:   Output file name.
+//              const char *tmp:    Temporary file name, or NULL.
+// Return:      FILE *:             File handle on success, NULL otherwise.
+//------------------------------------------------------------------------------
+static FILE *h_textfile_open(entry_p contxt, const char *name, const char *tmp)
+{
+    if(!tmp)
+    {
+        // Append to what (include) has written.
+        return h_fopen(contxt, name, "a", true);
+    }
+
+    if(h_exists(name) != LG_NONE)
+    {
+        // Same permission checks as when writing, without truncating.
+        FILE *file = h_fopen(contxt, name, "a", true);
+
+        if(!file)
+        {
+            return NULL;
+        }
+
+        h_fclose(&file);
+    }
+
+    return h_fopen(contxt, tmp, "w", true);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_textfile_commit
+// Description: Give the file written by (append) its real name, or throw it
+//              away if something went wrong.
+// Input:       entry_p contxt:     The execution context.
+//              const char *name:   Output file name.
+//              const char *tmp:    Temporary file name, or NULL.
+//              bool done:          Replace 'name' with 'tmp'.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_textfile_commit(entry_p contxt, const char *name,
+                              const char *tmp, bool done)
+{
+    if(!tmp)
+    {
+        // Written in place.
+        return true;
+    }
+
+    // Keep the permissions of the file we're replacing.
+    #if defined(AMIGA)
+    int32_t prm = 0;
+
+    if(done && h_exists(name) == LG_FILE && h_protect_get(contxt, name, &prm))
+    {
+        h_protect_set(contxt, tmp, prm);
+    }
+    #else
+    struct meta_t met;
+    mc_get(name, &met);
+    (void) contxt;
+
+    if(done && met.type == LG_FILE)
+    {
+        chmod(tmp, (mode_t) (met.mode & 07777));
+    }
+    #endif
+
+    // Not all systems replace existing files.
+    done = done && (!rename(tmp, name) || (!remove(name) &&
+                    !rename(tmp, name)));
+
+    if(!done)
+    {
+        remove(tmp);
+    }
+
+    mc_drop(tmp);
+    mc_drop(name);
+    return done;
+}
+
 //------------------------------------------------------------------------------
 // Name:        h_textfile_append
-// Description: Append h_textfile helper.
+// Description: Append h_textfile helper. Strings are written as they are
+//              evaluated. Without (include), they go to a temporary file that
+//              replaces the destination when all of them have been written,
+//              an error halfway through leaves the destination as it was.
 // Input:       entry_p contxt:     The execution context.
 //              const char *name:   Output file name.
 // Return:      int32_t:            LG_TRUE or LG_FALSE.
 //------------------------------------------------------------------------------
 static int32_t h_textfile_append(entry_p contxt, const char *name)
 {
-    // Gather and merge all (append) strings.
-    char *app = get_optstr(contxt, OPT_APPEND);
+    // Append without include truncates / creates a new file.
+    char *tmp = NULL;
 
-    if(DID_ERR || (!app && PANIC(contxt)))
+    if(!opt(contxt, OPT_INCLUDE))
     {
-        free(app);
-        return LG_FALSE;
+        tmp = DBG_ALLOC(calloc(strlen(name) + sizeof(TEXTFILE_PART), 1));
+
+        if(!tmp)
+        {
+            // Out of memory.
+            PANIC(contxt);
+            return LG_FALSE;
+        }
+
+        snprintf(tmp, strlen(name) + sizeof(TEXTFILE_PART), "%s%s", name,
+                 TEXTFILE_PART);
     }
 
-    // Append without include truncates / creates a new file.
-    const char *mode = opt(contxt, OPT_INCLUDE) ? "a" : "w";
+    FILE *file = NULL;
+    bool bad = false, err = false;
+
+    // Write the strings of all (append) options, one at a time, as they are
+    // evaluated instead of merging them first.
+    for(entry_p *chl = contxt->children; exists(*chl) && !bad && !err; chl++)
+    {
+        if((*chl)->type != OPTION || (*chl)->id != OPT_APPEND)
+        {
+            continue;
+        }
+
+        for(entry_p *cur = (*chl)->children; cur && exists(*cur); cur++)
+        {
+            if((*cur)->type == CONTXT)
+            {
+                continue;
+            }
+
+            const char *app = str(*cur);
+
+            if(DID_ERR)
+            {
+                // Leave the destination as it is.
+                err = true;
+                break;
+            }
+
+            // Open the file when there's something to write.
+            if(!file && !(file = h_textfile_open(contxt, name, tmp)))
+            {
+                bad = true;
+                break;
+            }
+
+            // Write to log if logging is enabled.
+            h_log(contxt, tr(S_APND), app, name);
 
-    FILE *file = h_fopen(contxt, name, mode, true);
+            // Get length of string to append.
+            size_t len = strlen(app);
+
+            // Append to file if string is non-empty.
+            if(len && fwrite(app, 1, len, file) != len)
+            {
+                // Couldn't write to file.
+                ERR(ERR_WRITE_FILE, name);
+                err = true;
+                break;
+            }
+        }
+    }
 
-    if(!file)
+    // Empty (append) options still truncate / create the file.
+    if(!err && !file && (bad || !(file = h_textfile_open(contxt, name, tmp))))
     {
-        free(app);
+        h_textfile_commit(contxt, name, tmp, false);
+        free(tmp);
 
         if(get_num(contxt, "@strict"))
         {
@@ -3373,21 +6995,20 @@ static int32_t h_textfile_append(entry_p contxt, const char *name)
         return LG_TRUE;
     }
 
-    // Write to log if logging is enabled.
-    h_log(contxt, tr(S_APND), app, file);
-
-    // Get length of string to append.
-    size_t len = strlen(app);
+    // Data that didn't make it to the file is an error as well.
+    if(file && fclose(file) && !err)
+    {
+        ERR(ERR_WRITE_FILE, name);
+        err = true;
+    }
 
-    // Append to file if string is non-empty.
-    if(len && fwrite(app, 1, len, file) != len)
+    if(!h_textfile_commit(contxt, name, tmp, !err) && !err)
     {
-        // Couldn't write to file.
+        // Couldn't replace the destination.
         ERR(ERR_WRITE_FILE, name);
     }
 
-    free(app);
-    h_fclose(&file);
+    free(tmp);
 
     // Success or failure.
     return NOT_ERR ? LG_TRUE : LG_FALSE;
@@ -3746,6 +7367,8 @@ entry_p n_tooltype(entry_p contxt)
             if(PutDiskObject(file, obj))
             {
                 // Done.
+                snprintf(buf_get(B_KEY), buf_len(), "%s.info", file);
+                mc_drop(buf_put(B_KEY));
                 D_NUM = LG_TRUE;
             }
             // Don't fail in sloppy mode.
@@ -3858,6 +7481,8 @@ entry_p n_rename(entry_p contxt)
         // Rename if target doesn't exist.
         if(h_exists(new) == LG_NONE && !rename(old, new))
         {
+            // Directories take their contents with them.
+            mc_clear();
             h_log(contxt, tr(S_FRND), old, new);
             R_NUM(-1);
         }
@@ -3879,13 +7504,55 @@ entry_p n_rename(entry_p contxt)
     }
     #endif
     // Successfully relabeled volume.
+    mc_clear();
     h_log(contxt, tr(S_FRND), old, new);
     R_NUM(-1);
 }
 
+// Log file, kept open between messages, refer to h_log.
+static struct clog_t
+{
+    FILE *file;
+    char *name;
+    uint64_t last;
+} lgf;
+
+//------------------------------------------------------------------------------
+// Name:        h_log_flush
+// Description: Write what's buffered to the log file. Used on errors, refer to
+//              error(), before prompts, refer to IGWait(), and by h_log now
+//              and then.
+// Input:       -
+// Return:      bool:   'true' on success, 'false' on error.
+//------------------------------------------------------------------------------
+bool h_log_flush(void)
+{
+    return !lgf.file || !fflush(lgf.file);
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_log_close
+// Description: Flush and close the log file. Used when the log file is
+//              changed, and at teardown.
+// Input:       -
+// Return:      bool:   'true' on success, 'false' on error.
+//------------------------------------------------------------------------------
+bool h_log_close(void)
+{
+    bool ret = !lgf.file || !fclose(lgf.file);
+
+    free(lgf.name);
+    memset(&lgf, 0, sizeof(lgf));
+    return ret;
+}
+
 //------------------------------------------------------------------------------
 // Name:        h_log
-// Description: Write formatted message to log file.
+// Description: Write formatted message to log file. The log file is opened
+//              once and kept open. What's written is buffered. The interval,
+//              @log-flush milliseconds, is checked only when a message is
+//              written, so the log is also flushed after (copyfiles), before
+//              waiting for the user, on errors and at teardown.
 // Input:       entry_p contxt:     The execution context.
 //              const char *fmt:    Message format string.
 //              ...:                Format string varargs.
@@ -3906,29 +7573,59 @@ void h_log(entry_p contxt, const char *fmt, ...)
     }
 
     // Use the log file set in init(..) or by the user.
-    FILE *file = h_fopen(contxt, get_str(contxt, "@log-file"), "a", true);
+    const char *name = get_str(contxt, "@log-file");
+
+    if(lgf.file && strcmp(lgf.name, name))
+    {
+        // The user has picked another log file.
+        h_log_close();
+    }
+
+    if(!lgf.file)
+    {
+        lgf.file = h_fopen(contxt, name, "a", true);
+        lgf.name = lgf.file ? DBG_ALLOC(strdup(name)) : NULL;
+        lgf.last = h_copyfiles_clock();
+
+        if(lgf.file && !lgf.name && PANIC(contxt))
+        {
+            // Out of memory.
+            h_log_close();
+            return;
+        }
+    }
+
     int cnt = -1;
 
-    if(file)
+    if(lgf.file)
     {
         // Line number and function name as prefix.
-        cnt = fprintf(file, "[%d:%s] ", contxt->id, contxt->name);
+        cnt = fprintf(lgf.file, "[%d:%s] ", contxt->id, contxt->name);
 
         // Append formatted string.
         if(cnt > 0)
         {
             va_list arg;
             va_start(arg, fmt);
-            cnt = vfprintf(file, fmt, arg);
+            cnt = vfprintf(lgf.file, fmt, arg);
             va_end(arg);
         }
 
-        h_fclose(&file);
+        uint64_t now = h_copyfiles_clock();
+        int32_t ivl = get_num(contxt, "@log-flush");
+
+        // Flush now and then, never if the interval is negative.
+        if(cnt >= 0 && ivl >= 0 && now - lgf.last >= (uint64_t) ivl)
+        {
+            cnt = h_log_flush() ? cnt : -1;
+            lgf.last = now;
+        }
     }
 
     // Could we open the file and write all data to it?
     if(cnt < 0)
     {
-        ERR(ERR_WRITE_FILE, get_str(contxt, "@log-file"));
+        h_log_close();
+        ERR(ERR_WRITE_FILE, name);
     }
 }
@@ -34,19 +34,9 @@ int32_t h_exists(const char *name);
 FILE *h_fopen(entry_p contxt, const char *name, const char *mode, bool force);
 void h_fclose(FILE **file);
 void h_log(entry_p contxt, const char *fmt, ...);
+bool h_log_flush(void);
+bool h_log_close(void);
+bool h_startup_flush(entry_p contxt);
 bool h_confirm(entry_p contxt, const char *hlp, const char *msg, ...);
 
-//------------------------------------------------------------------------------
-// Exchange (GUI) datatypes
-//------------------------------------------------------------------------------
-struct pnode_t
-{
-    struct pnode_t *next;
-    char *name;
-    char *copy;
-    int32_t type;
-};
-
-typedef struct pnode_t * pnode_p;
-
 #endif
@@ -8,6 +8,7 @@
 // Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
 //------------------------------------------------------------------------------
 
+#include "file.h"
 #include "gui.h"
 #include "version.h"
 #include "resource.h"
@@ -110,7 +111,10 @@ CLASS_DEF(IG)
     // Widgets.
     Object *ExpertLevel, *UserLevel, *Progress, *Complete, *Pretend, *Bottom,
            *String, *Number, *Empty, *Text, *List, *Log, *Top, *Ask, *Yes, *No,
-           *AbortYes, *Abort, *AbortOnly, *AbortRun;
+           *AbortYes, *Abort, *AbortOnly, *AbortRun, *Rate;
+
+    // Last copy rate shown.
+    uint64_t LastRate;
 
     // String buffer.
     char Buf[1 << 10];
@@ -148,6 +152,7 @@ CLASS_DEF(IG)
 #define MUIM_IG_GetCustomScreen     (TAGBASE_LG + 128)
 #define MUIM_IG_GetScreenProp       (TAGBASE_LG + 129)
 #define MUIM_IG_GetWindowProp       (TAGBASE_LG + 130)
+#define MUIM_IG_CopyFilesProgress   (TAGBASE_LG + 131)
 
 //------------------------------------------------------------------------------
 // IG - Attributes
@@ -234,6 +239,17 @@ struct MUIP_IG_CopyFilesAdd
     IPTR File;
 };
 
+//------------------------------------------------------------------------------
+// IG - CopyFilesProgress parameters
+//------------------------------------------------------------------------------
+struct MUIP_IG_CopyFilesProgress
+{
+    IPTR MethodID;
+    IPTR Progress;
+    IPTR NoGauge;
+    IPTR Back;
+};
+
 //------------------------------------------------------------------------------
 // IG - Run parameters
 //------------------------------------------------------------------------------
@@ -545,6 +561,13 @@ static IPTR IGWait(Object *obj, IPTR notif, IPTR range)
 {
     IPTR sig = 0, ret = 0, n;
 
+    // The user might be gone for a while, make sure that the log file is
+    // complete before we go to sleep.
+    if(notif != MUIV_IG_Tick)
+    {
+        h_log_flush();
+    }
+
     // Set cycle chain for all buttons within the notification range.
     for(n = 0; n < range; n++)
     {
@@ -1116,29 +1139,20 @@ MUIDSP IGCopyFilesStart(Class *cls, Object *obj,
 
     struct IGData *my = INST_DATA(cls, obj);
 
-    int n = 0;
-    pnode_p cur = (pnode_p) msg->List, lst = cur;
+    plan_p lst = (plan_p) msg->List;
+    int n = (int) pl_files(lst);
+    struct pitr_t cur;
 
-    // For all files and directories to be copied; count the files, and if
-    // confirmation is needed, add them to the selection / deselection list.
-    while(cur)
+    // If confirmation is needed, add all files to be copied to the selection
+    // / deselection list.
+    for(pl_start(&cur, lst); msg->Confirm && pl_next(&cur);)
     {
         // Is this a file?
-        if(cur->type == 1)
+        if(*cur.type == 1)
         {
-            // Do we need confirmation?
-            if(msg->Confirm)
-            {
-                // Add file to the selection / deselection list.
-                DoMethod(Win, MUIM_IG_CopyFilesAdd, cur->name);
-            }
-
-            // Increase the total file count.
-            n++;
+            // Add file to the selection / deselection list.
+            DoMethod(Win, MUIM_IG_CopyFilesAdd, cur.name);
         }
-
-        // Next file / directory.
-        cur = cur->next;
     }
 
     if(msg->Confirm && n)
@@ -1188,14 +1202,14 @@ MUIDSP IGCopyFilesStart(Class *cls, Object *obj,
 
                         if(ent)
                         {
-                            // Find the corresponding file node in 'our' list.
-                            for(cur = lst; cur; cur = cur->next)
+                            // Find the corresponding file in 'our' plan.
+                            for(pl_start(&cur, lst); pl_next(&cur);)
                             {
                                 // If we find it, and it's a file, give it a
                                 // 'copy' tag.
-                                if(cur->type == 1 && !strcmp(ent, cur->name))
+                                if(*cur.type == 1 && !strcmp(ent, cur.name))
                                 {
-                                    cur->type = -1;
+                                    *cur.type = -1;
                                     break;
                                 }
                             }
@@ -1209,24 +1223,24 @@ MUIDSP IGCopyFilesStart(Class *cls, Object *obj,
                     }
                 }
 
-                // Iterate over nodes in 'our' list and tag everything that
+                // Iterate over files in 'our' plan and tag everything that
                 // we're NOT going to copy.
-                for(cur = lst; cur; cur = cur->next)
+                for(pl_start(&cur, lst); pl_next(&cur);)
                 {
                     // Is this a file that's not going to be copied?
-                    if(cur->type == 1)
+                    if(*cur.type == 1)
                     {
                         // Give it an 'ignore' tag and decrease the number of
                         // files to be copied.
-                        cur->type = 0;
+                        *cur.type = 0;
                         n--;
                     }
                     // Is this a file that's going to be copied?
-                    else if(cur->type == -1)
+                    else if(*cur.type == -1)
                     {
                         // Restore the file type so that the rest of the world
                         // understands that this is a file.
-                        cur->type = 1;
+                        *cur.type = 1;
                     }
                 }
             }
@@ -1245,9 +1259,13 @@ MUIDSP IGCopyFilesStart(Class *cls, Object *obj,
         // abort.
         DoMethod(_app(obj), MUIM_Application_AddInputHandler, &my->Ticker);
 
-        // Configure gauge so that one tick == one file.
-        SetAttrs(my->Progress, MUIA_Gauge_Max, n, MUIA_Gauge_Current, 0,
+        // Empty gauge, the size is set by IGCopyFilesProgress.
+        SetAttrs(my->Progress, MUIA_Gauge_Max, 1, MUIA_Gauge_Current, 0,
                  TAG_END);
+        set(my->Rate, MUIA_Text_Contents, "");
+
+        // No rate shown yet, the first sample is always a new one.
+        my->LastRate = UINT64_MAX;
 
         // Always true.
         return (IPTR) G_TRUE;
@@ -1305,23 +1323,8 @@ MUIDSP IGCopyFilesSetCur(Class *cls, Object *obj,
             file = my->Buf;
         }
 
-        // Update progress bar. Text and number.
-        if(!msg->NoGauge)
-        {
-            IPTR cur = 0;
-
-            // Get current progress.
-            get(my->Progress, MUIA_Gauge_Current, &cur);
-
-            // Add another file on top (one file = one tick).
-            SetAttrs(my->Progress, MUIA_Gauge_InfoText, file,
-                     MUIA_Gauge_Current, ++cur, TAG_END);
-        }
-        else
-        {
-            // Update text only, ignore the gauge.
-            set(my->Progress, MUIA_Gauge_InfoText, file);
-        }
+        // Update text only, the gauge is updated by IGCopyFilesProgress.
+        set(my->Progress, MUIA_Gauge_InfoText, file);
     }
     else
     {
@@ -1352,6 +1355,64 @@ MUIDSP IGCopyFilesSetCur(Class *cls, Object *obj,
     return (IPTR) G_TRUE;
 }
 
+//------------------------------------------------------------------------------
+// IGCopyFilesProgress - Show number of bytes copied, rate and time left
+// Input:                Progress - struct cprog_t
+//                       NoGauge - Hide file gauge
+//                       Back - Use 'Back' instead of 'Abort'.
+// Return:               G_TRUE / G_ABORT / G_EXIT / G_ERR.
+//------------------------------------------------------------------------------
+MUIDSP IGCopyFilesProgress(Class *cls, Object *obj,
+                           struct MUIP_IG_CopyFilesProgress *msg)
+{
+    struct IGData *my = INST_DATA(cls, obj);
+    const struct cprog_t *prg = (const struct cprog_t *) msg->Progress;
+
+    if(!msg->NoGauge)
+    {
+        uint64_t max = prg->max, cur = prg->cur;
+        IPTR gcur = 0, gmax = 0;
+
+        // The gauge is 16 bits wide, scale down until the size fits.
+        while(max > 0xffff)
+        {
+            max >>= 1;
+            cur >>= 1;
+        }
+
+        get(my->Progress, MUIA_Gauge_Current, &gcur);
+        get(my->Progress, MUIA_Gauge_Max, &gmax);
+
+        // Only redraw if something has changed, we get here once per block.
+        max = max ? max : 1;
+
+        if((IPTR) cur != gcur || (IPTR) max != gmax)
+        {
+            SetAttrs(my->Progress, MUIA_Gauge_Max, (IPTR) max,
+                     MUIA_Gauge_Current, (IPTR) cur, TAG_END);
+        }
+
+        // New sample?
+        if(prg->rat != my->LastRate)
+        {
+            // MB/s with one decimal.
+            uint64_t rat = prg->rat * 10 >> 20, avg = prg->avg * 10 >> 20;
+            int32_t eta = prg->eta < 0 ? 0 : prg->eta;
+
+            my->LastRate = prg->rat;
+            snprintf(my->Buf, sizeof(my->Buf), tr(S_CPRG),
+                     (unsigned long) (rat / 10), (unsigned long) (rat % 10),
+                     (unsigned long) (avg / 10), (unsigned long) (avg % 10),
+                     (long) (eta / 60), (long) (eta % 60));
+            set(my->Rate, MUIA_Text_Contents, my->Buf);
+        }
+    }
+
+    // Give the user a chance to abort.
+    return DoMethod(obj, MUIM_IG_CopyFilesSetCur, NULL, msg->NoGauge,
+                    msg->Back);
+}
+
 //------------------------------------------------------------------------------
 // IGCopyFilesEnd - End of file copy
 // Input:           -
@@ -2491,14 +2552,14 @@ MUIDSP IGNew(Class *cls, Object *obj, struct opSet *msg)
 {
     // Temp widgets.
     Object *el, *ul, *fp, *cm, *pr, *st, *nm, *bp, *em, *tx, *ls, *lg, *tp, *af,
-           *ys, *no, *ya, *ab, *ao, *ar;
+           *ys, *no, *ya, *ab, *ao, *ar, *rt;
 
     // Radio button strings.
     static const char *lev[4], *pre[3], *log[3];
 
     // Clear to enable check.
     el = ul = fp = cm = pr = st = nm = bp = em = tx = ls = lg = tp = af = ys =
-    no = ya = ab = ao = ar = NULL;
+    no = ya = ab = ao = ar = rt = NULL;
 
     // User level.
     lev[0] = tr(S_ULNV); // Novice
@@ -2601,6 +2662,11 @@ MUIDSP IGNew(Class *cls, Object *obj, struct opSet *msg)
                         MUIA_Gauge_Horiz, TRUE,
                         MUIA_Gauge_InfoText, "-",
                         TAG_END),
+                    MUIA_Group_Child, rt = (Object *) MUI_NewObject(
+                        MUIC_Text,
+                        MUIA_Text_Contents, "",
+                        MUIA_Text_PreParse, "\33c",
+                        TAG_END),
                     TAG_END),
                 /* Page 2 - P_FILEDEST */
                 MUIA_Group_Child, MUI_NewObject(
@@ -2841,12 +2907,13 @@ MUIDSP IGNew(Class *cls, Object *obj, struct opSet *msg)
 
         // Save widgets.
         if(el && ul && fp && cm && pr && st && nm && bp && em &&
-           tx && ls && lg && tp && af && ys && no && ab && ao && ar)
+           tx && ls && lg && tp && af && ys && no && ab && ao && ar && rt)
         {
             my->ExpertLevel = el;
             my->AbortOnly = ao;
             my->UserLevel = ul;
             my->Progress = fp;
+            my->Rate = rt;
             my->AbortRun = ar;
             my->AbortYes = ya;
             my->Complete = cm;
@@ -2977,6 +3044,9 @@ DISPATCH(IG)
         case MUIM_IG_CopyFilesSetCur:
             return IGCopyFilesSetCur(cls, obj, (struct MUIP_IG_CopyFilesSetCur *) msg);
 
+        case MUIM_IG_CopyFilesProgress:
+            return IGCopyFilesProgress(cls, obj, (struct MUIP_IG_CopyFilesProgress *) msg);
+
         case MUIM_IG_CopyFilesEnd:
             return IGCopyFilesEnd(cls, obj);
 
@@ -3454,12 +3524,12 @@ inp_t gui_askfile(const char *msg, const char *hlp, bool pth, bool dsk,
 //              list.
 // Input:       const char *msg:    Message to be shown.
 //              const char *hlp:    Help text.
-//              pnode_p lst:        List of files / directories.
+//              plan_p lst:         Files / directories, refer to plan.h.
 //              bool cnf:           Confirmation.
 //              bool bck:           Enable back mode.
 // Return:      inp_t: G_TRUE / G_FALSE / G_ABORT / G_ERR.
 //------------------------------------------------------------------------------
-inp_t gui_copyfiles_start(const char *msg, const char *hlp, pnode_p lst,
+inp_t gui_copyfiles_start(const char *msg, const char *hlp, plan_p lst,
                           bool cnf, bool bck)
 {
     #if defined(AMIGA) && !defined(LG_TEST)
@@ -3509,6 +3579,29 @@ inp_t gui_copyfiles_setcur(const char *cur, bool nga, bool bck)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// Name:        gui_copyfiles_progress
+// Description: Update progress gauge with the number of bytes copied, and show
+//              the rate and the time left.
+// Input:       const struct cprog_t *prg: Progress.
+//              bool nga: Hide gauge.
+//              bool bck: Enable back mode.
+// Return:      inp_t: G_TRUE / G_FALSE / G_ABORT / G_ERR.
+//------------------------------------------------------------------------------
+inp_t gui_copyfiles_progress(const struct cprog_t *prg, bool nga, bool bck)
+{
+    #if defined(AMIGA) && !defined(LG_TEST)
+    return (inp_t) DoMethod(Win, MUIM_IG_CopyFilesProgress, prg, nga, bck);
+    #else
+    // Testing purposes. Nothing is shown, rates and times depend on the host
+    // system.
+    (void) prg;
+    (void) nga;
+    (void) bck;
+    return G_TRUE;
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // Name:        gui_copyfiles_end
 // Description: End file copy. Must be invoked after gui_copyfiles_start().
@@ -11,6 +11,7 @@
 #define GUI_H_
 
 #include "file.h"
+#include "plan.h"
 #include <stdbool.h>
 
 // Gui return codes.
@@ -92,6 +93,7 @@ inp_t gui_askdir(const char *msg, const char *hlp, bool pth, bool dsk, bool asn,
 inp_t gui_askfile(const char *msg, const char *hlp, bool pth, bool dsk, const char *def, bool bck, const char **ret);
 inp_t gui_confirm(const char *msg, const char *hlp, bool bck);
 inp_t gui_copyfiles_setcur(const char *cur, bool nga, bool bck);
-inp_t gui_copyfiles_start(const char *msg, const char *hlp, pnode_p lst, bool cnf, bool bck);
+inp_t gui_copyfiles_progress(const struct cprog_t *prg, bool nga, bool bck);
+inp_t gui_copyfiles_start(const char *msg, const char *hlp, plan_p lst, bool cnf, bool bck);
 
 #endif
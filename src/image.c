@@ -0,0 +1,722 @@
+//------------------------------------------------------------------------------
+// image.c:
+//
+// Precompiled scripts, serialization of the syntax tree.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "all.h"
+#include "alloc.h"
+#include "image.h"
+#include "util.h"
+#include "version.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+//------------------------------------------------------------------------------
+// Image layout. The header is made up of big endian 32-bit values. Types and
+// function indices are single bytes, all other numbers are stored as 7 bits per
+// byte, least significant first, with the top bit set on all but the last byte.
+// Lengths and counts are stored plus one, zero means NULL.
+//
+// Header: MAGIC VERSION BUILD SIZE HASH
+// Entry:  TYPE ID NAME [CALL RESOLVED] SYMBOLS CHILDREN
+// Name:   LENGTH BYTES
+// Vector: COUNT ENTRY*
+//------------------------------------------------------------------------------
+#define IMG_MAGIC   "LGC\x1a"
+#define IMG_SUFFIX  ".lgc"
+#define IMG_HEAD    20
+
+//------------------------------------------------------------------------------
+// All functions that might be referred to by a NATIVE. The index in this table
+// is what ends up in the image. Images produced by other versions of the
+// interpreter are ignored, so the order only needs to be stable per version.
+//------------------------------------------------------------------------------
+static const call_t img_call[] =
+{
+    n_abort, n_add, n_and, n_asbeval, n_asbraw, n_askbool, n_askchoice,
+    n_askdir, n_askdisk, n_askfile, n_asknumber, n_askoptions, n_askstring,
+    n_astraw, n_bitand, n_bitnot, n_bitor, n_bitxor, n_cat, n_closemedia,
+    n_closewbobject, n_complete, n_copyfiles, n_copylib, n_database, n_debug,
+    n_delete, n_div, n_earlier, n_effect, n_eq, n_eval, n_execute, n_exists,
+    n_exit, n_expandpath, n_fileonly, n_fmt, n_foreach, n_getassign,
+    n_getdevice, n_getdiskspace, n_getenv, n_getsize, n_getsum, n_getversion,
+    n_gosub, n_gt, n_gte, n_iconinfo, n_if, n_in, n_lt, n_lte, n_makeassign,
+    n_makedir, n_message, n_mul, n_neq, n_not, n_openwbobject, n_options, n_or,
+    n_pathonly, n_patmatch, n_procedure, n_protect, n_querydisplay, n_reboot,
+    n_rename, n_retrace, n_rexx, n_run, n_select, n_set, n_setmedia,
+    n_shiftleft, n_shiftright, n_showmedia, n_showwbobject, n_startup,
+    n_strlen, n_sub, n_substr, n_symbolset, n_symbolval, n_tackon, n_textfile,
+    n_tooltype, n_trace, n_transcript, n_trap, n_until, n_user, n_welcome,
+    n_while, n_working, n_xor
+};
+
+//------------------------------------------------------------------------------
+// Read cursor.
+//------------------------------------------------------------------------------
+struct img_t
+{
+    const unsigned char *cur;
+    const unsigned char *end;
+};
+
+//------------------------------------------------------------------------------
+// Name:        img_hash
+// Description: Compute FNV-1a hash of file.
+// Input:       const char *name:   File name.
+//              uint32_t *hash:     Hash value.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_hash(const char *name, uint32_t *hash)
+{
+    FILE *file = fopen(name, "rb");
+
+    if(!file)
+    {
+        // Nothing to hash.
+        return false;
+    }
+
+    // FNV offset basis.
+    *hash = 2166136261U;
+
+    // Hash file in buf_len() sized chunks.
+    for(size_t cnt = fread(buf_get(B_KEY), 1, buf_len(), file); cnt;
+        cnt = fread(buf_get(B_KEY), 1, buf_len(), file))
+    {
+        const unsigned char *cur = (const unsigned char *) buf_get(B_KEY);
+
+        for(size_t i = 0; i < cnt; i++)
+        {
+            *hash ^= cur[i];
+            *hash *= 16777619U;
+        }
+    }
+
+    // Unlock buffer.
+    buf_put(B_KEY);
+
+    // Don't trust a partial hash.
+    bool ret = !ferror(file);
+    fclose(file);
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_name
+// Description: Get name of image file belonging to script.
+// Input:       const char *name:   Script name.
+// Return:      char *:             Image name on success, NULL otherwise. The
+//                                  string must be free:d by the caller.
+//------------------------------------------------------------------------------
+static char *img_name(const char *name)
+{
+    size_t len = strlen(name) + sizeof(IMG_SUFFIX);
+    char *img = DBG_ALLOC(malloc(len));
+
+    if(img)
+    {
+        // Script name + suffix.
+        snprintf(img, len, "%s%s", name, IMG_SUFFIX);
+    }
+
+    return img;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_put_u32
+// Description: Write big endian 32-bit value.
+// Input:       FILE *file:     Image file.
+//              uint32_t val:   Value.
+// Return:      bool:           'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_put_u32(FILE *file, uint32_t val)
+{
+    unsigned char out[] =
+    {
+        (unsigned char) (val >> 24), (unsigned char) (val >> 16),
+        (unsigned char) (val >> 8), (unsigned char) val
+    };
+
+    return fwrite(out, 1, sizeof(out), file) == sizeof(out);
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_put_num
+// Description: Write variable length number.
+// Input:       FILE *file:     Image file.
+//              uint32_t val:   Value.
+// Return:      bool:           'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_put_num(FILE *file, uint32_t val)
+{
+    // 7 bits at a time, the top bit tells if there's more to come.
+    while(val >> 7)
+    {
+        if(fputc((int) ((val & 0x7f) | 0x80), file) == EOF)
+        {
+            return false;
+        }
+
+        val >>= 7;
+    }
+
+    return fputc((int) val, file) != EOF;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_put_str
+// Description: Write string, or zero if there is none.
+// Input:       FILE *file:         Image file.
+//              const char *str:    String or NULL.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_put_str(FILE *file, const char *str)
+{
+    if(!str)
+    {
+        return img_put_num(file, 0);
+    }
+
+    // Length followed by the string itself, without terminator.
+    size_t len = strlen(str);
+    return img_put_num(file, (uint32_t) len + 1) &&
+           fwrite(str, 1, len, file) == len;
+}
+
+static bool img_put_entry(FILE *file, entry_p entry);
+
+//------------------------------------------------------------------------------
+// Name:        img_put_vec
+// Description: Write vector of entries, or zero if there is none.
+// Input:       FILE *file:     Image file.
+//              entry_p *vec:   Children / symbols or NULL.
+// Return:      bool:           'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_put_vec(FILE *file, entry_p *vec)
+{
+    if(!vec)
+    {
+        return img_put_num(file, 0);
+    }
+
+    // Number of entries followed by the entries themselves.
+    bool ret = img_put_num(file, (uint32_t) num_children(vec) + 1);
+
+    for(entry_p *cur = vec; ret && exists(*cur); cur++)
+    {
+        ret = img_put_entry(file, *cur);
+    }
+
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_put_entry
+// Description: Write entry and everything below it.
+// Input:       FILE *file:     Image file.
+//              entry_p entry:  Entry.
+// Return:      bool:           'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_put_entry(FILE *file, entry_p entry)
+{
+    size_t ndx = 0;
+
+    // Translate function pointer to table index.
+    if(entry->type == NATIVE)
+    {
+        while(ndx < sizeof(img_call) / sizeof(img_call[0]) &&
+              img_call[ndx] != entry->call)
+        {
+            ndx++;
+        }
+
+        if(ndx == sizeof(img_call) / sizeof(img_call[0]))
+        {
+            // Unknown function.
+            return false;
+        }
+    }
+
+    // Type, ID and name are common to all entries.
+    if(entry->type >= DANGLE || fputc(entry->type, file) == EOF ||
+       !img_put_num(file, (uint32_t) entry->id) ||
+       !img_put_str(file, entry->name))
+    {
+        return false;
+    }
+
+    // Functions have callbacks and default return values.
+    if(entry->type == NATIVE && (fputc((int) ndx, file) == EOF ||
+       fputc(entry->resolved ? entry->resolved->type : DANGLE, file) == EOF))
+    {
+        return false;
+    }
+
+    // Symbols before children, refer to img_get_entry().
+    return img_put_vec(file, entry->symbols) &&
+           img_put_vec(file, entry->children);
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_save
+// Description: Save syntax tree as image next to the script. The image is keyed
+//              by the script size and contents and the interpreter version.
+// Input:       entry_p contxt:     The start symbol, before init().
+//              const char *name:   Script name.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+bool img_save(entry_p contxt, const char *name)
+{
+    uint32_t hash;
+    struct stat sst;
+    char *img = name ? img_name(name) : NULL;
+
+    if(!contxt || !img || stat(name, &sst) || !img_hash(name, &hash))
+    {
+        free(img);
+        return false;
+    }
+
+    FILE *file = fopen(img, "wb");
+
+    if(!file)
+    {
+        free(img);
+        return false;
+    }
+
+    // Header followed by the tree.
+    bool ret = fwrite(IMG_MAGIC, 1, 4, file) == 4 &&
+               img_put_u32(file, (uint32_t) (MAJOR << 16) | MINOR) &&
+               img_put_u32(file, BUILD) &&
+               img_put_u32(file, (uint32_t) sst.st_size) &&
+               img_put_u32(file, hash) &&
+               img_put_entry(file, contxt);
+
+    // Don't leave broken images behind.
+    if(fclose(file) || !ret)
+    {
+        remove(img);
+        ret = false;
+    }
+
+    free(img);
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_get_u8
+// Description: Read byte.
+// Input:       struct img_t *img:  Read cursor.
+//              uint8_t *val:       Value.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_get_u8(struct img_t *img, uint8_t *val)
+{
+    if(img->end - img->cur < 1)
+    {
+        // Truncated image.
+        return false;
+    }
+
+    *val = *img->cur++;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_get_u32
+// Description: Read big endian 32-bit value.
+// Input:       struct img_t *img:  Read cursor.
+//              uint32_t *val:      Value.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_get_u32(struct img_t *img, uint32_t *val)
+{
+    if(img->end - img->cur < 4)
+    {
+        // Truncated image.
+        return false;
+    }
+
+    *val = ((uint32_t) img->cur[0] << 24) | ((uint32_t) img->cur[1] << 16) |
+           ((uint32_t) img->cur[2] << 8) | (uint32_t) img->cur[3];
+
+    img->cur += 4;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_get_num
+// Description: Read variable length number.
+// Input:       struct img_t *img:  Read cursor.
+//              uint32_t *val:      Value.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_get_num(struct img_t *img, uint32_t *val)
+{
+    *val = 0;
+
+    // At most five bytes are needed for 32 bits.
+    for(int shift = 0; shift < 35 && img->cur < img->end; shift += 7)
+    {
+        *val |= (uint32_t) (*img->cur & 0x7f) << shift;
+
+        if(!(*img->cur++ & 0x80))
+        {
+            return true;
+        }
+    }
+
+    // Truncated or corrupt image.
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_get_str
+// Description: Read string.
+// Input:       struct img_t *img:  Read cursor.
+//              char **str:         String or NULL. Must be free:d by the
+//                                  caller.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_get_str(struct img_t *img, char **str)
+{
+    uint32_t len;
+    *str = NULL;
+
+    if(!img_get_num(img, &len))
+    {
+        return false;
+    }
+
+    if(!len--)
+    {
+        // No string.
+        return true;
+    }
+
+    if((uint32_t) (img->end - img->cur) < len)
+    {
+        // Truncated image.
+        return false;
+    }
+
+    *str = DBG_ALLOC(malloc(len + 1));
+
+    if(*str)
+    {
+        // Copy and terminate.
+        memcpy(*str, img->cur, len);
+        (*str)[len] = '\0';
+        img->cur += len;
+    }
+
+    return *str != NULL;
+}
+
+static entry_p img_get_entry(struct img_t *img);
+
+//------------------------------------------------------------------------------
+// Name:        img_get_vec
+// Description: Read vector of entries into CONTXT, created if necessary.
+// Input:       struct img_t *img:  Read cursor.
+//              entry_p *contxt:    CONTXT or NULL.
+//              bool sym:           Symbols or children.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_get_vec(struct img_t *img, entry_p *contxt, bool sym)
+{
+    uint32_t num;
+
+    if(!img_get_num(img, &num))
+    {
+        return false;
+    }
+
+    if(!num--)
+    {
+        // No vector.
+        return true;
+    }
+
+    // Create CONTXT on demand. Every entry takes up more than one byte, larger
+    // counts than that means that the image is corrupt.
+    if(num > (uint32_t) (img->end - img->cur) ||
+       (!*contxt && !(*contxt = new_contxt())))
+    {
+        return false;
+    }
+
+    entry_p *vec = sym ? (*contxt)->symbols : (*contxt)->children;
+
+    // The default size is LG_VECLEN. Make room for everything in one go instead
+    // of growing the vector while appending.
+    if(num > LG_VECLEN)
+    {
+        vec = DBG_ALLOC(calloc(num + 1, sizeof(entry_p)));
+
+        if(!vec)
+        {
+            return false;
+        }
+
+        // Replace the default vector.
+        vec[num] = end();
+        free(sym ? (*contxt)->symbols : (*contxt)->children);
+        *(sym ? &(*contxt)->symbols : &(*contxt)->children) = vec;
+    }
+
+    for(uint32_t i = 0; i < num; i++)
+    {
+        // Adopt the new entry.
+        vec[i] = img_get_entry(img);
+
+        if(!vec[i])
+        {
+            return false;
+        }
+
+        vec[i]->parent = *contxt;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_valid
+// Description: Validate entry before it's created. Constructors PANIC on bad
+//              input and we don't want that to happen on corrupt images.
+// Input:       uint8_t type:   Entry type.
+//              int32_t id:     Entry ID.
+//              char *name:     Entry name.
+//              uint8_t call:   Function index.
+//              uint8_t res:    Default return value type.
+//              entry_p sym:    Symbols / children CONTXT.
+// Return:      bool:           'true' if valid, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool img_valid(uint8_t type, int32_t id, char *name, uint8_t call,
+                      uint8_t res, entry_p sym)
+{
+    switch(type)
+    {
+        case NUMBER:
+            return !sym;
+
+        case STRING:
+        case SYMBOL:
+            return name && !sym;
+
+        case SYMREF:
+            return name && id > 0 && !sym;
+
+        case NATIVE:
+            return name && id > 0 &&
+                   call < sizeof(img_call) / sizeof(img_call[0]) &&
+                   (res == NUMBER || res == STRING || res == DANGLE);
+
+        case OPTION:
+            return name && id >= OPT_ALL && id < OPT_LAST;
+
+        case CUSTOM:
+            return name != NULL;
+
+        case CUSREF:
+            return name && id > 0;
+
+        case CONTXT:
+            return !name && sym;
+
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_get_entry
+// Description: Read entry and everything below it.
+// Input:       struct img_t *img:  Read cursor.
+// Return:      entry_p:            Entry on success, NULL otherwise.
+//------------------------------------------------------------------------------
+static entry_p img_get_entry(struct img_t *img)
+{
+    uint8_t type, call = 0, res = DANGLE;
+    uint32_t id;
+    char *name;
+
+    if(!img_get_u8(img, &type) || !img_get_num(img, &id) ||
+       !img_get_str(img, &name))
+    {
+        return NULL;
+    }
+
+    entry_p sym = NULL, chl = NULL;
+
+    // User-defined procedures keep symbols (arguments) and children (body)
+    // apart, everything else gets one CONTXT with both.
+    if((type == NATIVE && (!img_get_u8(img, &call) || !img_get_u8(img, &res)))
+       || !img_get_vec(img, &sym, true)
+       || !img_get_vec(img, type == CUSTOM ? &chl : &sym, false)
+       || !img_valid(type, (int32_t) id, name, call, res, sym))
+    {
+        free(name);
+        kill(sym);
+        kill(chl);
+        return NULL;
+    }
+
+    switch(type)
+    {
+        case NUMBER:
+            free(name);
+            return new_number((int32_t) id);
+
+        case STRING:
+            return new_string(name);
+
+        case SYMBOL:
+            return new_symbol(name);
+
+        case SYMREF:
+            return new_symref(name, (int32_t) id);
+
+        case NATIVE:
+            return new_native(name, (int32_t) id, img_call[call], sym,
+                              (type_t) res);
+
+        case OPTION:
+            return new_option(name, (opt_t) id, sym);
+
+        case CUSTOM:
+            return new_custom(name, (int32_t) id, sym, chl);
+
+        case CUSREF:
+            return new_cusref(name, (int32_t) id, sym);
+
+        default:
+            return sym;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_fresh
+// Description: Check if image belongs to the current version of a script. The
+//              size and the modification times are checked first, the script
+//              is only hashed if they match.
+// Input:       const char *name:   Image name.
+//              const char *scr:    Script name.
+//              uint32_t siz:       Script size according to the image.
+//              uint32_t sum:       Script hash according to the image.
+// Return:      bool:               'true' if the image is up to date, 'false'
+//                                  otherwise.
+//------------------------------------------------------------------------------
+static bool img_fresh(const char *name, const char *scr, uint32_t siz,
+                      uint32_t sum)
+{
+    struct stat ist, sst;
+    uint32_t hash;
+
+    // An image older than the script can't be trusted without hashing, and
+    // shouldn't be there in the first place.
+    return !stat(name, &ist) && !stat(scr, &sst) &&
+           (uint32_t) sst.st_size == siz && ist.st_mtime >= sst.st_mtime &&
+           img_hash(scr, &hash) && hash == sum;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_read
+// Description: Read syntax tree from image file.
+// Input:       const char *name:   Image name.
+//              const char *scr:    Script that the image must belong to, NULL
+//                                  to accept any script.
+// Return:      entry_p:            The start symbol on success, NULL
+//                                  otherwise.
+//------------------------------------------------------------------------------
+static entry_p img_read(const char *name, const char *scr)
+{
+    FILE *file = fopen(name, "rb");
+
+    if(!file)
+    {
+        // No image.
+        return NULL;
+    }
+
+    entry_p contxt = NULL;
+    unsigned char head[IMG_HEAD];
+    struct img_t img = { head + 4, head + sizeof(head) };
+    uint32_t ver, bld, siz, sum;
+
+    // Check the header before reading the rest.
+    if(fread(head, 1, sizeof(head), file) == sizeof(head) &&
+       !memcmp(head, IMG_MAGIC, 4) && img_get_u32(&img, &ver) &&
+       img_get_u32(&img, &bld) && img_get_u32(&img, &siz) &&
+       img_get_u32(&img, &sum) && ver == (uint32_t) ((MAJOR << 16) | MINOR) &&
+       bld == BUILD && (!scr || img_fresh(name, scr, siz, sum)) &&
+       !fseek(file, 0, SEEK_END))
+    {
+        long len = ftell(file) - IMG_HEAD;
+        unsigned char *buf = len > 0 ? DBG_ALLOC(malloc(len)) : NULL;
+
+        // Read the tree in one go and map it.
+        if(buf && !fseek(file, IMG_HEAD, SEEK_SET) &&
+           fread(buf, 1, len, file) == (size_t) len)
+        {
+            img.cur = buf;
+            img.end = buf + len;
+            contxt = img_get_entry(&img);
+
+            // Trailing garbage or not a start symbol.
+            if(contxt && (img.cur != img.end || contxt->type != CONTXT))
+            {
+                kill(contxt);
+                contxt = NULL;
+            }
+        }
+
+        free(buf);
+    }
+
+    fclose(file);
+    return contxt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        img_load
+// Description: Load precompiled script. The script itself might be an image, or
+//              there might be an up to date image next to it.
+// Input:       const char *name:   Script name.
+// Return:      entry_p:            The start symbol, before init(), if there's
+//                                  a valid image, NULL otherwise.
+//------------------------------------------------------------------------------
+entry_p img_load(const char *name)
+{
+    if(!name)
+    {
+        return NULL;
+    }
+
+    // Is the script an image?
+    entry_p contxt = img_read(name, NULL);
+
+    if(!contxt)
+    {
+        char *img = img_name(name);
+
+        // Is there an image matching the script contents?
+        if(img)
+        {
+            contxt = img_read(img, name);
+        }
+
+        free(img);
+    }
+
+    return contxt;
+}
@@ -0,0 +1,19 @@
+//------------------------------------------------------------------------------
+// image.h:
+//
+// Precompiled scripts, serialization of the syntax tree.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef IMAGE_H_
+#define IMAGE_H_
+
+#include "types.h"
+#include <stdbool.h>
+
+bool img_save(entry_p contxt, const char *name);
+entry_p img_load(const char *name);
+
+#endif
@@ -164,6 +164,7 @@ static void init_misc_num(entry_p contxt)
     init_num(contxt, "@installer-version", (int32_t) (MAJOR << 16) | MINOR);
     init_num(contxt, "@ioerr", LG_FALSE);
     init_num(contxt, "@log", LG_FALSE);
+    init_num(contxt, "@log-flush", 1000);
     init_num(contxt, "@yes", LG_FALSE);
     init_num(contxt, "@skip", LG_FALSE);
     init_num(contxt, "@abort", LG_FALSE);
@@ -176,6 +177,19 @@ static void init_misc_num(entry_p contxt)
     init_num(contxt, "@alfa", 0);
     init_num(contxt, "@beta", 1);
     init_num(contxt, "@gamma", 2);
+    init_num(contxt, "@copy-files", 0);
+    init_num(contxt, "@copy-kb", 0);
+    init_num(contxt, "@copy-time", 0);
+    init_num(contxt, "@copy-rate", 0);
+    init_num(contxt, "@copy-skipped", 0);
+    init_num(contxt, "@skip-unchanged", 0);
+    init_num(contxt, "@copy-journal", 0);
+    init_num(contxt, "@cache-hits", 0);
+    init_num(contxt, "@cache-misses", 0);
+    init_num(contxt, "@startup-batch", 0);
+    init_num(contxt, "@sum-cache", 0);
+    init_num(contxt, "@version-cache", 0);
+    init_num(contxt, "@host-probe", 0);
     init_num(contxt, "@strict",
     // In test mode, strict is default.
     #if defined(AMIGA) && !defined(LG_TEST)
@@ -367,7 +381,11 @@ static void init_welcome(entry_p contxt)
 entry_p init(entry_p contxt)
 {
     // We should have atleast one child. If we don't, we're out of memory.
-    if(!c_sane(contxt, 1) || !s_sane(contxt, 0))
+    // Images are saved without startup / shutdown code, it's added when the
+    // image is loaded instead. Refer to img_load(). Nothing is executed when
+    // checking the syntax.
+    if(!c_sane(contxt, 1) || !s_sane(contxt, 0) || arg_get(ARG_COMPILE) ||
+       arg_get(ARG_CHECK))
     {
         return contxt;
     }
@@ -389,3 +407,43 @@ entry_p init(entry_p contxt)
 #endif
     return contxt;
 }
+
+//------------------------------------------------------------------------------
+// Name:        init_stream
+// Description: Prepend / append startup and shutdown code when streaming,
+//              refer to stream(). There's no default (welcome), there's no way
+//              of telling whether the script has one of its own until all of it
+//              has been parsed.
+// Input:       entry_p contxt:  The root context.
+//              bool last:       Shutdown code instead of startup code.
+// Return:      entry_p:         Root + startup / shutdown additions.
+//------------------------------------------------------------------------------
+entry_p init_stream(entry_p contxt, bool last)
+{
+    // The root might be empty at the end of the script, everything executed
+    // might have been freed already.
+    if(!c_sane(contxt, last ? 0 : 1) || !s_sane(contxt, 0))
+    {
+        return contxt;
+    }
+#ifndef LG_DEBUG
+    if(last)
+    {
+        // Create default (exit).
+        init_exit(contxt);
+        return contxt;
+    }
+
+    // Promote tooltypes to variables.
+    init_tooltypes(contxt);
+
+    // Create default (onerror).
+    init_error(contxt);
+
+    // Set default symbols.
+    init_misc(contxt);
+#else
+    (void) last;
+#endif
+    return contxt;
+}
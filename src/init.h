@@ -11,7 +11,9 @@
 #define INIT_H_
 
 #include "types.h"
+#include <stdbool.h>
 
 entry_p init(entry_p contxt);
+entry_p init_stream(entry_p contxt, bool last);
 
 #endif
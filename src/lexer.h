@@ -26,5 +26,6 @@ typedef union
 int yyget_lineno(yyscan_t yyscanner);
 int yylex(YYSTYPE * yylval_param ,yyscan_t yyscanner);
 int yyerror(yyscan_t scanner, const char *err);
+int parse(const char *name);
 
 #endif
@@ -0,0 +1,719 @@
+//------------------------------------------------------------------------------
+// match.c:
+//
+// AmigaDOS style pattern matching, case insensitive, for systems without
+// ParsePatternNoCase() and MatchPatternNoCase(). A pattern is compiled once
+// to an array of nodes and can then be matched against any number of
+// strings. Supported: ? any character, #x zero or more x, ~x anything but
+// x, [a-z] and [~a-z] character classes, (a|b) alternatives, % the empty
+// string and ' to escape the next character.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "match.h"
+#include "util.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Node types.
+enum
+{
+    MT_CHR,     // A character.
+    MT_ANY,     // ?
+    MT_SET,     // [...]
+    MT_REP,     // #x
+    MT_NOT,     // ~x
+    MT_ALT,     // (a|b)
+    MT_BRA,     // Alternative in MT_ALT.
+    MT_NIL      // %
+};
+
+// End of sequence, end of match and failure to compile.
+#define MT_NONE -1
+#define MT_END -2
+#define MT_ERR -3
+
+//------------------------------------------------------------------------------
+// Pattern node. Nodes in a sequence are chained by 'nxt'. The element
+// repeated or negated, and the alternatives, are sequences of their own
+// starting at 'sub'. Alternatives are chained by 'alt'.
+//------------------------------------------------------------------------------
+struct mnode_t
+{
+    int32_t op;
+    int32_t nxt;
+    int32_t sub;
+    int32_t alt;
+    bool neg;
+    unsigned char chr;
+    unsigned char set[32];
+};
+
+//------------------------------------------------------------------------------
+// Compiled pattern, 'top' is the first node.
+//------------------------------------------------------------------------------
+struct match_t
+{
+    struct mnode_t *nod;
+    int32_t num;
+    int32_t max;
+    int32_t top;
+};
+
+//------------------------------------------------------------------------------
+// Where to go when a sequence ends. Repetitions must make progress, or else
+// #% would go on forever. Continuations that are the same get the same serial
+// number, zero means no continuation, refer to mt_cont().
+//------------------------------------------------------------------------------
+struct mcont_t
+{
+    int32_t nod;
+    const char *pos;
+    bool rep;
+    uint32_t ser;
+    const struct mcont_t *up;
+};
+
+//------------------------------------------------------------------------------
+// Key in table of continuations or failures. A continuation is known by its
+// node, its offset and the serial number of the one above, its own serial
+// number is the value. A failure to match is known by its node, its offset
+// and the serial number of its continuation. Node MT_ERR means free.
+//------------------------------------------------------------------------------
+struct mkey_t
+{
+    int32_t nod;
+    uint32_t ser;
+    size_t off;
+    uint32_t val;
+};
+
+//------------------------------------------------------------------------------
+// Open addressing hash table of keys.
+//------------------------------------------------------------------------------
+struct mtab_t
+{
+    struct mkey_t *key;
+    size_t cap;
+    size_t num;
+};
+
+//------------------------------------------------------------------------------
+// State of one match. Failures are remembered so that backtracking never
+// tries the same thing twice, refer to mt_rest().
+//------------------------------------------------------------------------------
+struct mrun_t
+{
+    match_p mat;
+    const char *str;
+    uint32_t ser;
+    struct mtab_t cnt;
+    struct mtab_t fail;
+};
+
+//------------------------------------------------------------------------------
+// Name:        mt_fold
+// Description: Fold character to lower case.
+// Input:       char chr:   Character.
+// Return:      unsigned char:  Lower case character.
+//------------------------------------------------------------------------------
+static unsigned char mt_fold(char chr)
+{
+    return (unsigned char) tolower((unsigned char) chr);
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_node
+// Description: Add node to pattern.
+// Input:       match_p mat:    Pattern.
+//              int32_t op:     Node type.
+// Return:      int32_t:        Index of the new node or MT_ERR if out of
+//                              memory.
+//------------------------------------------------------------------------------
+static int32_t mt_node(match_p mat, int32_t op)
+{
+    if(mat->num == mat->max)
+    {
+        int32_t max = mat->max ? mat->max << 1 : 16;
+        struct mnode_t *nod = DBG_ALLOC(realloc(mat->nod, (size_t) max *
+                                                sizeof(struct mnode_t)));
+
+        if(!nod)
+        {
+            // Out of memory.
+            return MT_ERR;
+        }
+
+        mat->nod = nod;
+        mat->max = max;
+    }
+
+    struct mnode_t *nod = mat->nod + mat->num;
+
+    memset(nod, 0, sizeof(struct mnode_t));
+    nod->op = op;
+    nod->nxt = nod->sub = nod->alt = MT_NONE;
+    return mat->num++;
+}
+
+static int32_t mt_seq(match_p mat, const char **pat);
+
+//------------------------------------------------------------------------------
+// Name:        mt_set
+// Description: Compile character class, the part after '['.
+// Input:       match_p mat:        Pattern.
+//              int32_t ndx:        MT_SET node.
+//              const char **pat:   Pattern string, moved past ']'.
+// Return:      int32_t:            'ndx' or MT_ERR if there's no ']'.
+//------------------------------------------------------------------------------
+static int32_t mt_set(match_p mat, int32_t ndx, const char **pat)
+{
+    const char *cur = *pat;
+    struct mnode_t *nod = mat->nod + ndx;
+
+    if(*cur == '~')
+    {
+        nod->neg = true;
+        cur++;
+    }
+
+    while(*cur && *cur != ']')
+    {
+        cur += *cur == '\'' && cur[1] ? 1 : 0;
+
+        unsigned char fst = mt_fold(*cur++), lst = fst;
+
+        if(*cur == '-' && cur[1] && cur[1] != ']')
+        {
+            cur += cur[1] == '\'' && cur[2] ? 2 : 1;
+            lst = mt_fold(*cur++);
+        }
+
+        for(unsigned chr = fst; chr <= lst; chr++)
+        {
+            nod->set[chr >> 3] |= (unsigned char) (1 << (chr & 7));
+        }
+    }
+
+    if(*cur != ']')
+    {
+        // Unterminated class.
+        return MT_ERR;
+    }
+
+    *pat = cur + 1;
+    return ndx;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_elem
+// Description: Compile one element of a sequence.
+// Input:       match_p mat:        Pattern.
+//              const char **pat:   Pattern string, moved past the element.
+// Return:      int32_t:            Index of the node or MT_ERR on failure.
+//------------------------------------------------------------------------------
+static int32_t mt_elem(match_p mat, const char **pat)
+{
+    char chr = *(*pat)++;
+    int32_t ndx;
+
+    switch(chr)
+    {
+        case '#':
+        case '~':
+            ndx = mt_node(mat, chr == '#' ? MT_REP : MT_NOT);
+
+            if(ndx != MT_ERR && **pat && **pat != '|' && **pat != ')')
+            {
+                int32_t sub = mt_elem(mat, pat);
+                mat->nod[ndx].sub = sub;
+                return sub == MT_ERR ? MT_ERR : ndx;
+            }
+
+            // Nothing to repeat or negate.
+            return MT_ERR;
+
+        case '(':
+            ndx = mt_node(mat, MT_ALT);
+
+            for(int32_t lst = MT_NONE; ndx != MT_ERR;)
+            {
+                int32_t bra = mt_node(mat, MT_BRA),
+                        sub = bra == MT_ERR ? MT_ERR : mt_seq(mat, pat);
+
+                if(sub == MT_ERR)
+                {
+                    return MT_ERR;
+                }
+
+                mat->nod[bra].sub = sub;
+                *(lst == MT_NONE ? &mat->nod[ndx].sub : &mat->nod[lst].alt) =
+                    bra;
+                lst = bra;
+
+                if(**pat != '|')
+                {
+                    break;
+                }
+
+                (*pat)++;
+            }
+
+            if(**pat != ')')
+            {
+                // Unbalanced parentheses.
+                return MT_ERR;
+            }
+
+            (*pat)++;
+            return ndx;
+
+        case '[':
+            ndx = mt_node(mat, MT_SET);
+            return ndx == MT_ERR ? MT_ERR : mt_set(mat, ndx, pat);
+
+        case '?':
+            return mt_node(mat, MT_ANY);
+
+        case '%':
+            return mt_node(mat, MT_NIL);
+
+        case '\'':
+            // Escaped character, unless there's nothing to escape.
+            chr = **pat ? *(*pat)++ : chr;
+            break;
+
+        case ')':
+        case '|':
+            // Not within parentheses.
+            return MT_ERR;
+    }
+
+    ndx = mt_node(mat, MT_CHR);
+
+    if(ndx != MT_ERR)
+    {
+        mat->nod[ndx].chr = mt_fold(chr);
+    }
+
+    return ndx;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_seq
+// Description: Compile sequence of elements, up to '|', ')' or the end.
+// Input:       match_p mat:        Pattern.
+//              const char **pat:   Pattern string, moved past the sequence.
+// Return:      int32_t:            Index of the first node, MT_NONE if the
+//                                  sequence is empty or MT_ERR on failure.
+//------------------------------------------------------------------------------
+static int32_t mt_seq(match_p mat, const char **pat)
+{
+    int32_t fst = MT_NONE, lst = MT_NONE;
+
+    while(**pat && **pat != '|' && **pat != ')')
+    {
+        int32_t ndx = mt_elem(mat, pat);
+
+        if(ndx == MT_ERR)
+        {
+            return MT_ERR;
+        }
+
+        *(lst == MT_NONE ? &fst : &mat->nod[lst].nxt) = ndx;
+        lst = ndx;
+    }
+
+    return fst;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_compile
+// Description: Compile pattern.
+// Input:       const char *pat:    Pattern.
+// Return:      match_p:            Compiled pattern, or NULL if the pattern
+//                                  is invalid or if we're out of memory.
+//------------------------------------------------------------------------------
+match_p mt_compile(const char *pat)
+{
+    match_p mat = DBG_ALLOC(calloc(1, sizeof(struct match_t)));
+
+    if(!mat)
+    {
+        // Out of memory.
+        return NULL;
+    }
+
+    mat->top = mt_seq(mat, &pat);
+
+    if(mat->top == MT_ERR || *pat)
+    {
+        // Invalid pattern.
+        mt_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_slot
+// Description: Find key in table, or the free slot where it belongs.
+// Input:       struct mtab_t *tab:     Table, not empty.
+//              struct mkey_t *key:     Key.
+// Return:      struct mkey_t *:        Slot.
+//------------------------------------------------------------------------------
+static struct mkey_t *mt_slot(struct mtab_t *tab, const struct mkey_t *key)
+{
+    uint64_t hash = ((uint64_t) key->off << 32 ^ (uint64_t) key->ser << 16 ^
+                     (uint32_t) key->nod) * 0x9e3779b97f4a7c15u;
+
+    for(size_t ndx = (size_t) (hash >> 32) & (tab->cap - 1);;
+        ndx = (ndx + 1) & (tab->cap - 1))
+    {
+        struct mkey_t *cur = tab->key + ndx;
+
+        if(cur->nod == MT_ERR || (cur->nod == key->nod &&
+           cur->ser == key->ser && cur->off == key->off))
+        {
+            return cur;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_find
+// Description: Find key in table.
+// Input:       struct mtab_t *tab:     Table.
+//              struct mkey_t *key:     Key.
+// Return:      struct mkey_t *:        Key in table or NULL if not found.
+//------------------------------------------------------------------------------
+static struct mkey_t *mt_find(struct mtab_t *tab, const struct mkey_t *key)
+{
+    struct mkey_t *cur = tab->num ? mt_slot(tab, key) : NULL;
+    return cur && cur->nod != MT_ERR ? cur : NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_add
+// Description: Add key to table, unless it's there already.
+// Input:       struct mtab_t *tab:     Table.
+//              struct mkey_t *key:     Key.
+// Return:      bool:                   'true' on success, 'false' if out of
+//                                      memory.
+//------------------------------------------------------------------------------
+static bool mt_add(struct mtab_t *tab, const struct mkey_t *key)
+{
+    if(tab->num * 2 >= tab->cap)
+    {
+        struct mtab_t nxt = { NULL, tab->cap ? tab->cap << 1 : 64, 0 };
+        nxt.key = DBG_ALLOC(malloc(nxt.cap * sizeof(struct mkey_t)));
+
+        if(!nxt.key)
+        {
+            // Out of memory.
+            return false;
+        }
+
+        for(size_t i = 0; i < nxt.cap; i++)
+        {
+            nxt.key[i].nod = MT_ERR;
+        }
+
+        for(size_t i = 0; i < tab->cap; i++)
+        {
+            if(tab->key[i].nod != MT_ERR)
+            {
+                *mt_slot(&nxt, tab->key + i) = tab->key[i];
+            }
+        }
+
+        nxt.num = tab->num;
+        free(tab->key);
+        *tab = nxt;
+    }
+
+    struct mkey_t *cur = mt_slot(tab, key);
+
+    if(cur->nod == MT_ERR)
+    {
+        *cur = *key;
+        tab->num++;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_cont
+// Description: Get the serial number of a continuation. The same continuation
+//              created over and over again while backtracking gets the same
+//              number every time.
+// Input:       struct mrun_t *run:         Match state.
+//              int32_t nod:                Node.
+//              const char *pos:            Position, or NULL.
+//              const struct mcont_t *up:   Continuation above, or NULL.
+// Return:      uint32_t:                   Serial number.
+//------------------------------------------------------------------------------
+static uint32_t mt_cont(struct mrun_t *run, int32_t nod, const char *pos,
+                        const struct mcont_t *up)
+{
+    struct mkey_t key = { nod, up ? up->ser : 0,
+                          pos ? (size_t) (pos - run->str) : SIZE_MAX, 0 };
+    struct mkey_t *cur = mt_find(&run->cnt, &key);
+
+    if(cur)
+    {
+        // Seen before.
+        return cur->val;
+    }
+
+    // A new number is always safe, even if we're out of memory.
+    key.val = ++run->ser;
+    mt_add(&run->cnt, &key);
+    return key.val;
+}
+
+static bool mt_run(struct mrun_t *run, int32_t ndx, const char *str,
+                   const struct mcont_t *cnt);
+static bool mt_rep(struct mrun_t *run, int32_t ndx, const char *str,
+                   const struct mcont_t *cnt);
+
+//------------------------------------------------------------------------------
+// Name:        mt_rest
+// Description: Match the rest of a string from a repetition, or after a
+//              repetition or a negation, unless we've tried and failed before.
+//              These are the points where backtracking starts over, so
+//              without this, patterns like #?a#?a#?a#?b or #(a|aa)b would
+//              take exponential time. The outcome only depends on the node,
+//              the offset and the continuation.
+// Input:       struct mrun_t *run:         Match state.
+//              int32_t ndx:                Node.
+//              const char *str:            String.
+//              const struct mcont_t *cnt:  What to do at the end of the
+//                                          current sequence.
+// Return:      bool:                       'true' on match.
+//------------------------------------------------------------------------------
+static bool mt_rest(struct mrun_t *run, int32_t ndx, const char *str,
+                    const struct mcont_t *cnt)
+{
+    struct mkey_t key = { ndx, cnt ? cnt->ser : 0,
+                          (size_t) (str - run->str), 0 };
+
+    if(mt_find(&run->fail, &key))
+    {
+        // Been there.
+        return false;
+    }
+
+    if(ndx != MT_NONE && run->mat->nod[ndx].op == MT_REP ?
+       mt_rep(run, ndx, str, cnt) : mt_run(run, ndx, str, cnt))
+    {
+        return true;
+    }
+
+    // Out of memory means that we might have to try again, nothing worse.
+    mt_add(&run->fail, &key);
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_rep
+// Description: Match the rest of a string, starting at a repetition.
+// Input:       struct mrun_t *run:         Match state.
+//              int32_t ndx:                MT_REP node.
+//              const char *str:            String.
+//              const struct mcont_t *cnt:  What to do at the end of the
+//                                          current sequence.
+// Return:      bool:                       'true' on match.
+//------------------------------------------------------------------------------
+static bool mt_rep(struct mrun_t *run, int32_t ndx, const char *str,
+                   const struct mcont_t *cnt)
+{
+    struct mnode_t *nod = run->mat->nod + ndx,
+                   *sub = run->mat->nod + nod->sub;
+
+    if(sub->op == MT_ANY && sub->nxt == MT_NONE)
+    {
+        // #?, the most common case by far.
+        for(;; str++)
+        {
+            if(mt_rest(run, nod->nxt, str, cnt))
+            {
+                return true;
+            }
+
+            if(!*str)
+            {
+                return false;
+            }
+        }
+    }
+
+    // None, or one more followed by this node again.
+    struct mcont_t rep = { ndx, str, true, mt_cont(run, ndx, str, cnt), cnt };
+    return mt_rest(run, nod->nxt, str, cnt) ||
+           mt_run(run, nod->sub, str, &rep);
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_run
+// Description: Match the rest of a string, starting at a node.
+// Input:       struct mrun_t *run:         Match state.
+//              int32_t ndx:                Node.
+//              const char *str:            String.
+//              const struct mcont_t *cnt:  What to do at the end of the
+//                                          current sequence.
+// Return:      bool:                       'true' on match.
+//------------------------------------------------------------------------------
+static bool mt_run(struct mrun_t *run, int32_t ndx, const char *str,
+                   const struct mcont_t *cnt)
+{
+    match_p mat = run->mat;
+
+    for(;;)
+    {
+        if(ndx == MT_NONE)
+        {
+            if(!cnt)
+            {
+                // The whole pattern must match the whole string.
+                return !*str;
+            }
+
+            if(cnt->nod == MT_END || (cnt->rep && str == cnt->pos))
+            {
+                // End of negation / repetition without progress.
+                return cnt->nod == MT_END && str == cnt->pos;
+            }
+
+            ndx = cnt->nod;
+            cnt = cnt->up;
+            continue;
+        }
+
+        struct mnode_t *nod = mat->nod + ndx;
+
+        switch(nod->op)
+        {
+            case MT_CHR:
+                if(!*str || mt_fold(*str) != nod->chr)
+                {
+                    return false;
+                }
+
+                str++;
+                break;
+
+            case MT_ANY:
+                if(!*str++)
+                {
+                    return false;
+                }
+
+                break;
+
+            case MT_SET:
+            {
+                unsigned char chr = mt_fold(*str);
+
+                if(!*str++ || !(nod->set[chr >> 3] & (1 << (chr & 7))) !=
+                   nod->neg)
+                {
+                    return false;
+                }
+
+                break;
+            }
+
+            case MT_REP:
+                // Refer to mt_rep().
+                return mt_rest(run, ndx, str, cnt);
+
+            case MT_NOT:
+                // Anything that the element doesn't match, followed by
+                // whatever matches the rest.
+                for(size_t len = strlen(str) + 1; len--;)
+                {
+                    struct mcont_t end = { MT_END, str + len, false,
+                                           mt_cont(run, MT_END, str + len,
+                                                   NULL), NULL };
+
+                    if(!mt_run(run, nod->sub, str, &end) &&
+                       mt_rest(run, nod->nxt, str + len, cnt))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+
+            case MT_ALT:
+            {
+                struct mcont_t nxt = { nod->nxt, NULL, false,
+                                       mt_cont(run, nod->nxt, NULL, cnt),
+                                       cnt };
+
+                for(int32_t bra = nod->sub; bra != MT_NONE;
+                    bra = mat->nod[bra].alt)
+                {
+                    if(mt_run(run, mat->nod[bra].sub, str, &nxt))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            default:
+                // MT_NIL.
+                break;
+        }
+
+        ndx = nod->nxt;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_match
+// Description: Match string against compiled pattern.
+// Input:       match_p mat:        Pattern.
+//              const char *str:    String.
+// Return:      bool:               'true' if the whole string matches.
+//------------------------------------------------------------------------------
+bool mt_match(match_p mat, const char *str)
+{
+    if(!mat || !str)
+    {
+        // Nothing matches nothing.
+        return false;
+    }
+
+    struct mrun_t run = { .mat = mat, .str = str };
+    bool res = mt_run(&run, mat->top, str, NULL);
+
+    free(run.cnt.key);
+    free(run.fail.key);
+    return res;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mt_free
+// Description: Free compiled pattern.
+// Input:       match_p mat:    Pattern.
+// Return:      -
+//------------------------------------------------------------------------------
+void mt_free(match_p mat)
+{
+    if(mat)
+    {
+        free(mat->nod);
+        free(mat);
+    }
+}
@@ -0,0 +1,22 @@
+//------------------------------------------------------------------------------
+// match.h:
+//
+// AmigaDOS style pattern matching.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef MATCH_H_
+#define MATCH_H_
+
+#include <stdbool.h>
+
+// Compiled pattern, refer to match.c.
+typedef struct match_t * match_p;
+
+match_p mt_compile(const char *pat);
+bool mt_match(match_p mat, const char *str);
+void mt_free(match_p mat);
+
+#endif
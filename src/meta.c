@@ -0,0 +1,552 @@
+//------------------------------------------------------------------------------
+// meta.c:
+//
+// File information cache. Scripts tend to ask about the same files over and
+// over again, (exists), (getsize), (protect) and the checks made by
+// (copyfiles) all need to know what's there. The answers are kept in a hash
+// table keyed by path until the file changes. Directories created by us are
+// kept as well, without asking the file system about them, refer to
+// mc_mkdir(). Everything that changes files must tell the cache about it,
+// refer to mc_drop() and mc_clear(). The cache is used by the interpreter
+// only, never by the copy threads.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "meta.h"
+#include "types.h"
+#include "util.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#ifdef AMIGA
+#include <dos/dos.h>
+#include <proto/dos.h>
+#endif
+
+// Number of buckets to start with and the max number of entries. When full,
+// the cache starts over.
+#define MC_INIT 256
+#define MC_MAX (1 << 16)
+
+//------------------------------------------------------------------------------
+// Cache entry, the path follows the entry. Only the type is valid in partial
+// entries.
+//------------------------------------------------------------------------------
+struct mnode_t
+{
+    struct mnode_t *next;
+    uint32_t hash;
+    size_t len;
+    bool part;
+    struct meta_t met;
+};
+
+static struct
+{
+    struct mnode_t **tab;
+    size_t cap;
+    size_t num;
+    uint64_t gen;
+    uint64_t hit;
+    uint64_t mis;
+} mc;
+
+//------------------------------------------------------------------------------
+// Name:        mc_key
+// Description: Normalise path, the same file or directory should have only one
+//              key. Trailing slashes and leading "./" are not part of it.
+// Input:       const char **name:  Path, moved to the start of the key.
+// Return:      size_t:             Length of the key.
+//------------------------------------------------------------------------------
+static size_t mc_key(const char **name)
+{
+    const char *key = *name;
+
+    #ifndef AMIGA
+    while(key[0] == '.' && key[1] == '/' && key[2])
+    {
+        key += 2;
+    }
+    #endif
+
+    size_t len = strlen(key);
+
+    // Keep the slash of the root and of volumes, "/" and "Work:/".
+    while(len > 1 && key[len - 1] == '/' && key[len - 2] != '/' &&
+          key[len - 2] != ':')
+    {
+        len--;
+    }
+
+    *name = key;
+    return len;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_hash
+// Description: FNV-1a hash of key. Case insensitive on Amiga.
+// Input:       const char *key:    Key.
+//              size_t len:         Length of key.
+// Return:      uint32_t:           Hash.
+//------------------------------------------------------------------------------
+static uint32_t mc_hash(const char *key, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    for(size_t i = 0; i < len; i++)
+    {
+        #ifdef AMIGA
+        unsigned char chr = (unsigned char) key[i];
+        hash ^= (chr >= 'a' && chr <= 'z') ? chr - 'a' + 'A' : chr;
+        #else
+        hash ^= (unsigned char) key[i];
+        #endif
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_same
+// Description: Compare the key of an entry with another key.
+// Input:       struct mnode_t *nod:    Entry.
+//              const char *key:        Key.
+//              size_t len:             Length of key.
+// Return:      bool:                   'true' if the keys are the same.
+//------------------------------------------------------------------------------
+static bool mc_same(struct mnode_t *nod, const char *key, size_t len)
+{
+    #ifdef AMIGA
+    return nod->len == len && !strncasecmp((char *) (nod + 1), key, len);
+    #else
+    return nod->len == len && !memcmp(nod + 1, key, len);
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_fetch
+// Description: Get file information from the file system.
+// Input:       const char *name:       Path.
+//              struct meta_t *met:     Result.
+// Return:      -
+//------------------------------------------------------------------------------
+static void mc_fetch(const char *name, struct meta_t *met)
+{
+    memset(met, 0, sizeof(struct meta_t));
+    met->type = LG_NONE;
+
+    #if defined(AMIGA)
+    struct FileInfoBlock *fib = (struct FileInfoBlock *)
+           AllocDosObject(DOS_FIB, NULL);
+
+    if(!fib)
+    {
+        // Out of memory, nothing found.
+        return;
+    }
+
+    // Attempt to lock file or directory.
+    BPTR lock = (BPTR) Lock(name, ACCESS_READ);
+
+    // Get information from lock.
+    if(lock && Examine(lock, fib))
+    {
+        met->found = true;
+        met->mode = (uint32_t) fib->fib_Protection;
+        met->time = (uint64_t) fib->fib_Date.ds_Days * 86400 +
+                    (uint64_t) fib->fib_Date.ds_Minute * 60 +
+                    (uint64_t) fib->fib_Date.ds_Tick / TICKS_PER_SECOND;
+
+        // ST_FILE (-3) ST_LINKFILE (-4)
+        if(fib->fib_DirEntryType < 0)
+        {
+            met->type = LG_FILE;
+            met->size = (uint64_t) fib->fib_Size;
+        }
+        // ST_ROOT (1) ST_USERDIR (2) ST_SOFTLINK (3) ST_LINKDIR (4)
+        else if(fib->fib_DirEntryType > 0)
+        {
+            met->type = LG_DIR;
+        }
+    }
+
+    // Release lock to file, directory or nothing.
+    UnLock(lock);
+    FreeDosObject(DOS_FIB, fib);
+    #else
+    struct stat fst;
+
+    if(stat(name, &fst))
+    {
+        // No such file or directory.
+        return;
+    }
+
+    // A file, a directory or something else.
+    met->found = true;
+    met->mode = (uint32_t) fst.st_mode;
+    met->time = (uint64_t) fst.st_mtime;
+
+    if(S_ISREG(fst.st_mode))
+    {
+        met->type = LG_FILE;
+        met->size = (uint64_t) fst.st_size;
+    }
+    else if(S_ISDIR(fst.st_mode))
+    {
+        met->type = LG_DIR;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_grow
+// Description: Double the number of buckets.
+// Input:       -
+// Return:      bool:   'true' on success, 'false' if out of memory.
+//------------------------------------------------------------------------------
+static bool mc_grow(void)
+{
+    size_t cap = mc.cap ? mc.cap << 1 : MC_INIT;
+    struct mnode_t **tab = DBG_ALLOC(calloc(cap, sizeof(struct mnode_t *)));
+
+    if(!tab)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    // Move all entries to their new buckets.
+    for(size_t i = 0; i < mc.cap; i++)
+    {
+        for(struct mnode_t *nod = mc.tab[i], *nxt; nod; nod = nxt)
+        {
+            nxt = nod->next;
+            nod->next = tab[nod->hash & (cap - 1)];
+            tab[nod->hash & (cap - 1)] = nod;
+        }
+    }
+
+    free(mc.tab);
+    mc.tab = tab;
+    mc.cap = cap;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_find
+// Description: Find entry in cache.
+// Input:       const char *key:    Key.
+//              size_t len:         Length of key.
+//              uint32_t hash:      Hash of key.
+// Return:      struct mnode_t *:   Entry or NULL if not found.
+//------------------------------------------------------------------------------
+static struct mnode_t *mc_find(const char *key, size_t len, uint32_t hash)
+{
+    if(!mc.cap)
+    {
+        // Nothing cached yet.
+        return NULL;
+    }
+
+    for(struct mnode_t *nod = mc.tab[hash & (mc.cap - 1)]; nod;
+        nod = nod->next)
+    {
+        if(nod->hash == hash && mc_same(nod, key, len))
+        {
+            return nod;
+        }
+    }
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_put
+// Description: Add entry to cache or update existing entry.
+// Input:       const char *key:        Key.
+//              size_t len:             Length of key.
+//              uint32_t hash:          Hash of key.
+//              struct meta_t *met:     File information.
+//              bool part:              Only the type is known.
+// Return:      -
+//------------------------------------------------------------------------------
+static void mc_put(const char *key, size_t len, uint32_t hash,
+                   struct meta_t *met, bool part)
+{
+    struct mnode_t *nod = mc_find(key, len, hash);
+
+    if(nod)
+    {
+        // Replace what we had.
+        nod->met = *met;
+        nod->part = part;
+        return;
+    }
+
+    if(mc.num >= MC_MAX)
+    {
+        // Start over rather than keeping track of what's old.
+        mc_clear();
+    }
+
+    if(mc.num >= mc.cap && !mc_grow())
+    {
+        // Out of memory, just don't cache.
+        return;
+    }
+
+    nod = DBG_ALLOC(malloc(sizeof(struct mnode_t) + len + 1));
+
+    if(!nod)
+    {
+        // Out of memory, just don't cache.
+        return;
+    }
+
+    memcpy(nod + 1, key, len);
+    ((char *) (nod + 1))[len] = '\0';
+    nod->hash = hash;
+    nod->len = len;
+    nod->part = part;
+    nod->met = *met;
+    nod->next = mc.tab[hash & (mc.cap - 1)];
+    mc.tab[hash & (mc.cap - 1)] = nod;
+    mc.num++;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_look
+// Description: Get file information, from the cache if possible. A trailing
+//              slash is not part of the key, refer to mc_key(), but with one
+//              only directories are found, just like the file system does.
+// Input:       const char *name:       Path.
+//              struct meta_t *met:     Result.
+//              bool neg:               Trust cached misses.
+// Return:      -
+//------------------------------------------------------------------------------
+static void mc_look(const char *name, struct meta_t *met, bool neg)
+{
+    const char *key = name;
+    size_t len = mc_key(&key);
+    uint32_t hash = mc_hash(key, len);
+    struct mnode_t *nod = mc_find(key, len, hash);
+    bool dir = key[len] == '/';
+
+    if(nod && !nod->part && (neg || nod->met.found))
+    {
+        // We've been here before.
+        *met = nod->met;
+        mc.hit++;
+    }
+    else
+    {
+        mc.mis++;
+        mc_fetch(name, met);
+
+        // "file/" isn't there, but "file" might be.
+        if(met->found || !dir)
+        {
+            mc_put(key, len, hash, met, false);
+        }
+    }
+
+    if(dir && met->type != LG_DIR)
+    {
+        // Not a directory, nothing found.
+        memset(met, 0, sizeof(struct meta_t));
+        met->type = LG_NONE;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_get
+// Description: Get file information, from the cache if possible. Missing files
+//              are cached as well.
+// Input:       const char *name:       Path.
+//              struct meta_t *met:     Result.
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_get(const char *name, struct meta_t *met)
+{
+    mc_look(name, met, true);
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_check
+// Description: Get file information like mc_get(), but ask the file system
+//              again about files that were missing. Used when the script asks,
+//              it might be waiting for another program to create something.
+// Input:       const char *name:       Path.
+//              struct meta_t *met:     Result.
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_check(const char *name, struct meta_t *met)
+{
+    mc_look(name, met, false);
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_isdir
+// Description: Check if path is known to be a directory, without asking the
+//              file system.
+// Input:       const char *name:   Path.
+// Return:      bool:               'true' if known to be a directory, 'false'
+//                                  if not, or if we don't know.
+//------------------------------------------------------------------------------
+bool mc_isdir(const char *name)
+{
+    const char *key = name;
+    size_t len = mc_key(&key);
+    struct mnode_t *nod = mc_find(key, len, mc_hash(key, len));
+
+    if(nod && nod->met.type == LG_DIR)
+    {
+        mc.hit++;
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_made
+// Description: Check if path is a directory created by us, that hasn't been
+//              looked at since. Such directories are empty, unless someone
+//              else has been busy.
+// Input:       const char *name:   Path.
+// Return:      bool:               'true' if created by us, 'false' if not.
+//------------------------------------------------------------------------------
+bool mc_made(const char *name)
+{
+    const char *key = name;
+    size_t len = mc_key(&key);
+    struct mnode_t *nod = mc_find(key, len, mc_hash(key, len));
+
+    return nod && nod->part;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_mkdir
+// Description: Tell the cache about a directory that we have created. Only
+//              the type is remembered, anything else will be fetched if
+//              needed.
+// Input:       const char *name:   Path.
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_mkdir(const char *name)
+{
+    const char *key = name;
+    size_t len = mc_key(&key);
+    struct meta_t met = { .found = true, .type = LG_DIR };
+
+    mc.gen++;
+    mc_put(key, len, mc_hash(key, len), &met, true);
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_drop
+// Description: Forget about file or directory, it has been changed, created or
+//              deleted. Renamed and deleted directories take what's in them
+//              with them, use mc_clear() for those.
+// Input:       const char *name:   Path.
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_drop(const char *name)
+{
+    mc.gen++;
+
+    if(!name || !mc.num)
+    {
+        // Nothing to do.
+        return;
+    }
+
+    const char *key = name;
+    size_t len = mc_key(&key);
+    uint32_t hash = mc_hash(key, len);
+
+    for(struct mnode_t **ref = mc.tab + (hash & (mc.cap - 1)); *ref;
+        ref = &(*ref)->next)
+    {
+        struct mnode_t *nod = *ref;
+
+        if(nod->hash == hash && mc_same(nod, key, len))
+        {
+            // Keys are unique.
+            *ref = nod->next;
+            free(nod);
+            mc.num--;
+            return;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_clear
+// Description: Forget everything. Used when we don't know what has changed,
+//              e.g after running external commands.
+// Input:       -
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_clear(void)
+{
+    mc.gen++;
+
+    for(size_t i = 0; i < mc.cap; i++)
+    {
+        for(struct mnode_t *nod = mc.tab[i], *nxt; nod; nod = nxt)
+        {
+            nxt = nod->next;
+            free(nod);
+        }
+
+        mc.tab[i] = NULL;
+    }
+
+    mc.num = 0;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_gen
+// Description: Get the number of changes reported so far. If it's the same as
+//              before, nothing has been changed by us in between.
+// Input:       -
+// Return:      uint64_t:   Number of changes.
+//------------------------------------------------------------------------------
+uint64_t mc_gen(void)
+{
+    return mc.gen;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_stats
+// Description: Get the number of lookups answered by the cache and the number
+//              of lookups that needed the file system.
+// Input:       uint64_t *hit:  Number of hits.
+//              uint64_t *mis:  Number of misses.
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_stats(uint64_t *hit, uint64_t *mis)
+{
+    *hit = mc.hit;
+    *mis = mc.mis;
+}
+
+//------------------------------------------------------------------------------
+// Name:        mc_free
+// Description: Free all resources used by the cache.
+// Input:       -
+// Return:      -
+//------------------------------------------------------------------------------
+void mc_free(void)
+{
+    mc_clear();
+    free(mc.tab);
+    memset(&mc, 0, sizeof(mc));
+}
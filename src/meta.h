@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// meta.h:
+//
+// File information cache, valid for the duration of a run.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef META_H_
+#define META_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// File information. The type is LG_FILE / LG_DIR / LG_NONE, 'found' tells if
+// there is anything at all, the type of devices and such is LG_NONE. The mode
+// is the st_mode on POSIX systems and the protection bits on Amiga. The size
+// is only valid for files and the time is in seconds.
+//------------------------------------------------------------------------------
+struct meta_t
+{
+    bool found;
+    int32_t type;
+    uint32_t mode;
+    uint64_t size;
+    uint64_t time;
+};
+
+void mc_get(const char *name, struct meta_t *met);
+void mc_check(const char *name, struct meta_t *met);
+bool mc_isdir(const char *name);
+bool mc_made(const char *name);
+void mc_mkdir(const char *name);
+void mc_drop(const char *name);
+void mc_clear(void);
+uint64_t mc_gen(void);
+void mc_stats(uint64_t *hit, uint64_t *mis);
+void mc_free(void);
+
+#endif
@@ -23,9 +23,10 @@
 /* We need the parser to be reentrant. It will leak memory otherwise.                                                                                                                   */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 %define api.pure full
+%define parse.error verbose
 %lex-param   { yyscan_t scanner }
 %parse-param { yyscan_t scanner }
-%expect 8
+%expect 1
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Primitives                                                                                                                                                                           */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
@@ -56,7 +57,7 @@
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Token data types                                                                                                                                                                     */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-%type<e> /* all nodes    */ start s p pp ps pps ivp vp vps dynopt opt opts xpb xpbs np sps par cv cvv add sub lt lte neq gt gte eq set cus dcl fmt if while until and or xor not bitand
+%type<e> /* all nodes    */ start top tps s p pp ps pps ivp vp vps dynopt opt opts xopt xpb xpbs np sps par cv cvv add sub lt lte neq gt gte eq set cus dcl fmt if while until and or xor not bitand
        /*                */ bitor bitxor bitnot shiftleft shiftright in strlen substr askdir askfile askstring asknumber askchoice askoptions askbool askdisk cat exists expandpath
        /*                */ earlier fileonly getassign getdefaulttool getposition getstack gettooltype getdevice getdiskspace getenv getsize getsum getversion iconinfo querydisplay
        /*                */ pathonly patmatch div select symbolset symbolval tackon transcript complete user working welcome abort copyfiles copylib database debug delete execute exit
@@ -69,10 +70,12 @@
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Use the destructor of the start symbol to set of the execution of the program.                                                                                                       */
 %destructor { run($$);  }   start
+/* The root is stopped instead of run if the script can't be parsed completely, something might have been executed already.                                                             */
+%destructor { stop($$); }   top
 /* Primitive strings are freed like you would expect                                                                                                                                    */
 %destructor { free($$); }   SYM STR
 /* Complex types are freed using the kill() function found in alloc.c                                                                                                                   */
-%destructor { kill($$); }   s p pp ps pps ivp vp vps dynopt opt opts xpb xpbs np sps par cv cvv add sub div mul gt gte eq set cus dcl fmt if while until and or xor not bitand bitor
+%destructor { kill($$); }   tps s p pp ps pps ivp vp vps dynopt opt opts xopt xpb xpbs np sps par cv cvv add sub div mul gt gte eq set cus dcl fmt if while until and or xor not bitand bitor
                             bitxor bitnot shiftleft shiftright in strlen substr askdir askfile askstring asknumber askchoice askoptions askbool askdisk exists expandpath earlier
                             fileonly getassign pattern getdefaulttool getposition getstack gettooltype optional resident override source getdevice getdiskspace getenv getsize getsum
                             getversion iconinfo querydisplay pathonly patmatch select symbolset symbolval tackon transcript complete user working welcome abort copyfiles copylib
@@ -84,7 +87,12 @@
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Start                                                                                                                                                                                */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-start:          s                                { $$ = init($1); };
+start:          top                              { $$ = stream($1, NULL); };
+top:            top tps                          { $$ = stream($1, $2); } |
+                tps                              { $$ = stream(NULL, $1); };
+tps:            vp                               { $$ = push(new_contxt(), $1); } |
+                opt                              { $$ = push(new_contxt(), $1); } |
+                '(' vps ')'                      { $$ = $2; };
 s:              vps                              ;
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 /* Phrase types                                                                                                                                                                         */
@@ -94,18 +102,24 @@ p:              vp                               |
 pp:             p p                              { $$ = push(push(new_contxt(), $1), $2); };
 ps:             ps p                             { $$ = push($1, $2); } |
                 p                                { $$ = push(new_contxt(), $1); };
-pps:            pps pp                           { $$ = merge($1, $2); } |
+pps:            pps p p                          { $$ = push(push($1, $2), $3); } |
                 pp                               ;
 vp:             ivp                              |
                 '(' vp ')'                       { $$ = $2; };
-vps:            vps vps                          { $$ = merge($1, $2); } |
-                vps opts                         { $$ = merge($1, $2);  } |
-                opts vps                         { $$ = merge($1, $2);  } |
+vps:            vps vp                           { $$ = push($1, $2); } |
+                vps opt                          { $$ = push($1, $2); } |
+                vps '(' vps ')'                  { $$ = merge($1, $3); } |
+                vps '(' opts ')'                 { $$ = merge($1, $3); } |
+                opts vp                          { $$ = push($1, $2); } |
+                opts '(' vps ')'                 { $$ = merge($1, $3); } |
                 vp                               { $$ = push(new_contxt(), $1); } |
                 '(' vps ')'                      { $$ = $2; };
-opts:           opts opts                        { $$ = merge($1, $2); } |
+opts:           opts opt                         { $$ = push($1, $2); } |
+                opts '(' opts ')'                { $$ = merge($1, $3); } |
                 opt                              { $$ = push(new_contxt(), $1); } |
                 '(' opts ')'                     { $$ = $2; };
+xopt:           opt                              { $$ = push(new_contxt(), $1); } |
+                '(' opts ')'                     { $$ = $2; };
 xpb:            '(' vps ')'                      { $$ = $2; } |
                 '(' vps np ')'                   { $$ = push($2, $3); } |
                 p                                { $$ = push(new_contxt(), $1); };
@@ -348,26 +362,26 @@ delete:         '(' DELETE ps opts')'            { $$ = new_native(strdup("delet
                 '(' DELETE opts ps opts ')'      { $$ = new_native(strdup("delete"), LINE, n_delete, merge($4, merge($3, $5)), NUMBER); } |
                 '(' DELETE ps ')'                { $$ = new_native(strdup("delete"), LINE, n_delete, $3, NUMBER); };
 exists:         '(' EXISTS p ')'                 { $$ = new_native(strdup("exists"), LINE, n_exists, push(new_contxt(), $3), NUMBER); } |
-                '(' EXISTS p opts ')'            { $$ = new_native(strdup("exists"), LINE, n_exists, merge(push(new_contxt(), $3), $4), NUMBER); } |
-                '(' EXISTS opts p ')'            { $$ = new_native(strdup("exists"), LINE, n_exists, merge(push(new_contxt(), $4), $3), NUMBER); };
+                '(' EXISTS p opts ')'            { $$ = new_native(strdup("exists"), LINE, n_exists, unshift($4, $3), NUMBER); } |
+                '(' EXISTS opts p ')'            { $$ = new_native(strdup("exists"), LINE, n_exists, unshift($3, $4), NUMBER); };
 fileonly:       '(' FILEONLY p ')'               { $$ = new_native(strdup("fileonly"), LINE, n_fileonly, push(new_contxt(), $3), STRING); };
 foreach:        '(' FOREACH pp vps ')'           { $$ = new_native(strdup("foreach"), LINE, n_foreach, push($3, $4), NUMBER); };
 makeassign:     '(' MAKEASSIGN pp safe ')'       { $$ = new_native(strdup("makeassign"), LINE, n_makeassign, push($3, $4), NUMBER); } |
                 '(' MAKEASSIGN pp ')'            { $$ = new_native(strdup("makeassign"), LINE, n_makeassign, $3, NUMBER); } |
                 '(' MAKEASSIGN p safe ')'        { $$ = new_native(strdup("makeassign"), LINE, n_makeassign, push(push(new_contxt(), $3), $4), NUMBER); } |
                 '(' MAKEASSIGN p ')'             { $$ = new_native(strdup("makeassign"), LINE, n_makeassign, push(new_contxt(), $3), NUMBER); };
-makedir:        '(' MAKEDIR p opts')'            { $$ = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), $3), $4), NUMBER); } |
-                '(' MAKEDIR opts p ')'           { $$ = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), $4), $3), NUMBER); } |
-                '(' MAKEDIR opts p opts ')'      { $$ = new_native(strdup("makedir"), LINE, n_makedir, merge(push(new_contxt(), $4), merge($3, $5)), NUMBER); } |
+makedir:        '(' MAKEDIR p opts')'            { $$ = new_native(strdup("makedir"), LINE, n_makedir, unshift($4, $3), NUMBER); } |
+                '(' MAKEDIR opts p ')'           { $$ = new_native(strdup("makedir"), LINE, n_makedir, unshift($3, $4), NUMBER); } |
+                '(' MAKEDIR opts p opts ')'      { $$ = new_native(strdup("makedir"), LINE, n_makedir, unshift(merge($3, $5), $4), NUMBER); } |
                 '(' MAKEDIR p ')'                { $$ = new_native(strdup("makedir"), LINE, n_makedir, push(new_contxt(), $3), NUMBER); };
 protect:        '(' PROTECT pp opts ')'          { $$ = new_native(strdup("protect"), LINE, n_protect, merge($3, $4), NUMBER); } |
                 '(' PROTECT pp ')'               { $$ = new_native(strdup("protect"), LINE, n_protect, $3, NUMBER); } |
-                '(' PROTECT p opts ')'           { $$ = new_native(strdup("protect"), LINE, n_protect, merge(push(new_contxt(), $3), $4), NUMBER); } |
+                '(' PROTECT p opts ')'           { $$ = new_native(strdup("protect"), LINE, n_protect, unshift($4, $3), NUMBER); } |
                 '(' PROTECT p ')'                { $$ = new_native(strdup("protect"), LINE, n_protect, push(new_contxt(), $3), NUMBER); };
-startup:        '(' STARTUP p opts ')'           { $$ = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), $3), $4), NUMBER); } |
-                '(' STARTUP opts p ')'           { $$ = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), $4), $3), NUMBER); } |
-                '(' STARTUP opts p opts ')'      { $$ = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), $4), merge($3, $5)), NUMBER); } |
-                '(' STARTUP opts ')'             { $$ = new_native(strdup("startup"), LINE, n_startup, merge(push(new_contxt(), new_symref(strdup("@app-name"), LINE)), $3), NUMBER); };
+startup:        '(' STARTUP p opts ')'           { $$ = new_native(strdup("startup"), LINE, n_startup, unshift($4, $3), NUMBER); } |
+                '(' STARTUP opts p ')'           { $$ = new_native(strdup("startup"), LINE, n_startup, unshift($3, $4), NUMBER); } |
+                '(' STARTUP opts p opts ')'      { $$ = new_native(strdup("startup"), LINE, n_startup, unshift(merge($3, $5), $4), NUMBER); } |
+                '(' STARTUP opts ')'             { $$ = new_native(strdup("startup"), LINE, n_startup, unshift($3, new_symref(strdup("@app-name"), LINE)), NUMBER); };
 textfile:       '(' TEXTFILE opts ')'            { $$ = new_native(strdup("textfile"), LINE, n_textfile, $3, NUMBER); };
 tooltype:       '(' TOOLTYPE opts ')'            { $$ = new_native(strdup("tooltype"), LINE, n_tooltype, $3, NUMBER); };
 transcript:     '(' TRANSCRIPT ps ')'            { $$ = new_native(strdup("transcript"), LINE, n_transcript, $3, NUMBER); };
@@ -477,9 +491,9 @@ symbolval:      '(' SYMBOLVAL p ')'              { $$ = new_native(strdup("symbo
 /* wb.c|h                                                                                                                                                                               */
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 openwbobject:   '(' OPENWBOBJECT p ')'           { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, push(new_contxt(), $3), NUMBER); } |
-                '(' OPENWBOBJECT p opts ')'      { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), $3), $4), NUMBER); } |
-                '(' OPENWBOBJECT opts p ')'      { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), $4), $3), NUMBER); } |
-                '(' OPENWBOBJECT opts p opts ')' { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, merge(push(new_contxt(), $4), merge($3, $5)), NUMBER); };
+                '(' OPENWBOBJECT p opts ')'      { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift($4, $3), NUMBER); } |
+                '(' OPENWBOBJECT opts p ')'      { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift($3, $4), NUMBER); } |
+                '(' OPENWBOBJECT opts p opts ')' { $$ = new_native(strdup("openwbobject"), LINE, n_openwbobject, unshift(merge($3, $5), $4), NUMBER); };
 showwbobject:   '(' SHOWWBOBJECT p ')'           { $$ = new_native(strdup("showwbobject"), LINE, n_showwbobject, push(new_contxt(), $3), NUMBER); };
 closewbobject:  '(' CLOSEWBOBJECT p ')'          { $$ = new_native(strdup("closewbobject"), LINE, n_closewbobject, push(new_contxt(), $3), NUMBER); };
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
@@ -533,7 +547,7 @@ optional:       '(' OPTIONAL ps ')'              { $$ = new_option(strdup("optio
                 '(' OPTIONAL ')'                 { $$ = new_option(strdup("optional"), OPT_OPTIONAL, push(new_contxt(), new_symref(strdup("@null"), LINE))); };
 resident:       '(' RESIDENT ')'                 { $$ = new_option(strdup("resident"), OPT_RESIDENT, NULL); };
 override:       '(' OVERRIDE p ')'               { $$ = new_option(strdup("override"), OPT_OVERRIDE, push(new_contxt(), $3)); };
-dynopt:         '(' IF p opts ')'                { $$ = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(new_contxt(), $3), $4)); } |
-                '(' IF p opts opts ')'           { $$ = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(push(new_contxt(), $3), $4), $5)); };
+dynopt:         '(' IF p xopt ')'                { $$ = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(new_contxt(), $3), $4)); } |
+                '(' IF p xopt opts ')'           { $$ = new_option(strdup("dynopt"), OPT_DYNOPT, push(push(push(new_contxt(), $3), $4), $5)); };
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 %%
@@ -0,0 +1,373 @@
+//------------------------------------------------------------------------------
+// plan.c:
+//
+// Copy plan, the files and directories handled by (copyfiles). Entries are
+// stored in an array and their paths in a shared string pool, both growing as
+// needed. A destination path shares its tail with the source path and the
+// destination prefix is shared by consecutive entries, most of the time there
+// is only one prefix per plan.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "plan.h"
+#include "types.h"
+#include "util.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Name:        pl_grow
+// Description: Make room for more elements in an array, growing it by at least
+//              a factor of two.
+// Input:       void **mem:     Array.
+//              size_t *max:    Capacity of the array, in elements.
+//              size_t num:     Number of elements needed.
+//              size_t siz:     Size of each element.
+// Return:      bool:           'true' on success, 'false' if out of memory.
+//------------------------------------------------------------------------------
+static bool pl_grow(void **mem, size_t *max, size_t num, size_t siz)
+{
+    if(num <= *max)
+    {
+        // Room enough.
+        return true;
+    }
+
+    size_t nmx = *max ? *max << 1 : 64;
+    nmx = nmx < num ? num : nmx;
+
+    void *new = DBG_ALLOC(calloc(nmx, siz));
+
+    if(!new)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    if(*mem)
+    {
+        memcpy(new, *mem, *max * siz);
+        free(*mem);
+    }
+
+    *mem = new;
+    *max = nmx;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_str
+// Description: Append string to the string pool. Reuse the most recent
+//              destination prefix if the string happens to be the same.
+// Input:       plan_p pln:         Plan.
+//              const char *fst:    First part of the string.
+//              size_t fln:         Length of the first part.
+//              const char *snd:    Second part of the string.
+//              size_t sln:         Length of the second part.
+//              bool pre:           Destination prefix, without second part.
+// Return:      size_t:             Offset in the string pool, or SIZE_MAX if
+//                                  out of memory.
+//------------------------------------------------------------------------------
+static size_t pl_str(plan_p pln, const char *fst, size_t fln, const char *snd,
+                     size_t sln, bool pre)
+{
+    if(pre && pln->len && !strncmp(pln->str + pln->lst, fst, fln) &&
+       !pln->str[pln->lst + fln])
+    {
+        // Same as last time.
+        return pln->lst;
+    }
+
+    size_t off = pln->len, len = off + fln + sln + 1;
+
+    // Offsets are 32 bits wide.
+    if(len > UINT32_MAX || !pl_grow((void **) &pln->str, &pln->cap, len, 1))
+    {
+        return SIZE_MAX;
+    }
+
+    memcpy(pln->str + off, fst, fln);
+
+    if(sln)
+    {
+        memcpy(pln->str + off + fln, snd, sln);
+    }
+
+    pln->str[len - 1] = '\0';
+    pln->len = len;
+
+    if(pre)
+    {
+        // Candidate for reuse.
+        pln->lst = (uint32_t) off;
+    }
+
+    return off;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_tail
+// Description: Get the length of the longest common tail of two strings.
+// Input:       const char *fst:    First string.
+//              size_t fln:         Length of the first string.
+//              const char *snd:    Second string.
+//              size_t sln:         Length of the second string.
+// Return:      size_t:             Length of the common tail.
+//------------------------------------------------------------------------------
+static size_t pl_tail(const char *fst, size_t fln, const char *snd, size_t sln)
+{
+    size_t tln = 0;
+
+    while(tln < fln && tln < sln && fst[fln - tln - 1] == snd[sln - tln - 1])
+    {
+        tln++;
+    }
+
+    return tln;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_add
+// Description: Add entry to plan. The source path is the source prefix
+//              followed by the tail, and the destination path is the
+//              destination prefix followed by the tail. Without a tail, full
+//              paths are expected, and as much as possible is shared. The
+//              strings must not be part of the plan.
+// Input:       plan_p pln:         Plan.
+//              const char *spre:   Source prefix.
+//              const char *dpre:   Destination prefix.
+//              const char *tail:   Tail of both paths.
+//              int32_t type:       LG_FILE / LG_DIR / LG_NONE.
+// Return:      bool:               'true' on success, 'false' if out of
+//                                  memory.
+//------------------------------------------------------------------------------
+bool pl_add(plan_p pln, const char *spre, const char *dpre, const char *tail,
+            int32_t type)
+{
+    if(!pl_grow((void **) &pln->ent, &pln->max, pln->num + 1,
+                sizeof(struct pent_t)))
+    {
+        // Out of memory.
+        return false;
+    }
+
+    size_t sln = strlen(spre), dln = strlen(dpre), tln = strlen(tail);
+
+    if(!tln)
+    {
+        // Full paths, find the tail.
+        tln = pl_tail(spre, sln, dpre, dln);
+        sln -= tln;
+        dln -= tln;
+        tail = spre + sln;
+    }
+
+    size_t pre = pl_str(pln, dpre, dln, NULL, 0, true),
+           src = pre == SIZE_MAX ? pre : pl_str(pln, spre, sln, tail, tln,
+                                                false);
+
+    if(src == SIZE_MAX)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    struct pent_t *ent = pln->ent + pln->num++;
+
+    ent->src = (uint32_t) src;
+    ent->pre = (uint32_t) pre;
+    ent->sfx = (uint32_t) sln;
+    ent->type = type;
+
+    // Keep track of the longest destination, refer to pl_dst().
+    pln->dln = dln + tln > pln->dln ? dln + tln : pln->dln;
+    pln->fil += type == LG_FILE ? 1 : 0;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_set
+// Description: Set the destination path of an entry. The string must not be
+//              part of the plan.
+// Input:       plan_p pln:         Plan.
+//              size_t ndx:         Entry.
+//              const char *dst:    Destination path.
+// Return:      bool:               'true' on success, 'false' if out of
+//                                  memory.
+//------------------------------------------------------------------------------
+bool pl_set(plan_p pln, size_t ndx, const char *dst)
+{
+    char *src = pl_src(pln, ndx);
+    size_t dln = strlen(dst), sln = strlen(src),
+           tln = pl_tail(src, sln, dst, dln),
+           pre = pl_str(pln, dst, dln - tln, NULL, 0, true);
+
+    if(pre == SIZE_MAX)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    pln->ent[ndx].pre = (uint32_t) pre;
+    pln->ent[ndx].sfx = (uint32_t) (sln - tln);
+    pln->dln = dln > pln->dln ? dln : pln->dln;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_src
+// Description: Get the source path of an entry.
+// Input:       plan_p pln:     Plan.
+//              size_t ndx:     Entry.
+// Return:      char *:         Source path, valid until the plan grows.
+//------------------------------------------------------------------------------
+char *pl_src(plan_p pln, size_t ndx)
+{
+    return pln->str + pln->ent[ndx].src;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_dst
+// Description: Get the destination path of an entry.
+// Input:       plan_p pln:     Plan.
+//              size_t ndx:     Entry.
+//              char *buf:      Buffer, with room for at least pln->dln + 1
+//                              characters, or NULL to use a buffer owned by
+//                              the plan, valid until the next call.
+// Return:      char *:         Destination path, or NULL if out of memory.
+//------------------------------------------------------------------------------
+char *pl_dst(plan_p pln, size_t ndx, char *buf)
+{
+    if(!buf)
+    {
+        if(pln->tln <= pln->dln)
+        {
+            // The longest destination has grown since last time.
+            free(pln->tmp);
+            pln->tmp = DBG_ALLOC(calloc(pln->dln + 1, 1));
+            pln->tln = pln->tmp ? pln->dln + 1 : 0;
+        }
+
+        buf = pln->tmp;
+
+        if(!buf)
+        {
+            // Out of memory.
+            return NULL;
+        }
+    }
+
+    const char *pre = pln->str + pln->ent[ndx].pre,
+               *tail = pln->str + pln->ent[ndx].src + pln->ent[ndx].sfx;
+    size_t len = strlen(pre);
+
+    memcpy(buf, pre, len);
+    strcpy(buf + len, tail);
+    return buf;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_files
+// Description: Get the number of files in the plan.
+// Input:       plan_p pln:     Plan.
+// Return:      size_t:         Number of entries added as LG_FILE.
+//------------------------------------------------------------------------------
+size_t pl_files(plan_p pln)
+{
+    return pln->fil;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_size
+// Description: Add the size of a file to the plan, used for progress only.
+// Input:       plan_p pln:     Plan.
+//              uint64_t siz:   Size in bytes.
+// Return:      -
+//------------------------------------------------------------------------------
+void pl_size(plan_p pln, uint64_t siz)
+{
+    pln->byt += siz;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_bytes
+// Description: Get the total size of the files in the plan.
+// Input:       plan_p pln:     Plan.
+// Return:      uint64_t:       Sum of the sizes added by pl_size().
+//------------------------------------------------------------------------------
+uint64_t pl_bytes(plan_p pln)
+{
+    return pln->byt;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_start
+// Description: Prepare iteration over all entries. Used by the GUI.
+// Input:       struct pitr_t *itr: Iterator.
+//              plan_p pln:         Plan.
+// Return:      -
+//------------------------------------------------------------------------------
+void pl_start(struct pitr_t *itr, plan_p pln)
+{
+    itr->pln = pln;
+    itr->ndx = 0;
+    itr->name = NULL;
+    itr->type = NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_next
+// Description: Move to the next entry. The source path and the type of the
+//              entry are available through the iterator. The type may be
+//              changed.
+// Input:       struct pitr_t *itr: Iterator.
+// Return:      bool:               'true' if there was an entry, 'false' if
+//                                  there are no more entries.
+//------------------------------------------------------------------------------
+bool pl_next(struct pitr_t *itr)
+{
+    if(!itr->pln || itr->ndx >= itr->pln->num)
+    {
+        // We're done.
+        return false;
+    }
+
+    itr->name = pl_src(itr->pln, itr->ndx);
+    itr->type = &itr->pln->ent[itr->ndx++].type;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_clear
+// Description: Remove all entries from the plan but keep the memory, so that
+//              the plan can be filled again without allocating.
+// Input:       plan_p pln:     Plan.
+// Return:      -
+//------------------------------------------------------------------------------
+void pl_clear(plan_p pln)
+{
+    pln->num = 0;
+    pln->len = 0;
+    pln->dln = 0;
+    pln->fil = 0;
+    pln->byt = 0;
+    pln->lst = 0;
+}
+
+//------------------------------------------------------------------------------
+// Name:        pl_free
+// Description: Free all resources used by the plan. The plan itself is left
+//              empty and can be used again.
+// Input:       plan_p pln:     Plan.
+// Return:      -
+//------------------------------------------------------------------------------
+void pl_free(plan_p pln)
+{
+    free(pln->ent);
+    free(pln->str);
+    free(pln->tmp);
+    memset(pln, 0, sizeof(struct plan_t));
+}
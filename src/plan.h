@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// plan.h:
+//
+// Copy plan, the files and directories handled by (copyfiles).
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef PLAN_H_
+#define PLAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// Plan entry. The source path is stored in full in the string pool. The
+// destination path is a prefix followed by the tail of the source path, the
+// part of the source path starting at 'sfx'.
+//------------------------------------------------------------------------------
+struct pent_t
+{
+    uint32_t src;
+    uint32_t pre;
+    uint32_t sfx;
+    int32_t type;
+};
+
+//------------------------------------------------------------------------------
+// Plan, an array of entries and the string pool they refer to.
+//------------------------------------------------------------------------------
+struct plan_t
+{
+    struct pent_t *ent;
+    size_t num;
+    size_t max;
+    char *str;
+    size_t len;
+    size_t cap;
+    size_t dln;
+    size_t fil;
+    uint64_t byt;
+    uint32_t lst;
+    char *tmp;
+    size_t tln;
+};
+
+typedef struct plan_t * plan_p;
+
+//------------------------------------------------------------------------------
+// Copy progress. Sizes in bytes, rates in bytes per second and the estimated
+// time left in seconds, -1 if not known yet.
+//------------------------------------------------------------------------------
+struct cprog_t
+{
+    uint64_t cur;
+    uint64_t max;
+    uint64_t rat;
+    uint64_t avg;
+    int32_t eta;
+};
+
+//------------------------------------------------------------------------------
+// Plan iterator.
+//------------------------------------------------------------------------------
+struct pitr_t
+{
+    plan_p pln;
+    size_t ndx;
+    const char *name;
+    int32_t *type;
+};
+
+bool pl_add(plan_p pln, const char *spre, const char *dpre, const char *tail,
+            int32_t type);
+bool pl_set(plan_p pln, size_t ndx, const char *dst);
+char *pl_src(plan_p pln, size_t ndx);
+char *pl_dst(plan_p pln, size_t ndx, char *buf);
+size_t pl_files(plan_p pln);
+void pl_size(plan_p pln, uint64_t siz);
+uint64_t pl_bytes(plan_p pln);
+void pl_start(struct pitr_t *itr, plan_p pln);
+bool pl_next(struct pitr_t *itr);
+void pl_clear(plan_p pln);
+void pl_free(plan_p pln);
+
+#endif
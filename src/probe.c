@@ -12,13 +12,24 @@
 #include "eval.h"
 #include "file.h"
 #include "gui.h"
+#include "meta.h"
 #include "probe.h"
 #include "util.h"
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+#include <sys/statvfs.h>
+#include <sys/utsname.h>
+#endif
+
 #ifdef AMIGA
 #include <dos/dos.h>
 #include <dos/dosextens.h>
@@ -44,6 +55,186 @@
 typedef enum {NONE, PPC, ARM, M68000, M68010, M68020, M68030, M68040, M68060,
               X86, X86_64} cpu_t;
 
+#if !defined(AMIGA) && !defined(__MINGW32__)
+//------------------------------------------------------------------------------
+// What we know about the host when @host-probe is set. CPU, OS and memory are
+// probed once per run. Free disk space is remembered per path until we change
+// something in the file system.
+//------------------------------------------------------------------------------
+struct cspace_t
+{
+    struct cspace_t *nxt;
+    char *path;
+    uint64_t gen;
+    long long free;
+};
+
+static struct chost_t
+{
+    bool use, done;
+    cpu_t cpu;
+    char os[sizeof(((struct utsname *) NULL)->sysname)];
+    int32_t mem;
+    struct cspace_t *spc;
+} hst;
+
+//------------------------------------------------------------------------------
+// Name:        h_host_cpu
+// Description: Get CPU ID from machine name, as reported by uname().
+// Input:       const char *mch:    Machine name.
+// Return:      cpu_t:              Host CPU architecture ID.
+//------------------------------------------------------------------------------
+static cpu_t h_host_cpu(const char *mch)
+{
+    if(!strcmp(mch, "x86_64") || !strcmp(mch, "amd64"))
+    {
+        return X86_64;
+    }
+
+    if(!strcmp(mch, "x86") || (mch[0] == 'i' && strstr(mch, "86")))
+    {
+        return X86;
+    }
+
+    if(!strncmp(mch, "ppc", 3) || !strncmp(mch, "powerpc", 7) ||
+       !strncmp(mch, "Power", 5))
+    {
+        return PPC;
+    }
+
+    if(!strncmp(mch, "arm", 3) || !strncmp(mch, "aarch64", 7))
+    {
+        return ARM;
+    }
+
+    // The exact model isn't known.
+    return !strcmp(mch, "m68k") ? M68000 : NONE;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_host_probe
+// Description: Probe CPU, OS and free memory, once per run, if @host-probe is
+//              set. If not, dummy values are used.
+// Input:       entry_p contxt:     The execution context.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_host_probe(entry_p contxt)
+{
+    hst.use = get_num(contxt, "@host-probe");
+
+    if(!hst.use || hst.done)
+    {
+        // We've been here before.
+        return;
+    }
+
+    struct utsname uts;
+    hst.done = true;
+
+    if(!uname(&uts))
+    {
+        hst.cpu = h_host_cpu(uts.machine);
+        snprintf(hst.os, sizeof(hst.os), "%s", uts.sysname);
+    }
+    else
+    {
+        snprintf(hst.os, sizeof(hst.os), "%s", "Unknown OS");
+    }
+
+    // Same as the dummy value if we don't know better.
+    hst.mem = (int32_t) 1 << 20;
+
+    #if defined(__linux__)
+    FILE *file = fopen("/proc/meminfo", "r");
+
+    if(file)
+    {
+        char lin[128];
+        long long kib = -1, fre = -1;
+
+        // Available if the kernel is new enough, otherwise free memory.
+        while(fgets(lin, sizeof(lin), file))
+        {
+            if(sscanf(lin, "MemAvailable: %lld", &kib) != 1)
+            {
+                (void) sscanf(lin, "MemFree: %lld", &fre);
+            }
+        }
+
+        fclose(file);
+        kib = kib < 0 ? fre : kib;
+
+        if(kib >= 0)
+        {
+            // Cap the value.
+            hst.mem = kib > INT_MAX >> 10 ? INT_MAX : (int32_t) (kib << 10);
+        }
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_host_space
+// Description: Get free disk space of the file system that a path belongs to.
+//              The answer stays valid until the file system has been changed
+//              by us, scripts asking over and over again won't have to wait
+//              for the file system.
+// Input:       const char *name:   Path.
+//              long long *siz:     Free space in bytes.
+// Return:      bool:               'true' on success, 'false' on error.
+//------------------------------------------------------------------------------
+static bool h_host_space(const char *name, long long *siz)
+{
+    struct cspace_t *cur = hst.spc;
+
+    while(cur && strcmp(cur->path, name))
+    {
+        cur = cur->nxt;
+    }
+
+    if(cur && cur->gen == mc_gen())
+    {
+        // Nothing has changed.
+        *siz = cur->free;
+        return true;
+    }
+
+    struct statvfs svf;
+
+    if(statvfs(name, &svf))
+    {
+        // No such file or directory or no file system information.
+        return false;
+    }
+
+    // Space available to us, not to the superuser.
+    *siz = (long long) svf.f_bavail * (long long) svf.f_frsize;
+
+    if(!cur && (cur = DBG_ALLOC(calloc(1, sizeof(struct cspace_t)))) != NULL)
+    {
+        cur->path = DBG_ALLOC(strdup(name));
+
+        if(!cur->path)
+        {
+            // Out of memory, don't remember this one.
+            free(cur);
+            return true;
+        }
+
+        cur->nxt = hst.spc;
+        hst.spc = cur;
+    }
+
+    if(cur)
+    {
+        cur->gen = mc_gen();
+        cur->free = *siz;
+    }
+
+    return true;
+}
+#endif
+
 #if defined(__MORPHOS__) && !defined(LG_TEST)
 //------------------------------------------------------------------------------
 // Name:        h_cpu_id
@@ -174,6 +365,14 @@ static cpu_t h_cpu_id(void)
 //------------------------------------------------------------------------------
 static cpu_t h_cpu_id(void)
 {
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    if(hst.use)
+    {
+        // Asked for, refer to h_host_probe().
+        return hst.cpu;
+    }
+    #endif
+
     // In test mode / on non Amigas we shouldn't report anything but 'Unknown'.
     // Doing so would create dependencies between test results and host system.
     return NONE;
@@ -219,6 +418,14 @@ static char *h_os_name(void)
     // Use AmigaOS as fallback.
     return "AmigaOS";
     #else
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    if(hst.use)
+    {
+        // Asked for, refer to h_host_probe().
+        return hst.os;
+    }
+    #endif
+
     // In test mode / on non Amigas we shouldn't report anything but 'Unknown'.
     // Doing so would create dependencies between test results and host system.
     return "Unknown OS";
@@ -233,6 +440,14 @@ static char *h_os_name(void)
 //------------------------------------------------------------------------------
 static int32_t h_chipmem(void)
 {
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    if(hst.use)
+    {
+        // There's no memory of its own for graphics, it's all the same.
+        return hst.mem;
+    }
+    #endif
+
     return
     #if defined(AMIGA) && !defined(LG_TEST)
     AvailMem(MEMF_CHIP);
@@ -252,6 +467,14 @@ static int32_t h_chipmem(void)
 //------------------------------------------------------------------------------
 static int32_t h_totalmem(void)
 {
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    if(hst.use)
+    {
+        // Asked for, refer to h_host_probe().
+        return hst.mem;
+    }
+    #endif
+
     return
     #if defined(AMIGA) && !defined(LG_TEST)
     AvailMem(MEMF_ANY);
@@ -277,6 +500,11 @@ entry_p n_database(entry_p contxt)
 
     char *feat = str(C_ARG(1));
 
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    // Real or dummy values.
+    h_host_probe(contxt);
+    #endif
+
     if(strcasecmp(feat, "cpu") == 0)
     {
         // Get host CPU name.
@@ -568,20 +796,21 @@ entry_p n_getdevice(entry_p contxt)
 }
 
 //------------------------------------------------------------------------------
-// (getdiskspace <pathname> [<unit>])                                    (V44)
-//     return available space
-//
-// Refer to Installer.guide 1.20 (25.10.1999) 1995-99 by Amiga Inc.
+// Name:        h_diskspace
+// Description: Get free disk space of the volume / file system that a path
+//              belongs to. Used by n_getdiskspace and by (copyfiles) before
+//              copying anything.
+// Input:       const char *name:   Path.
+//              long long *siz:     Free space in bytes.
+// Return:      bool:               'true' on success, 'false' on error or if
+//                                  not supported.
 //------------------------------------------------------------------------------
-entry_p n_getdiskspace(entry_p contxt)
+bool h_diskspace(const char *name, long long *siz)
 {
-    // We need a path.
-    C_SANE(1, NULL);
-
     #if defined(AMIGA) && !defined(LG_TEST)
     // Attempt to lock path.
-    const char *n = str(C_ARG(1));
-    BPTR lock = (BPTR) Lock(n, ACCESS_READ);
+    BPTR lock = (BPTR) Lock(name, ACCESS_READ);
+    bool res = false;
 
     // Do we have a lock?
     if(lock)
@@ -591,52 +820,90 @@ entry_p n_getdiskspace(entry_p contxt)
         // Retrieve information from lock.
         if(Info(lock, &id))
         {
-            long long free = (long long) (id.id_NumBlocks - id.id_NumBlocksUsed)
-                                          * id.id_BytesPerBlock;
-            // Release lock ASAP.
-            UnLock(lock);
-
-            // From the Installer.guide 1.20:
-            //
-            // The parameter <unit> is optional and defines the unit for the
-            // returned disk space: "B" (or omitted) is "Bytes", "K" is
-            // "Kilobytes", "M" is "Megabytes" and "G" is "Gigabytes".
-            if(exists(C_ARG(2)))
-            {
-                switch(*str(C_ARG(2)))
-                {
-                    case 'K':
-                    case 'k':
-                        free >>= 10;
-                        break;
-
-                    case 'M':
-                    case 'm':
-                        free >>= 20;
-                        break;
-
-                    case 'G':
-                    case 'g':
-                        free >>= 30;
-                        break;
-                }
-            }
-
-            // Cap the return value.
-            R_NUM(free > INT_MAX ? INT_MAX : (int32_t) free);
+            *siz = (long long) (id.id_NumBlocks - id.id_NumBlocksUsed) *
+                   id.id_BytesPerBlock;
+            res = true;
         }
 
-        // Info() failed. Release lock.
+        // Release lock ASAP.
         UnLock(lock);
     }
 
-    // For some reason, we could not acquire a lock on <path>, or, we could get
-    // a lock, but failed when trying to retrieve info from the lock.
-    ERR(ERR_READ, n);
+    return res;
+    #elif !defined(__MINGW32__)
+    return h_host_space(name, siz);
+    #else
+    (void) name;
+    (void) siz;
+    return false;
     #endif
+}
 
-    // Failure.
-    R_NUM(-1);
+//------------------------------------------------------------------------------
+// (getdiskspace <pathname> [<unit>])                                    (V44)
+//     return available space
+//
+// Refer to Installer.guide 1.20 (25.10.1999) 1995-99 by Amiga Inc.
+//------------------------------------------------------------------------------
+entry_p n_getdiskspace(entry_p contxt)
+{
+    // We need a path.
+    C_SANE(1, NULL);
+
+    const char *n = str(C_ARG(1));
+    long long free = -1;
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    if(!h_diskspace(n, &free))
+    {
+        // For some reason, we could not acquire a lock on <path>, or, we could
+        // get a lock, but failed when trying to retrieve info from the lock.
+        ERR(ERR_READ, n);
+        R_NUM(-1);
+    }
+    #elif !defined(__MINGW32__)
+    if(get_num(contxt, "@host-probe") && !h_diskspace(n, &free))
+    {
+        // No such file or directory.
+        ERR(ERR_READ, n);
+        R_NUM(-1);
+    }
+    #endif
+
+    if(free < 0)
+    {
+        // Not supported.
+        R_NUM(-1);
+    }
+
+    // From the Installer.guide 1.20:
+    //
+    // The parameter <unit> is optional and defines the unit for the
+    // returned disk space: "B" (or omitted) is "Bytes", "K" is
+    // "Kilobytes", "M" is "Megabytes" and "G" is "Gigabytes".
+    if(exists(C_ARG(2)))
+    {
+        switch(*str(C_ARG(2)))
+        {
+            case 'K':
+            case 'k':
+                free >>= 10;
+                break;
+
+            case 'M':
+            case 'm':
+                free >>= 20;
+                break;
+
+            case 'G':
+            case 'g':
+                free >>= 30;
+                break;
+        }
+    }
+
+    // Cap the return value.
+    R_NUM(free > INT_MAX ? INT_MAX : (int32_t) free);
 }
 
 //------------------------------------------------------------------------------
@@ -674,27 +941,388 @@ entry_p n_getsize(entry_p contxt)
     // We need a file name.
     C_SANE(1, NULL);
 
-    // Open the file in read only mode.
-    FILE *file = h_fopen(contxt, str(C_ARG(1)), "r", false);
+    const char *name = str(C_ARG(1));
+    struct meta_t met;
+
+    // No need to open the file, the size is known if it exists.
+    mc_check(name, &met);
+
+    if(met.found && met.type == LG_FILE)
+    {
+        // Cap the return value.
+        R_NUM(met.size > INT_MAX ? INT_MAX : (int32_t) met.size);
+    }
+
+    // Could not read from file.
+    ERR(ERR_READ_FILE, name);
+    R_NUM(LG_FALSE);
+}
+
+//------------------------------------------------------------------------------
+// Adler-32 modulus and the largest number of bytes that can be summed before
+// 'beta' must be reduced, see RFC 1950 and zlib.
+//------------------------------------------------------------------------------
+#define ADLER_MOD 65521
+#define ADLER_MAX 5552
+
+// Size of the read buffer used by (getsum).
+#define ADLER_BUF (1 << 18)
+
+#if defined(__SSE2__)
+//------------------------------------------------------------------------------
+// Name:        h_adler32_sse2
+// Description: Sum a multiple of 16 bytes, no more than ADLER_MAX, using SSE2.
+//              Each 16 byte block adds the sum of its bytes to 'alfa', and 16
+//              times the 'alfa' it started with plus the bytes weighted 16 to
+//              1 to 'beta'. The result is the same as that of the scalar loop
+//              in h_adler32, without the reduction.
+// Input:       uint32_t *alfa:     Sum of bytes.
+//              uint32_t *beta:     Sum of sums.
+//              const uint8_t *buf: Data.
+//              size_t len:         Number of bytes.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_adler32_sse2(uint32_t *alfa, uint32_t *beta, const uint8_t *buf,
+                           size_t len)
+{
+    const __m128i zro = _mm_setzero_si128(),
+                  wlo = _mm_set_epi16(9, 10, 11, 12, 13, 14, 15, 16),
+                  whi = _mm_set_epi16(1, 2, 3, 4, 5, 6, 7, 8);
+
+    // Byte sums, sum of byte sums of earlier blocks and weighted sums.
+    __m128i vs1 = zro, vsp = zro, vs2 = zro;
+
+    for(size_t pos = 0; pos < len; pos += 16)
+    {
+        __m128i cur = _mm_loadu_si128((const __m128i *) (buf + pos));
+
+        vsp = _mm_add_epi32(vsp, vs1);
+        vs1 = _mm_add_epi32(vs1, _mm_sad_epu8(cur, zro));
+        vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpacklo_epi8(cur, zro),
+                                                wlo));
+        vs2 = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpackhi_epi8(cur, zro),
+                                                whi));
+    }
+
+    uint32_t s1[4], sp[4], s2[4];
+
+    _mm_storeu_si128((__m128i *) s1, vs1);
+    _mm_storeu_si128((__m128i *) sp, vsp);
+    _mm_storeu_si128((__m128i *) s2, vs2);
+
+    // The sums of the byte sums are in the low half of each 64-bit lane.
+    uint64_t blk = len >> 4, sum = (uint64_t) sp[0] + sp[2];
+
+    *beta = (uint32_t) (*beta + 16 * blk * *alfa + 16 * sum + s2[0] + s2[1] +
+                        s2[2] + s2[3]);
+    *alfa += s1[0] + s1[2];
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_adler32
+// Description: Update Adler-32 sums. Instead of reducing both sums for every
+//              byte, they are reduced once per ADLER_MAX bytes, the most that
+//              can be summed without overflow.
+// Input:       uint32_t *alfa:     Sum of bytes.
+//              uint32_t *beta:     Sum of sums.
+//              const uint8_t *buf: Data.
+//              size_t len:         Number of bytes.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_adler32(uint32_t *alfa, uint32_t *beta, const uint8_t *buf,
+                      size_t len)
+{
+    uint32_t a = *alfa, b = *beta;
+
+    while(len)
+    {
+        size_t cnt = len < ADLER_MAX ? len : ADLER_MAX;
+        len -= cnt;
+
+        #if defined(__SSE2__)
+        size_t vec = cnt & ~(size_t) 15;
+
+        if(vec)
+        {
+            // Multiples of 16 bytes.
+            h_adler32_sse2(&a, &b, buf, vec);
+            buf += vec;
+            cnt -= vec;
+        }
+        #endif
+
+        for(; cnt >= 8; cnt -= 8, buf += 8)
+        {
+            a += buf[0]; b += a; a += buf[1]; b += a;
+            a += buf[2]; b += a; a += buf[3]; b += a;
+            a += buf[4]; b += a; a += buf[5]; b += a;
+            a += buf[6]; b += a; a += buf[7]; b += a;
+        }
+
+        for(; cnt; cnt--)
+        {
+            a += *buf++;
+            b += a;
+        }
+
+        a %= ADLER_MOD;
+        b %= ADLER_MOD;
+    }
+
+    *alfa = a;
+    *beta = b;
+}
+
+#if !defined(AMIGA) && !defined(__MINGW32__)
+//------------------------------------------------------------------------------
+// Checksums and versions of files, keyed by device, inode, size and
+// modification time. A record is valid as long as the file is unchanged. If
+// enabled, each cache is stored next to the log file so that the next run can
+// use it as well.
+//------------------------------------------------------------------------------
+#define PC_HASH 256
+
+struct prec_t
+{
+    struct prec_t *nxt;
+    uint64_t dev, ino, siz, tim;
+    uint32_t val;
+};
+
+struct pcache_t
+{
+    struct prec_t *tab[PC_HASH];
+    char *var, *name;
+    const char *ext;
+    FILE *file;
+};
+
+static struct pcache_t sms = { { NULL }, "@sum-cache", NULL, ".sums", NULL },
+                       vrs = { { NULL }, "@version-cache", NULL, ".versions",
+                               NULL };
+
+//------------------------------------------------------------------------------
+// Name:        h_pcache_find
+// Description: Find or add cache record.
+// Input:       struct pcache_t *pc:        Cache.
+//              const struct prec_t *key:   Device, inode, size and time.
+//              bool add:                   Add record if not found.
+// Return:      struct prec_t *:            Record or NULL if not found / out
+//                                          of memory.
+//------------------------------------------------------------------------------
+static struct prec_t *h_pcache_find(struct pcache_t *pc,
+                                    const struct prec_t *key, bool add)
+{
+    struct prec_t **cur = &pc->tab[(key->ino ^ key->dev) % PC_HASH];
+
+    for(; *cur; cur = &(*cur)->nxt)
+    {
+        if((*cur)->dev == key->dev && (*cur)->ino == key->ino)
+        {
+            // Only a record of the same version of the file will do.
+            return add || ((*cur)->siz == key->siz && (*cur)->tim == key->tim)
+                   ? *cur : NULL;
+        }
+    }
+
+    if(add && (*cur = DBG_ALLOC(calloc(1, sizeof(struct prec_t)))) != NULL)
+    {
+        (*cur)->dev = key->dev;
+        (*cur)->ino = key->ino;
+    }
+
+    return *cur;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_pcache_clear
+// Description: Free cache records and close the file the cache is stored in.
+// Input:       struct pcache_t *pc:    Cache.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_pcache_clear(struct pcache_t *pc)
+{
+    for(size_t i = 0; i < PC_HASH; i++)
+    {
+        for(struct prec_t *cur = pc->tab[i], *nxt; cur; cur = nxt)
+        {
+            nxt = cur->nxt;
+            free(cur);
+        }
+
+        pc->tab[i] = NULL;
+    }
+
+    if(pc->file)
+    {
+        fclose(pc->file);
+        pc->file = NULL;
+    }
+
+    free(pc->name);
+    pc->name = NULL;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_pcache_open
+// Description: Load the cache stored next to the log file, and open it to be
+//              able to add new records.
+// Input:       entry_p contxt:         The execution context.
+//              struct pcache_t *pc:    Cache.
+// Return:      bool:                   'true' if the cache can be used, 'false'
+//                                      if it's disabled or out of memory.
+//------------------------------------------------------------------------------
+static bool h_pcache_open(entry_p contxt, struct pcache_t *pc)
+{
+    if(!get_num(contxt, pc->var))
+    {
+        // Not enabled.
+        return false;
+    }
+
+    const char *log = get_str(contxt, "@log-file");
+    size_t lln = strlen(log), len = lln + strlen(pc->ext) + 1;
+
+    if(pc->name && !strncmp(pc->name, log, lln) &&
+       !strcmp(pc->name + lln, pc->ext))
+    {
+        // Already loaded.
+        return true;
+    }
+
+    // The log file has been changed, start over.
+    h_pcache_clear(pc);
+    pc->name = DBG_ALLOC(calloc(len, 1));
+
+    if(!pc->name && PANIC(contxt))
+    {
+        // Out of memory.
+        return false;
+    }
+
+    snprintf(pc->name, len, "%s%s", log, pc->ext);
+
+    // Records from earlier runs, if any.
+    FILE *file = fopen(pc->name, "r");
 
     if(file)
     {
-        // Seek to the end of the file.
-        fseek(file, 0L, SEEK_END);
+        unsigned long long dev, ino, siz, tim;
+        unsigned long val;
 
-        // Let the result be the position.
-        int32_t res = (int32_t) ftell(file);
+        // Later records of the same file replace earlier ones.
+        while(fscanf(file, "%llu %llu %llu %llu %lu", &dev, &ino, &siz, &tim,
+                     &val) == 5)
+        {
+            struct prec_t key = { NULL, dev, ino, siz, tim, 0 },
+                          *rec = h_pcache_find(pc, &key, true);
 
-        // We're done.
-        h_fclose(&file);
+            if(!rec)
+            {
+                // Out of memory.
+                break;
+            }
+
+            rec->siz = siz;
+            rec->tim = tim;
+            rec->val = (uint32_t) val;
+        }
 
-        // Return position.
-        R_NUM(res);
+        fclose(file);
     }
 
-    // Could not read from file.
-    ERR(ERR_READ_FILE, str(C_ARG(1)));
-    R_NUM(LG_FALSE);
+    // Not being able to write the cache isn't an error, it's a cache.
+    pc->file = fopen(pc->name, "a");
+    mc_drop(pc->name);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_pcache_key
+// Description: Get cache key of open file.
+// Input:       FILE *file:         File handle.
+//              struct prec_t *key: Key.
+// Return:      bool:               'true' on success, 'false' otherwise.
+//------------------------------------------------------------------------------
+static bool h_pcache_key(FILE *file, struct prec_t *key)
+{
+    struct stat fst;
+
+    if(fstat(fileno(file), &fst) || !S_ISREG(fst.st_mode))
+    {
+        // Only regular files can be trusted.
+        return false;
+    }
+
+    key->dev = (uint64_t) fst.st_dev;
+    key->ino = (uint64_t) fst.st_ino;
+    key->siz = (uint64_t) fst.st_size;
+
+    #if defined(__linux__)
+    key->tim = (uint64_t) fst.st_mtim.tv_sec * 1000000000ULL +
+               (uint64_t) fst.st_mtim.tv_nsec;
+    #else
+    key->tim = (uint64_t) fst.st_mtime;
+    #endif
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_pcache_add
+// Description: Add record to cache, in memory and in the file it's stored in.
+// Input:       struct pcache_t *pc:        Cache.
+//              const struct prec_t *key:   Device, inode, size and time.
+//              uint32_t val:               Checksum / version.
+// Return:      -
+//------------------------------------------------------------------------------
+static void h_pcache_add(struct pcache_t *pc, const struct prec_t *key,
+                         uint32_t val)
+{
+    struct prec_t *rec = h_pcache_find(pc, key, true);
+
+    if(!rec)
+    {
+        // Out of memory, forget about it.
+        return;
+    }
+
+    rec->siz = key->siz;
+    rec->tim = key->tim;
+    rec->val = val;
+
+    if(pc->file)
+    {
+        fprintf(pc->file, "%llu %llu %llu %llu %lu\n",
+                (unsigned long long) key->dev, (unsigned long long) key->ino,
+                (unsigned long long) key->siz, (unsigned long long) key->tim,
+                (unsigned long) val);
+    }
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Name:        h_probe_free
+// Description: Free checksum and version caches and host information.
+// Input:       -
+// Return:      -
+//------------------------------------------------------------------------------
+void h_probe_free(void)
+{
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    h_pcache_clear(&sms);
+    h_pcache_clear(&vrs);
+
+    for(struct cspace_t *cur = hst.spc, *nxt; cur; cur = nxt)
+    {
+        nxt = cur->nxt;
+        free(cur->path);
+        free(cur);
+    }
+
+    memset(&hst, 0, sizeof(hst));
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -713,23 +1341,55 @@ entry_p n_getsum(entry_p contxt)
 
     if(file)
     {
-        int chr = getc(file), alfa = 1, beta = 0;
+        #if !defined(AMIGA) && !defined(__MINGW32__)
+        struct prec_t key, *rec = NULL;
+        bool use = h_pcache_open(contxt, &sms) && h_pcache_key(file, &key);
+
+        if(use && (rec = h_pcache_find(&sms, &key, false)) != NULL)
+        {
+            // The file hasn't changed since it was summed.
+            h_fclose(&file);
+            R_NUM((int32_t) rec->val);
+        }
+        #endif
+
+        uint8_t *buf = DBG_ALLOC(malloc(ADLER_BUF));
+
+        if(!buf && PANIC(contxt))
+        {
+            // Out of memory.
+            h_fclose(&file);
+            R_NUM(LG_FALSE);
+        }
+
+        uint32_t alfa = 1, beta = 0;
 
         // Adler-32 checksum.
-        while(chr != EOF)
+        for(size_t cnt = fread(buf, 1, ADLER_BUF, file); cnt;
+            cnt = fread(buf, 1, ADLER_BUF, file))
         {
-            alfa = (alfa + chr) % 65521;
-            beta = (alfa + beta) % 65521;
-            chr = getc(file);
+            h_adler32(&alfa, &beta, buf, cnt);
         }
 
+        free(buf);
+
         if(feof(file))
         {
+            uint32_t sum = (beta << 16) | alfa;
+
+            #if !defined(AMIGA) && !defined(__MINGW32__)
+            if(use)
+            {
+                // Remember it for later, in this run and the next ones.
+                h_pcache_add(&sms, &key, sum);
+            }
+            #endif
+
             // File completed.
             h_fclose(&file);
 
             // Return checksum.
-            R_NUM((beta << 16) | alfa);
+            R_NUM((int32_t) sum);
         }
 
         // I/O error. Close and bail.
@@ -881,60 +1541,86 @@ static int32_t h_getversion_lib(const char *name)
 }
 
 //------------------------------------------------------------------------------
-// Name:        h_getversion_file
-// Description: Helper for n_getversion. Get file version.
-// Input:       char *name: Filename.
-// Return:      int32_t:    File version.
+// Size of the blocks read when looking for the version string.
 //------------------------------------------------------------------------------
-int32_t h_getversion_file(const char *name)
-{
-    FILE *file = NULL;
-
-    #if defined(AMIGA) && !defined(LG_TEST)
-    struct Process *pro = (struct Process *) FindTask(NULL);
-    // Save the current window ptr.
-    APTR win = pro->pr_WindowPtr;
+#define VER_BUF (1 << 16)
 
-    // Disable auto request.
-    pro->pr_WindowPtr = (APTR) -1L;
-    #endif
-
-    // Attempt to open file.
-    file = h_fopen(end(), name, "r", false);
-
-    #if defined(AMIGA) && !defined(LG_TEST)
-    // Restore auto request.
-    pro->pr_WindowPtr = win;
-    #endif
+//------------------------------------------------------------------------------
+// Name:        h_getversion_scan
+// Description: Helper for h_getversion_file. Find the first version string in
+//              a file. The file is read in large blocks, and memchr() finds the
+//              candidates.
+// Input:       FILE *file:     File handle.
+// Return:      int32_t:        Version or LG_NOVER if there's none / out of
+//                              memory.
+//------------------------------------------------------------------------------
+static int32_t h_getversion_scan(FILE *file)
+{
+    // Version key string. Not a string literal, that would make the key of
+    // this file the first version string of the binary.
+    static const int key[] = {'$','V','E','R',':',' '};
+    const size_t kln = sizeof(key) / sizeof(key[0]), max = buf_len();
 
-    // Invalid version.
-    int32_t ver = LG_NOVER;
+    // A block, the end of the last one and what follows a version key.
+    char *mem = DBG_ALLOC(malloc(VER_BUF + max + 1));
 
-    if(!file)
+    if(!mem)
     {
-        // Failure.
-        return ver;
+        // Out of memory.
+        return LG_NOVER;
     }
 
-    // Version key string.
-    int key[] = {'$','V','E','R',':',' ', 0};
-    size_t ndx = 0;
+    size_t len = 0, cnt;
+    char *hit = NULL;
 
     // Find position of the version key.
-    for(int chr = 0; chr != EOF && key[ndx];
-        ndx = chr == key[ndx] ? ndx + 1 : 0)
+    while(!hit && (cnt = fread(mem + len, 1, VER_BUF, file)) != 0)
     {
-        chr = fgetc(file);
+        len += cnt;
+
+        // Candidates must leave room for the whole key.
+        size_t end = len < kln ? 0 : len - kln + 1;
+
+        for(char *cur = memchr(mem, '$', end); cur && !hit;
+            cur = memchr(cur + 1, '$', end - (size_t) (cur + 1 - mem)))
+        {
+            size_t ndx = 1;
+
+            while(ndx < kln && cur[ndx] == key[ndx])
+            {
+                ndx++;
+            }
+
+            hit = ndx == kln ? cur + kln : NULL;
+        }
+
+        if(!hit)
+        {
+            // The key might begin at the end of this block.
+            size_t kep = len < kln ? len : kln - 1;
+            memmove(mem, mem + len - kep, kep);
+            len = kep;
+        }
     }
 
-    // Did we find the key?
-    if(!key[ndx])
+    int32_t ver = LG_NOVER;
+
+    if(hit)
     {
-        // Fill up buffer with enough data to hold any realistic version string.
-        fread(buf_get(B_KEY), 1, buf_len(), file);
+        // Enough data to hold any realistic version string.
+        len -= (size_t) (hit - mem);
+        memmove(mem, hit, len < max ? len : max);
+        len = len < max ? len : max;
+
+        while(len < max && (cnt = fread(mem + len, 1, max - len, file)) != 0)
+        {
+            len += cnt;
+        }
+
+        mem[len] = '\0';
 
         // Begin after whitespace.
-        char *data = strchr(buf_put(B_KEY), ' ');
+        char *data = strchr(mem, ' ');
 
         if(data)
         {
@@ -953,6 +1639,62 @@ int32_t h_getversion_file(const char *name)
         }
     }
 
+    free(mem);
+    return ver;
+}
+
+//------------------------------------------------------------------------------
+// Name:        h_getversion_file
+// Description: Helper for n_getversion. Get file version.
+// Input:       entry_p contxt: The execution context.
+//              char *name:     Filename.
+// Return:      int32_t:        File version.
+//------------------------------------------------------------------------------
+int32_t h_getversion_file(entry_p contxt, const char *name)
+{
+    FILE *file = NULL;
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    struct Process *pro = (struct Process *) FindTask(NULL);
+    // Save the current window ptr.
+    APTR win = pro->pr_WindowPtr;
+
+    // Disable auto request.
+    pro->pr_WindowPtr = (APTR) -1L;
+    #endif
+
+    // Attempt to open file.
+    file = h_fopen(end(), name, "r", false);
+
+    #if defined(AMIGA) && !defined(LG_TEST)
+    // Restore auto request.
+    pro->pr_WindowPtr = win;
+    #endif
+
+    if(!file)
+    {
+        // Failure.
+        return LG_NOVER;
+    }
+
+    #if !defined(AMIGA) && !defined(__MINGW32__)
+    struct prec_t key, *rec = NULL;
+    bool use = h_pcache_open(contxt, &vrs) && h_pcache_key(file, &key);
+
+    // Files without a version string are remembered as well.
+    int32_t ver = use && (rec = h_pcache_find(&vrs, &key, false)) != NULL ?
+                  (int32_t) rec->val : h_getversion_scan(file);
+
+    if(use && !rec)
+    {
+        // Remember it for later, in this run and the next ones.
+        h_pcache_add(&vrs, &key, (uint32_t) ver);
+    }
+    #else
+    (void) contxt;
+    int32_t ver = h_getversion_scan(file);
+    #endif
+
     // We're done.
     h_fclose(&file);
 
@@ -998,7 +1740,7 @@ entry_p n_getversion(entry_p contxt)
         if(ver == LG_NOVER)
         {
             // Get file version.
-            ver = h_getversion_file(name);
+            ver = h_getversion_file(contxt, name);
         }
 
         // Only attempt to open library / device if file doesn't exist.
@@ -11,6 +11,7 @@
 #define PROBE_H_
 
 #include "types.h"
+#include <stdbool.h>
 
 entry_p n_database(entry_p contxt);
 entry_p n_earlier(entry_p contxt);
@@ -24,6 +25,8 @@ entry_p n_getversion(entry_p contxt);
 entry_p n_iconinfo(entry_p contxt);
 entry_p n_querydisplay(entry_p contxt);
 
-int32_t h_getversion_file(const char *name);
+bool h_diskspace(const char *name, long long *siz);
+int32_t h_getversion_file(entry_p contxt, const char *name);
+void h_probe_free(void);
 
 #endif
@@ -66,11 +66,17 @@ const char *tr(res_t res)
         /*62*/ "Append '%s' to '%s'\n", /*63*/ "Include '%s' in '%s'\n",
         /*64*/ "Version to install", /*65*/ "Version currently installed", /*66*/ "Unknown version",
         /*67*/ "Destination drawer", /*68*/ "There is no currently installed version",
-        /*69*/ "SCRIPT/A,APPNAME/K,MINUSER/K,DEFUSER/K,LANGUAGE/K,LOGFILE/K,NOLOG/S,NOPRETEND/S\n",
+        /*69*/ "SCRIPT/A,APPNAME/K,MINUSER/K,DEFUSER/K,LANGUAGE/K,LOGFILE/K,NOLOG/S,NOPRETEND/S,COMPILE/S,STREAM/S\n",
         /*70*/ "SCRIPT", /*71*/ "APPNAME", /*72*/ "MINUSER", /*73*/ "DEFUSER", /*74*/ "LANGUAGE",
         /*75*/ "LOGFILE", /*76*/ "NOLOG", /*77*/ "NOPRETEND",/*78*/ "Welcome to the %s utility. "
         /*..*/ "Please indicate how the the installation should proceed (based upon your knowledge "
         /*..*/ "of the Amiga computer).",
+        /*79*/ "Copied %lu file(s), %lu KB in %lu.%02lu s, %lu KB/s.\n",
+        /*80*/ "%lu.%lu MB/s, average %lu.%lu MB/s, %ld:%02ld left",
+        /*81*/ "Skipped '%s', '%s' is up to date.\n",
+        /*82*/ "Resumed copying '%s' to '%s' at %lu bytes.\n",
+        /*83*/ "File info cache: %lu hit(s), %lu miss(es).\n",
+        /*84*/ "Not enough space in '%s', %lu KB needed, %lu KB free. Copy anyway?",
         /*S_GONE*/ "OUT OF RANGE"
     };
 
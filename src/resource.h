@@ -86,7 +86,7 @@ typedef enum
     S_VUNK, /* "Unknown version" */
     S_DDRW, /* "Destination drawer" */
     S_NINS, /* "There is no currently installed version" */
-    S_ARGS, /* "SCRIPT/A,APPNAME/K,MINUSER/K,DEFUSER/K,LANGUAGE/K,LOGFILE/K,NOLOG/S,NOPRETEND/S" */
+    S_ARGS, /* "SCRIPT/A,APPNAME/K,MINUSER/K,DEFUSER/K,LANGUAGE/K,LOGFILE/K,NOLOG/S,NOPRETEND/S,COMPILE/S,STREAM/S" */
     S_SCRI, /* "SCRIPT" */
     S_APPN, /* "APPNAME" */
     S_MUSR, /* "MINUSER" */
@@ -96,6 +96,12 @@ typedef enum
     S_NLOG, /* "NOLOG" */
     S_NOPR, /* "NOPRETEND" */
     S_WELC, /* "Please indicate how..." */
+    S_CSTA, /* "Copied %lu file(s), %lu KB in %lu.%02lu s, %lu KB/s.\n" */
+    S_CPRG, /* "%lu.%lu MB/s, average %lu.%lu MB/s, %ld:%02ld left" */
+    S_UPTD, /* "Skipped '%s', '%s' is up to date.\n" */
+    S_RSME, /* "Resumed copying '%s' to '%s' at %lu bytes.\n" */
+    S_MCST, /* "File info cache: %lu hit(s), %lu miss(es).\n" */
+    S_NSPC, /* "Not enough space in '%s', %lu KB needed, %lu KB free. Copy anyway?" */
 
     // Out of range.
     S_GONE,
@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// uring.c:
+//
+// Minimal io_uring interface, Linux only. Setup, submission and completion of
+// requests by the way of the raw system calls, there's no dependency on any
+// library. Used by the (copyfiles) copy engine.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#include "uring.h"
+
+#if defined(LG_URING)
+#include "util.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//------------------------------------------------------------------------------
+// Name:        ur_init
+// Description: Set up ring with room for at least 'dep' requests in flight.
+//              This will allocate resources that must be free:d by calling
+//              ur_done().
+// Input:       struct ur_t *ur:    Ring.
+//              unsigned dep:       Number of requests.
+// Return:      bool:               'true' on success, 'false' if io_uring isn't
+//                                  available.
+//------------------------------------------------------------------------------
+bool ur_init(struct ur_t *ur, unsigned dep)
+{
+    struct io_uring_params prm;
+
+    memset(ur, 0, sizeof(struct ur_t));
+    memset(&prm, 0, sizeof(prm));
+
+    // Not supported by the kernel or not allowed. Leave the ring in a state
+    // that ur_done() can handle.
+    int fd = (int) syscall(__NR_io_uring_setup, dep, &prm);
+
+    ur->fd = fd < 0 ? -1 : fd;
+
+    if(ur->fd < 0)
+    {
+        return false;
+    }
+
+    // Both rings might be mapped at once.
+    ur->sq_len = prm.sq_off.array + prm.sq_entries * sizeof(unsigned);
+    ur->cq_len = prm.cq_off.cqes + prm.cq_entries *
+                 sizeof(struct io_uring_cqe);
+
+    if(prm.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ur->sq_len = ur->cq_len = ur->sq_len > ur->cq_len ? ur->sq_len :
+                     ur->cq_len;
+    }
+
+    ur->sq_map = mmap(NULL, ur->sq_len, PROT_READ | PROT_WRITE, MAP_SHARED |
+                      MAP_POPULATE, ur->fd, IORING_OFF_SQ_RING);
+    ur->cq_map = (prm.features & IORING_FEAT_SINGLE_MMAP) ? ur->sq_map :
+                 mmap(NULL, ur->cq_len, PROT_READ | PROT_WRITE, MAP_SHARED |
+                      MAP_POPULATE, ur->fd, IORING_OFF_CQ_RING);
+    ur->sqe_len = prm.sq_entries * sizeof(struct io_uring_sqe);
+    ur->sqe = mmap(NULL, ur->sqe_len, PROT_READ | PROT_WRITE, MAP_SHARED |
+                   MAP_POPULATE, ur->fd, IORING_OFF_SQES);
+
+    if(ur->sq_map == MAP_FAILED || ur->cq_map == MAP_FAILED ||
+       ur->sqe == MAP_FAILED)
+    {
+        ur_done(ur);
+        return false;
+    }
+
+    char *sqr = (char *) ur->sq_map, *cqr = (char *) ur->cq_map;
+
+    ur->sq_head = (unsigned *) (sqr + prm.sq_off.head);
+    ur->sq_tail = (unsigned *) (sqr + prm.sq_off.tail);
+    ur->sq_mask = (unsigned *) (sqr + prm.sq_off.ring_mask);
+    ur->sq_array = (unsigned *) (sqr + prm.sq_off.array);
+    ur->cq_head = (unsigned *) (cqr + prm.cq_off.head);
+    ur->cq_tail = (unsigned *) (cqr + prm.cq_off.tail);
+    ur->cq_mask = (unsigned *) (cqr + prm.cq_off.ring_mask);
+    ur->cqe = (struct io_uring_cqe *) (cqr + prm.cq_off.cqes);
+    ur->tail = *ur->sq_tail;
+    ur->num = prm.sq_entries;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_probe
+// Description: Find out if the kernel supports a set of operations.
+// Input:       struct ur_t *ur:    Ring.
+//              const uint8_t *ops: Operations, IORING_OP_*.
+//              size_t num:         Number of operations.
+// Return:      bool:               'true' if all operations are supported,
+//                                  'false' otherwise.
+//------------------------------------------------------------------------------
+bool ur_probe(struct ur_t *ur, const uint8_t *ops, size_t num)
+{
+    size_t len = sizeof(struct io_uring_probe) + 256 *
+                 sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *prb = DBG_ALLOC(calloc(1, len));
+
+    if(!prb)
+    {
+        // Out of memory.
+        return false;
+    }
+
+    bool ret = !syscall(__NR_io_uring_register, ur->fd, IORING_REGISTER_PROBE,
+                        prb, 256);
+
+    for(size_t cur = 0; ret && cur < num; cur++)
+    {
+        ret = ops[cur] <= prb->last_op &&
+              (prb->ops[ops[cur]].flags & IO_URING_OP_SUPPORTED);
+    }
+
+    free(prb);
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_buffers
+// Description: Register fixed buffers, used by the READ_FIXED / WRITE_FIXED
+//              operations. This fails if the buffers are bigger than what we
+//              are allowed to lock in memory.
+// Input:       struct ur_t *ur:            Ring.
+//              const struct iovec *vec:    Buffers.
+//              unsigned num:               Number of buffers.
+// Return:      bool:                       'true' on success, 'false'
+//                                          otherwise.
+//------------------------------------------------------------------------------
+bool ur_buffers(struct ur_t *ur, const struct iovec *vec, unsigned num)
+{
+    return !syscall(__NR_io_uring_register, ur->fd, IORING_REGISTER_BUFFERS,
+                    vec, num);
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_sqe
+// Description: Get a cleared submission queue entry. The request is submitted
+//              the next time ur_submit() is invoked.
+// Input:       struct ur_t *ur:    Ring.
+//              uint64_t dat:       User data, returned by ur_cqe().
+// Return:      struct io_uring_sqe *:  Entry to be filled in, NULL if the
+//                                      queue is full.
+//------------------------------------------------------------------------------
+struct io_uring_sqe *ur_sqe(struct ur_t *ur, uint64_t dat)
+{
+    unsigned head = __atomic_load_n(ur->sq_head, __ATOMIC_ACQUIRE);
+
+    if(ur->tail - head >= ur->num)
+    {
+        // Submit what we have first.
+        return NULL;
+    }
+
+    unsigned ndx = ur->tail++ & *ur->sq_mask;
+    struct io_uring_sqe *sqe = ur->sqe + ndx;
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->user_data = dat;
+    ur->sq_array[ndx] = ndx;
+
+    return sqe;
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_submit
+// Description: Submit all new requests and wait for completions.
+// Input:       struct ur_t *ur:    Ring.
+//              unsigned min:       Number of completions to wait for.
+// Return:      int:                Number of requests submitted, -1 on error.
+//------------------------------------------------------------------------------
+int ur_submit(struct ur_t *ur, unsigned min)
+{
+    // Make the new entries visible to the kernel.
+    __atomic_store_n(ur->sq_tail, ur->tail, __ATOMIC_RELEASE);
+
+    unsigned num = ur->tail - __atomic_load_n(ur->sq_head, __ATOMIC_ACQUIRE);
+    long ret;
+
+    do
+    {
+        ret = syscall(__NR_io_uring_enter, ur->fd, num, min, min ?
+                      IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    }
+    while(ret < 0 && errno == EINTR);
+
+    return (int) ret;
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_cqe
+// Description: Get the next completion, if any.
+// Input:       struct ur_t *ur:    Ring.
+//              uint64_t *dat:      User data of the request.
+//              int32_t *res:       Result of the request, the return value of
+//                                  the system call or -errno.
+// Return:      bool:               'true' if there was a completion, 'false'
+//                                  otherwise.
+//------------------------------------------------------------------------------
+bool ur_cqe(struct ur_t *ur, uint64_t *dat, int32_t *res)
+{
+    unsigned head = *ur->cq_head;
+
+    if(head == __atomic_load_n(ur->cq_tail, __ATOMIC_ACQUIRE))
+    {
+        // Nothing yet.
+        return false;
+    }
+
+    struct io_uring_cqe *cqe = ur->cqe + (head & *ur->cq_mask);
+
+    *dat = cqe->user_data;
+    *res = cqe->res;
+
+    // Give the entry back to the kernel.
+    __atomic_store_n(ur->cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Name:        ur_done
+// Description: Free resources allocated by ur_init(). Requests in flight must
+//              be completed first. Rings that ur_init() failed to set up, and
+//              rings with a negative file descriptor, have nothing to close.
+// Input:       struct ur_t *ur:    Ring.
+// Return:      -
+//------------------------------------------------------------------------------
+void ur_done(struct ur_t *ur)
+{
+    if(ur->sqe && ur->sqe != MAP_FAILED)
+    {
+        munmap(ur->sqe, ur->sqe_len);
+    }
+
+    if(ur->cq_map && ur->cq_map != MAP_FAILED && ur->cq_map != ur->sq_map)
+    {
+        munmap(ur->cq_map, ur->cq_len);
+    }
+
+    if(ur->sq_map && ur->sq_map != MAP_FAILED)
+    {
+        munmap(ur->sq_map, ur->sq_len);
+    }
+
+    if(ur->fd >= 0)
+    {
+        close(ur->fd);
+    }
+
+    memset(ur, 0, sizeof(struct ur_t));
+    ur->fd = -1;
+}
+#endif
@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// uring.h:
+//
+// Minimal io_uring interface, Linux only.
+//------------------------------------------------------------------------------
+// Copyright (C) 2018-2020, Ola Söder. All rights reserved.
+// Licensed under the AROS PUBLIC LICENSE (APL) Version 1.1
+//------------------------------------------------------------------------------
+
+#ifndef URING_H_
+#define URING_H_
+
+// The operations we need, openat, read, write and close, are supported from
+// Linux 5.6 and onwards. Older kernels are detected at runtime.
+#if defined(__linux__)
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+#define LG_URING
+#endif
+#endif
+
+#if defined(LG_URING)
+#include <linux/io_uring.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+//------------------------------------------------------------------------------
+// Ring. The file descriptor is -1 if there's no ring, refer to ur_init.
+//------------------------------------------------------------------------------
+struct ur_t
+{
+    int fd;
+    unsigned num;
+    unsigned tail;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_sqe *sqe;
+    struct io_uring_cqe *cqe;
+    void *sq_map;
+    void *cq_map;
+    size_t sq_len;
+    size_t cq_len;
+    size_t sqe_len;
+};
+
+bool ur_init(struct ur_t *ur, unsigned dep);
+bool ur_probe(struct ur_t *ur, const uint8_t *ops, size_t num);
+bool ur_buffers(struct ur_t *ur, const struct iovec *vec, unsigned num);
+struct io_uring_sqe *ur_sqe(struct ur_t *ur, uint64_t dat);
+int ur_submit(struct ur_t *ur, unsigned min);
+bool ur_cqe(struct ur_t *ur, uint64_t *dat, int32_t *res);
+void ur_done(struct ur_t *ur);
+#endif
+
+#endif
@@ -366,6 +366,22 @@ static void opt_clear_cache(entry_p *cache)
     cache[OPT_INIT] = end();
 }
 
+// The context of the current option cache, refer to opt().
+static entry_p opt_last;
+
+//------------------------------------------------------------------------------
+// Name:        opt_forget
+// Description: Invalidate the option cache. Must be done before contexts are
+//              freed during execution, a new context might end up at the same
+//              address as the cached one.
+// Input:       -
+// Return:      -
+//------------------------------------------------------------------------------
+void opt_forget(void)
+{
+    opt_last = NULL;
+}
+
 //------------------------------------------------------------------------------
 // Name:        opt
 // Description: Find option of a given type in a context.
@@ -375,7 +391,7 @@ static void opt_clear_cache(entry_p *cache)
 //------------------------------------------------------------------------------
 entry_p opt(entry_p contxt, opt_t type)
 {
-    static entry_p cache[OPT_LAST], last;
+    static entry_p cache[OPT_LAST];
 
     // We need a valid context.
     if(!contxt || !contxt->children)
@@ -385,14 +401,14 @@ entry_p opt(entry_p contxt, opt_t type)
     }
 
     // Return cached value if cache is full.
-    if(contxt == last)
+    if(contxt == opt_last)
     {
         return cache[type];
     }
 
     // Start fram scratch with new context.
     opt_clear_cache(cache);
-    last = contxt;
+    opt_last = contxt;
 
     // Populate cache.
     opt_fill_cache(contxt, cache);
@@ -0,0 +1,47 @@
+#
+# Startup time benchmark, parsing vs precompiled image.
+#
+# Usage: bench.sh INSTALLER [NUMBER OF STATEMENTS] [NUMBER OF RUNS]
+#
+prg=$1
+num=${2:-5000}
+rep=${3:-5}
+
+ms()
+{
+    s=`date +%s%N`
+    $prg $1 > /dev/null 2>&1
+    e=`date +%s%N`
+    echo $(( ($e - $s) / 1000000 ))
+}
+
+# Keep the statements in a procedure that's never called, the startup cost is
+# what we want to measure, not the execution.
+scr=`mktemp bench.tmp.XXXXXX`
+echo "(procedure P_BENCH x" > $scr
+i=0
+while [ $i -lt $num ];
+do
+    echo "(if (= x $i) (set y (cat \"$i\" (+ x 1))) (message (\"%ld\" x)))" >> $scr
+    i=$(( $i + 1 ))
+done
+echo ") (set y 0)" >> $scr
+
+echo "Script: $num statements, `wc -c < $scr` bytes"
+$prg -compile $scr
+echo "Image:  `wc -c < $scr.lgc` bytes"
+
+i=0
+while [ $i -lt $rep ];
+do
+    # Parse, then load cached image, then run the image directly.
+    mv $scr.lgc $scr.img
+    p=`ms $scr`
+    mv $scr.img $scr.lgc
+    c=`ms $scr`
+    d=`ms $scr.lgc`
+    echo "Parse: $p ms  Cache: $c ms  Image: $d ms"
+    i=$(( $i + 1 ))
+done
+
+rm -f $scr $scr.lgc
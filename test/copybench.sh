@@ -0,0 +1,53 @@
+#
+# (copyfiles) benchmark, one file at a time vs workers vs io_uring.
+#
+# Usage: copybench.sh INSTALLER [NUMBER OF FILES] [FILE SIZE IN KB] [JOBS]
+#
+# Reports the throughput of each mode, and the number of system calls per file
+# if strace is available.
+#
+prg=`realpath $1`
+num=${2:-2000}
+siz=${3:-16}
+job=${4:-8}
+
+dir=`mktemp -d copybench.tmp.XXXXXX`
+mkdir $dir/src
+i=0
+while [ $i -lt $num ];
+do
+    head -c $(( $siz * 1024 )) /dev/urandom > $dir/src/f$i
+    i=$(( $i + 1 ))
+done
+
+echo "(copyfiles (source \"src\") (dest \"dst\") (all))" > $dir/scr
+echo "Files: $num x $siz KB"
+
+run()
+{
+    rm -rf $dir/dst
+    s=`date +%s%N`
+    (cd $dir && $prg $1 scr > /dev/null 2>&1)
+    e=`date +%s%N`
+    t=$(( ($e - $s) / 1000000 ))
+    t=$(( $t > 0 ? $t : 1 ))
+    l="$2: $t ms, $(( $num * $siz * 1000 / 1024 / $t )) MB/s"
+
+    which strace > /dev/null 2>&1
+    if [ $? -eq 0 ]; then
+        rm -rf $dir/dst
+        (cd $dir && strace -f -o trace $prg $1 scr > /dev/null 2>&1)
+        c=`grep -vc 'resumed>' $dir/trace`
+        l="$l, `awk -v c=$c -v n=$num 'BEGIN { printf("%.1f", c / n) }'`"
+        l="$l syscalls / file"
+    fi
+
+    echo "$l"
+}
+
+export _INSTALLER_LG_=yes
+run "" "Sync "
+run "-jobs $job" "Jobs "
+run "-uring -jobs $job" "Uring"
+
+rm -rf $dir
@@ -4,6 +4,13 @@ run()
     instfile=`mktemp Installer.tmp.XXXXXX`
     echo $1 > $instfile
 
+    if [ -n "${LG_IMAGE}" ]; then
+        $prg -compile $instfile > /dev/null 2>&1
+        if [ -f $instfile.lgc ]; then
+            mv $instfile.lgc $instfile
+        fi
+    fi
+
     which valgrind > /dev/null 2>&1
     if [ $? -eq 0 ] && [ -z "${LG_SMOKE}" ]; then
         l=`mktemp leak.tmp.XXXXXX`
@@ -84,6 +91,10 @@ evl()
 
 prg=$1
 tst=$2
+if [ -n "${LG_STREAM}" ]; then prg="$1 -stream"; fi
+if [ -n "${LG_JOBS}" ]; then prg="$prg -jobs ${LG_JOBS}"; fi
+if [ -n "${LG_URING}" ]; then prg="$prg -uring"; fi
+if [ -n "${LG_PIPE}" ]; then prg="$prg -pipe"; fi
 nfl=0
 nok=0
 
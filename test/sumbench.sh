@@ -0,0 +1,37 @@
+#
+# (getsum) benchmark, throughput with and without the checksum cache.
+#
+# Usage: sumbench.sh INSTALLER [FILE SIZE IN MB] [NUMBER OF RUNS]
+#
+prg=`realpath $1`
+siz=${2:-100}
+rep=${3:-5}
+
+dir=`mktemp -d sumbench.tmp.XXXXXX`
+head -c $(( $siz * 1048576 )) /dev/urandom > $dir/file
+echo "File: $siz MB"
+
+run()
+{
+    echo "$1 (getsum \"file\")" > $dir/scr
+    rm -f $dir/install_log_file.sums
+    i=0
+    b=0
+    while [ $i -lt $rep ];
+    do
+        s=`date +%s%N`
+        r=`cd $dir && $prg scr 2>&1 | tail -n 1`
+        e=`date +%s%N`
+        t=$(( ($e - $s) / 1000000 ))
+        t=$(( $t > 0 ? $t : 1 ))
+        b=$(( $i == 0 || $t < $b ? $t : $b ))
+        i=$(( $i + 1 ))
+    done
+    echo "$2: $b ms, $(( $siz * 1000 / $b )) MB/s, sum $r"
+}
+
+export _INSTALLER_LG_=yes
+run "" "Read "
+run "(set @sum-cache 1)" "Cache"
+
+rm -rf $dir
@@ -0,0 +1,42 @@
+#
+# (getversion) benchmark, time per file with and without the version cache.
+#
+# Usage: verbench.sh INSTALLER [NUMBER OF ROUNDS]
+#
+# The corpus is the data.copylib.* files next to this script, each of them is
+# probed once per round.
+#
+prg=`realpath $1`
+rep=${2:-200}
+src=`dirname $0`
+
+dir=`mktemp -d verbench.tmp.XXXXXX`
+cp $src/data.copylib.* $dir
+num=`ls $dir | wc -l`
+echo "Corpus: $num files, `cat $dir/data.copylib.* | wc -c` bytes"
+
+run()
+{
+    echo "$1" > $dir/scr
+    i=0
+    while [ $i -lt $rep ];
+    do
+        for f in `cd $dir && ls data.copylib.*`;
+        do
+            echo "(getversion \"$f\")" >> $dir/scr
+        done
+        i=$(( $i + 1 ))
+    done
+
+    rm -f $dir/install_log_file.versions
+    s=`date +%s%N`
+    (cd $dir && $prg scr > /dev/null 2>&1)
+    e=`date +%s%N`
+    echo "$2: $(( ($e - $s) / 1000 / ($num * $rep) )) us / file"
+}
+
+export _INSTALLER_LG_=yes
+run "" "Scan "
+run "(set @version-cache 1)" "Cache"
+
+rm -rf $dir